@@ -236,8 +236,10 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_CRC_16 is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Must be one of the implemented algorithms (see brief in CFE_ES_CrcType_Enum
+**      definition in cfe_es_api_typedefs.h).  Critical Data Stores preserved
+**      across a processor reset are validated with this algorithm, so changing
+**      it invalidates them on the first restart with the new setting.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_CRC_16
 
@@ -36,6 +36,9 @@ typedef struct
 
 static CFE_FT_PoolMemBlock_t CFE_FT_PoolMemBlock[CFE_PLATFORM_ES_MAX_MEMORY_POOLS + 1];
 
+/* Number of get/put cycles timed for each request size in the bucket lookup benchmark */
+#define CFE_FT_POOL_PERF_CYCLES 10000
+
 void TestMemPoolCreate(void)
 {
     CFE_ES_MemHandle_t PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
@@ -176,6 +179,37 @@ void TestMemPoolPutBuf(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
 }
 
+void TestMemPoolCreateConcurrent(void)
+{
+    CFE_ES_MemHandle_t  PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    int8                Pool[1024];
+    size_t              Buffer    = 512;
+    CFE_ES_MemPoolBuf_t addressp1 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolBuf_t addressp2 = CFE_ES_MEMPOOLBUF_C(0);
+
+    UtPrintf("Testing: CFE_ES_PoolCreateConcurrent");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(NULL, Pool, sizeof(Pool), 0, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID, NULL, sizeof(Pool), 0, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID, Pool, 0, 0, NULL), CFE_ES_BAD_ARGUMENT);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID, Pool, sizeof(Pool), 0, NULL), CFE_SUCCESS);
+
+    /* Blocks of different sizes come from different buckets */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, Buffer), Buffer);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 16), 16);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID, addressp1), Buffer);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), Buffer);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), 16);
+
+    /* A returned block is recycled */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, Buffer), Buffer);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
 void TestMemPoolDelete(void)
 {
     CFE_ES_MemHandle_t    PoolID = CFE_ES_MEMHANDLE_UNDEFINED; /* Pool 1 handle, no mutex */
@@ -203,6 +237,79 @@ void TestMemPoolDelete(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+/*
+ * Time a series of get/put cycles of a single request size, such that
+ * the cost of bucket selection for that size can be characterized.
+ */
+static void CFE_FT_TimePoolGetPut(CFE_ES_MemHandle_t PoolID, size_t ReqSize)
+{
+    CFE_ES_MemPoolBuf_t BufPtr = CFE_ES_MEMPOOLBUF_C(0);
+    uint32              Count;
+    OS_time_t           StartTime;
+    OS_time_t           ElapsedTime;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (Count = 0; Count < CFE_FT_POOL_PERF_CYCLES; ++Count)
+    {
+        /* In order to not "flood" with test results, this should be silent unless a failure occurs */
+        CFE_Assert_STATUS_STORE(CFE_ES_GetPoolBuf(&BufPtr, PoolID, ReqSize));
+        if (!CFE_Assert_STATUS_SILENTCHECK(ReqSize))
+        {
+            break;
+        }
+
+        CFE_Assert_STATUS_STORE(CFE_ES_PutPoolBuf(PoolID, BufPtr));
+        if (!CFE_Assert_STATUS_SILENTCHECK(ReqSize))
+        {
+            break;
+        }
+    }
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    UtAssert_UINT32_EQ(Count, CFE_FT_POOL_PERF_CYCLES);
+    UtAssert_MIR("Elapsed time for %lu get/put cycles of %lu bytes: %lu usec",
+                 (unsigned long)Count,
+                 (unsigned long)ReqSize,
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+}
+
+void TestMemPoolBucketLookupPerf(void)
+{
+    CFE_ES_MemHandle_t PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    uint32             Pool[1024];
+    size_t             BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    uint16             i;
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf/CFE_ES_PutPoolBuf bucket lookup performance");
+
+    /*
+     * Use the maximum number of block sizes, so a request for the largest
+     * block is the worst case for bucket selection.  Bucket lookup should be
+     * independent of the bucket position, so the elapsed time for the
+     * smallest and largest request should be comparable.
+     */
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        BlockSizes[i] = 16 * (i + 1);
+    }
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateEx(&PoolID,
+                                          Pool,
+                                          sizeof(Pool),
+                                          CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                          BlockSizes,
+                                          CFE_ES_NO_MUTEX),
+                      CFE_SUCCESS);
+
+    CFE_FT_TimePoolGetPut(PoolID, BlockSizes[0]);
+    CFE_FT_TimePoolGetPut(PoolID, BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS - 1]);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
 void ESMemPoolTestSetup(void)
 {
     UtTest_Add(TestMemPoolCreate, NULL, NULL, "Test Mem Pool Create");
@@ -210,5 +317,7 @@ void ESMemPoolTestSetup(void)
     UtTest_Add(TestMemPoolGetBuf, NULL, NULL, "Test Mem Pool Get Buf");
     UtTest_Add(TestMemPoolBufInfo, NULL, NULL, "Test Mem Pool Buf Info");
     UtTest_Add(TestMemPoolPutBuf, NULL, NULL, "Test Mem Pool Put Buf");
+    UtTest_Add(TestMemPoolCreateConcurrent, NULL, NULL, "Test Mem Pool Create Concurrent");
     UtTest_Add(TestMemPoolDelete, NULL, NULL, "Test Mem Pool Delete");
+    UtTest_Add(TestMemPoolBucketLookupPerf, NULL, NULL, "Test Mem Pool Bucket Lookup Performance");
 }
@@ -49,12 +49,12 @@ void TestCalculateCRC(void)
                        0xBB3D);
 
     /*
-     * In this version of CFE, only CRC-16/ARC is defined, so the default must be the same.  In a future version of CFE,
-     * if more than one option is available, this can go back to an "MIR" case, and the user must compare the result
-     * to the check value for what they have actully configured as the default CRC.
+     * More than one CRC is defined, so the user must compare the result to the check value for what they have
+     * actually configured as the default CRC.
      */
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_MISSION_ES_DEFAULT_CRC),
-                       0xBB3D);
+    UtAssert_MIR("Default CRC check value: 0x%08lx",
+                 (unsigned long)CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0,
+                                                    CFE_MISSION_ES_DEFAULT_CRC));
 
     /* Compute a secondary string - the reference value obtained using 3rd party tool implementing same algorithm */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
@@ -65,11 +65,84 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 345353, CFE_ES_CrcType_16_ARC),
                        0xE493);
 
+    /* The 32 bit algorithms start from an input value of 0, check values are 0xcbf43926 and 0xe3069283 */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32_ISO_HDLC),
+                       0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32_ISCSI),
+                       0xE3069283);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_32_ISO_HDLC),
+                       0x4ECA154C);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_32_ISCSI),
+                       0x688F6E8E);
+
+    /* Passing the result of one chunk as the input of the next gives the CRC of the whole */
+    inputCrc = CFE_ES_CalculateCRC(CRC_CHECK_INPUT, 4, 0, CFE_ES_CrcType_32_ISO_HDLC);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CRC_CHECK_INPUT[4], sizeof(CRC_CHECK_INPUT) - 5, inputCrc,
+                                           CFE_ES_CrcType_32_ISO_HDLC),
+                       0xCBF43926);
+    inputCrc = 345353;
+
     /* NULL input or 0 size returns input crc */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(NULL, sizeof(CRC_OTHER_INPUT), inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, 0, inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
 }
 
+void TestCalculateCRCThroughput(void)
+{
+    static uint8 Data[65536];
+
+    static const struct
+    {
+        CFE_ES_CrcType_Enum_t CrcType;
+        const char           *Name;
+    } CRC_TYPES[] = {
+        { CFE_ES_CrcType_16_ARC,      "CRC-16/ARC"      },
+        { CFE_ES_CrcType_32_ISO_HDLC, "CRC-32/ISO-HDLC" },
+        { CFE_ES_CrcType_32_ISCSI,    "CRC-32/ISCSI"    },
+    };
+
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+    int64     Rate;
+    uint32    Crc;
+    uint32    i;
+    uint32    j;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC throughput");
+
+    for (i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = i ^ (i >> 8);
+    }
+
+    for (j = 0; j < sizeof(CRC_TYPES) / sizeof(CRC_TYPES[0]); j++)
+    {
+        Crc = 0;
+
+        CFE_PSP_GetTime(&StartTime);
+
+        /* 16 MiB in total, about the size of the largest tables */
+        for (i = 0; i < 256; i++)
+        {
+            Crc = CFE_ES_CalculateCRC(Data, sizeof(Data), Crc, CRC_TYPES[j].CrcType);
+        }
+
+        CFE_PSP_GetTime(&ElapsedTime);
+        ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+        /* If ElapsedTime is 0, then something is probably wrong - but do not divide by 0 */
+        Rate = OS_TimeGetTotalMicroseconds(ElapsedTime);
+        if (Rate != 0)
+        {
+            Rate = ((int64)i * sizeof(Data) * 10) / Rate;
+        }
+
+        UtAssert_MIR("%s: %lu bytes in %lu usec, %ld.%01ld MB/sec (CRC 0x%08lx)", CRC_TYPES[j].Name,
+                     (unsigned long)(i * sizeof(Data)), (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime),
+                     (long)(Rate / 10), (long)(Rate % 10), (unsigned long)Crc);
+    }
+}
+
 void TestWriteToSysLog(void)
 {
     const char *TestString = "Test String for CFE_ES_WriteToSysLog Functional Test";
@@ -122,6 +195,7 @@ void TestBackgroundWakeup(void)
 void ESMiscTestSetup(void)
 {
     UtTest_Add(TestCalculateCRC, NULL, NULL, "Test Calculate CRC");
+    UtTest_Add(TestCalculateCRCThroughput, NULL, NULL, "Test Calculate CRC Throughput");
     UtTest_Add(TestWriteToSysLog, NULL, NULL, "Test Write To Sys Log");
     UtTest_Add(TestProcessAsyncEvent, NULL, NULL, "Test Process Async Event");
     UtTest_Add(TestBackgroundWakeup, NULL, NULL, "Test Background Wakeup");
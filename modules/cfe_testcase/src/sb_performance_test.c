@@ -40,6 +40,9 @@ uint32_t UT_BulkTestDuration = 1000;
 /* Number of SB messages sent before yielding CPU (has to be power of 2 minus 1)*/
 static uint32_t UT_CpuYieldMask = 1024 - 1;
 
+/* Route counts for the routing table lookup test */
+static const uint32 UT_RouteLookupCounts[] = {256, 1024, 4096};
+
 /* State structure for multicore test - shared between threads */
 typedef struct UT_BulkMultiCoreSharedState
 {
@@ -620,6 +623,114 @@ void TestBulkTransferMulti4(void)
     UtAssert_INT32_EQ(OS_CountSemDelete(BulkTlm.SyncSem), OS_SUCCESS);
 }
 
+/*
+ * Fabricate a msgid for the routing table lookup test, counting down from the
+ * top of the valid range.  This assumes real msgids are not allocated from the
+ * top of the range, since messages are sent to these (as above, they should
+ * not overlap/interfere with real MIDs used by other apps).
+ */
+static CFE_SB_MsgId_t UT_RouteLookupMsgId(uint32 Idx)
+{
+    return CFE_SB_ValueToMsgId(CFE_PLATFORM_SB_HIGHEST_VALID_MSGID - Idx);
+}
+
+/*
+ * Time transfers to each of the given number of routes in turn, such that the
+ * routing table lookup for each message is (normally) not in the cache
+ */
+static void UT_TimeRouteLookup(uint32 NumRoutes)
+{
+    CFE_SB_PipeId_t             PipeId = CFE_SB_INVALID_PIPE;
+    CFE_TEST_TestTlmMessage32_t TlmMsg;
+    CFE_SB_Buffer_t            *MsgBuf;
+    uint32                      NumSubs;
+    uint32                      SendCount;
+    OS_time_t                   StartTime;
+    OS_time_t                   ElapsedTime;
+
+    if (NumRoutes > CFE_PLATFORM_SB_MAX_MSG_IDS || NumRoutes > CFE_PLATFORM_SB_HIGHEST_VALID_MSGID)
+    {
+        UtAssert_NA("Lookup with %lu routes not supported by configuration", (unsigned long)NumRoutes);
+        return;
+    }
+
+    memset(&TlmMsg, 0, sizeof(TlmMsg));
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, 2, "RoutePerfPipe"), CFE_SUCCESS);
+
+    /*
+     * Routes used by other apps count against CFE_PLATFORM_SB_MAX_MSG_IDS, so this
+     * may not get all the requested routes.  Note the routes are removed again when
+     * the pipe is deleted.
+     */
+    for (NumSubs = 0; NumSubs < NumRoutes; ++NumSubs)
+    {
+        if (CFE_SB_SubscribeEx(UT_RouteLookupMsgId(NumSubs), PipeId, CFE_SB_DEFAULT_QOS, 1) != CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    UtAssert_NONZERO(NumSubs);
+    UtAssert_INT32_EQ(
+        CFE_MSG_Init(CFE_MSG_PTR(TlmMsg.TelemetryHeader), UT_RouteLookupMsgId(0), sizeof(TlmMsg)), CFE_SUCCESS);
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (SendCount = 0; NumSubs != 0 && SendCount < UT_BulkTestDuration; ++SendCount)
+    {
+        CFE_MSG_SetMsgId(CFE_MSG_PTR(TlmMsg.TelemetryHeader), UT_RouteLookupMsgId(SendCount % NumSubs));
+
+        /* In order to not "flood" with test results, this should be silent unless a failure occurs */
+        CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmMsg.TelemetryHeader), true));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            break;
+        }
+
+        CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBuffer(&MsgBuf, PipeId, CFE_SB_POLL));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            break;
+        }
+    }
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    UtAssert_MIR("Elapsed time for %lu transfers over %lu of %lu routes: %lu usec",
+                 (unsigned long)SendCount,
+                 (unsigned long)NumSubs,
+                 (unsigned long)NumRoutes,
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    if (SendCount != 0)
+    {
+        UtAssert_MIR("Average transfer time with %lu routes: %lu nsec",
+                     (unsigned long)NumSubs,
+                     (unsigned long)(OS_TimeGetTotalNanoseconds(ElapsedTime) / SendCount));
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+}
+
+void TestRouteLookupPerf(void)
+{
+    uint32 i;
+
+    UtPrintf("Testing: SB Transmit/Receive routing table lookup performance");
+
+    /*
+     * The time per transfer should not grow much with the number of routes,
+     * any increase is mostly due to the routing table lookup (map probes and
+     * cache misses).  Compare between routing implementations.
+     */
+    for (i = 0; i < (sizeof(UT_RouteLookupCounts) / sizeof(UT_RouteLookupCounts[0])); ++i)
+    {
+        UT_TimeRouteLookup(UT_RouteLookupCounts[i]);
+    }
+}
+
 void SBPerformanceTestSetup(void)
 {
     long      i;
@@ -654,4 +765,5 @@ void SBPerformanceTestSetup(void)
     UtTest_Add(TestBulkTransferSingle, NULL, NULL, "Single Thread Bulk Transfer");
     UtTest_Add(TestBulkTransferMulti2, NULL, NULL, "2 Thread Bulk Transfer");
     UtTest_Add(TestBulkTransferMulti4, NULL, NULL, "4 Thread Bulk Transfer");
+    UtTest_Add(TestRouteLookupPerf, NULL, NULL, "Route Lookup Performance");
 }
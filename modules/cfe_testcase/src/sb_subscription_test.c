@@ -199,8 +199,8 @@ void TestSBMaxSubscriptions(void)
      * exactly how many iterations of this loop will succeed, but it should be fewer than
      * CFE_PLATFORM_SB_MAX_MSG_IDS.
      *
-     * NOTE: after this loop, it may not be possible to add any more routes at all, until
-     * a processor reset is done, because routes are never actually deleted for sequence number persistence.
+     * NOTE: until the pipe is deleted after this loop, it is not possible for any other
+     * app to add routes.
      */
     NumSubs = 0;
     while (NumSubs <= CFE_PLATFORM_SB_MAX_MSG_IDS)
@@ -287,7 +287,7 @@ void SBSubscriptionTestSetup(void)
 
     /*
      * NOTE: The TestSBMaxSubscriptions() is not included/added by default, as it will fill the
-     * routing table and make it not possible to add new routes until the system is reset.
+     * routing table and make it not possible for other apps to add new routes while it runs.
      *
      * The test can be optionally enabled by the user and should pass, if this is not a concern.
      */
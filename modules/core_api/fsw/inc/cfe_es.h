@@ -1364,6 +1364,62 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID,
                                                bool                UseMutex,
                                                size_t              Alignment);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool that allows concurrent get/put requests
+**
+** \par Description
+**        This routine initializes a pool of memory supplied by the calling application.  Buffers that
+**        are put back are kept on a lock-free stack for each block size (bucket), so getting a
+**        previously used buffer, putting a buffer and getting the size of a buffer do not take a mutex.
+**        The pool mutex is only taken when a new block must be carved from the unused area of the pool.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The size of the pool must be an integral number of 32-bit words
+**        -# The start address of the pool must be 32-bit aligned
+**        -# 168 bytes are used for internal bookkeeping, therefore, they will not be available for allocation.
+**        -# The size of the pool must not exceed 4GiB.
+**        -# If the compiler provides neither C11 atomics nor the GCC atomic builtins, the pool is
+**           created as with #CFE_ES_PoolCreateEx using a mutex.
+**        -# Putting the same buffer back from two tasks at the same time is not detected.
+**
+** \param[out]   PoolID        A pointer to the variable the caller wishes to have the memory pool handle kept in
+*@nonnull.
+**                             PoolID is the memory pool handle.
+**
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application @nonnull. This address
+*must
+**                             be aligned suitably for the processor architecture.  The #CFE_ES_STATIC_POOL_TYPE
+**                             macro may be used to assist in creating properly aligned memory pools.
+**
+** \param[in]   Size           The size of the pool of memory @nonzero.  Note that this must be an integral multiple of
+*the
+**                             memory alignment of the processor architecture.
+**
+** \param[in]   NumBlockSizes  The number of different block sizes specified in the \c BlockSizes array. If set
+**                             larger than #CFE_PLATFORM_ES_POOL_MAX_BUCKETS, #CFE_ES_BAD_ARGUMENT will be returned.
+**                             If BlockSizes is null and NumBlockSizes is 0, NubBlockSizes will be set to
+**                             #CFE_PLATFORM_ES_POOL_MAX_BUCKETS.
+**
+** \param[in]   BlockSizes     Pointer to an array of sizes to be used instead of the default block sizes specified by
+**                             #CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 through #CFE_PLATFORM_ES_MAX_BLOCK_SIZE.  If the
+**                             pointer is equal to NULL, the default block sizes are used.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolCreateConcurrent(CFE_ES_MemHandle_t *PoolID,
+                                         void               *MemPtr,
+                                         size_t              Size,
+                                         uint16              NumBlockSizes,
+                                         const size_t       *BlockSizes);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
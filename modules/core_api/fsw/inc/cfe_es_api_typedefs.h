@@ -86,7 +86,8 @@ typedef void *CFE_ES_StackPointer_t; /* aka osal_stackptr_t in proposed OSAL cha
 /**
  * \brief Checksum/CRC algorithm identifiers
  *
- * Currently only CFE_ES_CrcType_16_ARC is supported.
+ * CFE_ES_CrcType_16_ARC, CFE_ES_CrcType_32_ISO_HDLC and CFE_ES_CrcType_32_ISCSI
+ * are supported.
  *
  * All defined CRC algorithms should include a check value, which is the accepted
  * result of computing the CRC across the fixed string "123456789"
@@ -112,11 +113,45 @@ typedef enum CFE_ES_CrcType_Enum
      */
     CFE_ES_CrcType_16_ARC = 1,
 
+    /**
+     * \brief Implementation of CRC-32/ISO-HDLC
+     *
+     * This is the common "CRC-32", as used by Ethernet and zlib
+     *
+     * \par
+     *   Polynomial: 0x04c11db7 <br>
+     *   Initialization: 0xffffffff <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xcbf43926 <br>
+     *   XorOut: 0xffffffff <br>
+     *
+     * The XorOut is applied to the input CRC as well as to the result,
+     * so the input CRC is 0 to start a new CRC, and the result of the
+     * previous call to continue one.
+     */
+    CFE_ES_CrcType_32_ISO_HDLC = 2,
+
+    /**
+     * \brief Implementation of CRC-32/ISCSI
+     *
+     * Also known as CRC-32C (Castagnoli)
+     *
+     * \par
+     *   Polynomial: 0x1edc6f41 <br>
+     *   Initialization: 0xffffffff <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xe3069283 <br>
+     *   XorOut: 0xffffffff <br>
+     *
+     * The input CRC is handled the same way as CFE_ES_CrcType_32_ISO_HDLC
+     */
+    CFE_ES_CrcType_32_ISCSI = 3,
+
     /**
      * Placeholder for end of normal enumeration list
      * This should reflect the number of algorithms defined.
      */
-    CFE_ES_CrcType_MAX = 2,
+    CFE_ES_CrcType_MAX = 4,
 
     /*
      * Backward compatibility values.
@@ -130,8 +165,8 @@ typedef enum CFE_ES_CrcType_Enum
     /**< CRC-8 historically defined but not implemented, value must not be 0 */
     CFE_ES_CrcType_CRC_8 = CFE_ES_CrcType_MAX + 1,
 
-    /**< CRC-32 historically defined but not implemented, value must not be 0 */
-    CFE_ES_CrcType_CRC_32 = CFE_ES_CrcType_MAX + 2,
+    /** CRC-32 historically defined but not implemented, now implies CRC-32/ISO-HDLC */
+    CFE_ES_CrcType_CRC_32 = CFE_ES_CrcType_32_ISO_HDLC,
 
 } CFE_ES_CrcType_Enum_t;
 
@@ -701,6 +701,199 @@ CFE_Status_t CFE_MSG_GetTypeFromMsgId(CFE_SB_MsgId_t MsgId, CFE_MSG_Type_t *Type
 
 /**\}*/
 
+/** \defgroup CFEAPIMSGHeaderView cFE Message Header View APIs
+ * \{
+ */
+
+/*****************************************************************************/
+/**
+ * \brief Decodes all header fields of a message in one pass
+ *
+ * \par Description
+ *          This routine decodes every field of the message header into a
+ *          #CFE_MSG_HeaderView_t, so code that needs several fields of the same
+ *          message does not have to validate the message and extract each field
+ *          with a separate call.  The fields are then read with the
+ *          CFE_MSG_HeaderView accessors.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          - The view is a copy, it is not updated if the message changes
+ *          - The function code is only present in command messages with a
+ *            secondary header, and the time only in telemetry messages with a
+ *            secondary header.  When not present they are zero, the same
+ *            values #CFE_MSG_GetFcnCode and #CFE_MSG_GetMsgTime would return.
+ *
+ * \param[in]  MsgPtr      A pointer to the buffer that contains the message @nonnull.
+ * \param[out] View        Decoded header fields @nonnull
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS            \copybrief CFE_SUCCESS
+ * \retval #CFE_MSG_BAD_ARGUMENT   \copybrief CFE_MSG_BAD_ARGUMENT
+ */
+CFE_Status_t CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderView_t *View);
+
+/*****************************************************************************/
+/**
+ * \brief Gets the message id from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The message id
+ */
+static inline CFE_SB_MsgId_t CFE_MSG_HeaderView_GetMsgId(const CFE_MSG_HeaderView_t *View)
+{
+    return View->MsgId;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the total message size from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The total message size
+ */
+static inline CFE_MSG_Size_t CFE_MSG_HeaderView_GetSize(const CFE_MSG_HeaderView_t *View)
+{
+    return View->Size;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the message type from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The message type
+ */
+static inline CFE_MSG_Type_t CFE_MSG_HeaderView_GetType(const CFE_MSG_HeaderView_t *View)
+{
+    return View->Type;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the message header version from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The message header version
+ */
+static inline CFE_MSG_HeaderVersion_t CFE_MSG_HeaderView_GetHeaderVersion(const CFE_MSG_HeaderView_t *View)
+{
+    return View->HeaderVersion;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the secondary header presence flag from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The secondary header presence flag
+ */
+static inline bool CFE_MSG_HeaderView_GetHasSecondaryHeader(const CFE_MSG_HeaderView_t *View)
+{
+    return View->HasSecondaryHeader;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the application ID from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The application ID
+ */
+static inline CFE_MSG_ApId_t CFE_MSG_HeaderView_GetApId(const CFE_MSG_HeaderView_t *View)
+{
+    return View->ApId;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the segmentation flag from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The segmentation flag
+ */
+static inline CFE_MSG_SegmentationFlag_t CFE_MSG_HeaderView_GetSegmentationFlag(const CFE_MSG_HeaderView_t *View)
+{
+    return View->SegmentationFlag;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the sequence count from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The sequence count
+ */
+static inline CFE_MSG_SequenceCount_t CFE_MSG_HeaderView_GetSequenceCount(const CFE_MSG_HeaderView_t *View)
+{
+    return View->SequenceCount;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the function code from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The function code, zero if the message does not have one
+ */
+static inline CFE_MSG_FcnCode_t CFE_MSG_HeaderView_GetFcnCode(const CFE_MSG_HeaderView_t *View)
+{
+    return View->FcnCode;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Identifies whether a decoded message header has a function code
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return Function code presence indicator
+ * \retval true  Message has a function code field
+ * \retval false Message does not have a function code field
+ */
+static inline bool CFE_MSG_HeaderView_HasFcnCode(const CFE_MSG_HeaderView_t *View)
+{
+    return View->HasFcnCode;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Gets the time from a decoded message header
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return The message time, zero if the message does not have one
+ */
+static inline CFE_TIME_SysTime_t CFE_MSG_HeaderView_GetMsgTime(const CFE_MSG_HeaderView_t *View)
+{
+    return View->MsgTime;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Identifies whether a decoded message header has a time
+ *
+ * \param[in] View Decoded header from #CFE_MSG_DecodeHeader @nonnull
+ *
+ * \return Time presence indicator
+ * \retval true  Message has a time field
+ * \retval false Message does not have a time field
+ */
+static inline bool CFE_MSG_HeaderView_HasMsgTime(const CFE_MSG_HeaderView_t *View)
+{
+    return View->HasMsgTime;
+}
+
+/**\}*/
+
 /** \defgroup CFEAPIMSGMsgIntegrity cFE Message Integrity APIs
  * \{
  */
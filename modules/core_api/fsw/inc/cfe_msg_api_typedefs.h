@@ -31,6 +31,8 @@
  */
 #include "common_types.h"
 #include "cfe_error.h"
+#include "cfe_sb_extern_typedefs.h"
+#include "cfe_time_extern_typedefs.h"
 
 /*
  * Defines
@@ -111,4 +113,27 @@ typedef struct CFE_MSG_CommandHeader CFE_MSG_CommandHeader_t;
  */
 typedef struct CFE_MSG_TelemetryHeader CFE_MSG_TelemetryHeader_t;
 
+/**
+ * \brief Decoded message header
+ *
+ * All header fields of a message, as decoded by CFE_MSG_DecodeHeader() in a
+ * single pass.  Use the CFE_MSG_HeaderView accessors rather than the members
+ * directly.  Fields that do not exist in the message are zero.
+ */
+typedef struct CFE_MSG_HeaderView
+{
+    CFE_SB_MsgId_t             MsgId;              /**< \brief Message ID */
+    CFE_MSG_Size_t             Size;               /**< \brief Total message size */
+    CFE_MSG_Type_t             Type;               /**< \brief Message type */
+    CFE_MSG_HeaderVersion_t    HeaderVersion;      /**< \brief Header version */
+    bool                       HasSecondaryHeader; /**< \brief Secondary header present */
+    CFE_MSG_ApId_t             ApId;               /**< \brief Application ID */
+    CFE_MSG_SegmentationFlag_t SegmentationFlag;   /**< \brief Segmentation flag */
+    CFE_MSG_SequenceCount_t    SequenceCount;      /**< \brief Sequence count */
+    bool                       HasFcnCode;         /**< \brief Function code field present (command) */
+    CFE_MSG_FcnCode_t          FcnCode;            /**< \brief Function code */
+    bool                       HasMsgTime;         /**< \brief Time field present (telemetry) */
+    CFE_TIME_SysTime_t         MsgTime;            /**< \brief Message time */
+} CFE_MSG_HeaderView_t;
+
 #endif /* CFE_MSG_API_TYPEDEFS_H */
@@ -220,6 +220,86 @@ CFE_Status_t CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_P
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_IGNOREMINE
 **/
 CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
+
+/*****************************************************************************/
+/**
+** \brief Set a readiness notification handler on a pipe.
+**
+** \par Description
+**          This routine lets an application wait on a pipe with its own OS
+**          facilities instead of blocking in #CFE_SB_ReceiveBuffer, for example
+**          to service a pipe and a set of sockets from a single task.  The handler
+**          is called when a message arrives on the pipe after the application
+**          has found the pipe empty, so the application should always read from
+**          the pipe with #CFE_SB_POLL until #CFE_SB_NO_MESSAGE is returned before
+**          waiting again.  The handler is also called right away if the pipe
+**          is not empty when it is set.
+**
+** \par Assumptions, External Events, and Notes:
+**          The handler runs in the sender's task context: it is called from within
+**          the transmit call (such as #CFE_SB_TransmitMsg) of whichever task sent the
+**          message, with that task's priority and stack, after the message has been
+**          written to the pipe.  It is not called if the write failed.  So it must be
+**          short and must not block or call any SB API.  On a POSIX
+**          system it would typically write to an eventfd or pipe that the application
+**          includes in its poll/epoll set.  Only the owner of the pipe can set the
+**          handler.  The handler is removed by passing NULL, or when the pipe is deleted.
+**
+** \param[in]  PipeId       The pipe ID of the pipe to set the handler on.
+**
+** \param[in]  Handler      The function to call when the pipe becomes ready, or NULL to remove it.
+**
+** \param[in]  Arg          Argument passed to the handler.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_ReceiveBuffer
+**/
+CFE_Status_t CFE_SB_SetPipeReadyHandler(CFE_SB_PipeId_t PipeId, CFE_SB_PipeReadyHandler_t Handler, void *Arg);
+
+/*****************************************************************************/
+/**
+** \brief Set a transport function on a pipe.
+**
+** \par Description
+**          This routine makes a pipe a remote destination: messages sent to the
+**          pipe are passed to the transport function when they are sent, instead
+**          of being written to the pipe queue.  This allows a library or app to
+**          bridge messages to another cFE instance (for example, through a shared
+**          memory ring to another process on the same host) with one copy and
+**          without a task that receives from the pipe.  Which messages are bridged
+**          is controlled by the usual subscriptions on the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**          SB only provides the hook.  The transport itself, such as a shared
+**          memory segment, the rings in it and the wakeup of the receiving
+**          process, is not part of cFE and must be implemented by the library
+**          or app that sets the transport function, as OSAL provides no shared
+**          memory or futex abstraction.
+**          The transport function is called in the context of the task that sent
+**          the message, so it must be short and must not block or call any SB API.
+**          If the bridge also sends the messages it gets from the other instance
+**          on this bus, it should do that from the app that owns the pipe and set
+**          #CFE_SB_PIPEOPTS_IGNOREMINE on the pipe, so they are not sent back.
+**          Only the owner of the pipe can set the transport function.  It is
+**          removed by passing NULL, or when the pipe is deleted.  Messages that
+**          were queued before the transport function was set can still be received.
+**
+** \param[in]  PipeId       The pipe ID of the pipe to set the transport function on.
+**
+** \param[in]  TransportFunc The function that takes the messages, or NULL to use the pipe queue again.
+**
+** \param[in]  Arg          Argument passed to the transport function.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_SetPipeOpts #CFE_SB_Subscribe
+**/
+CFE_Status_t CFE_SB_SetPipeTransport(CFE_SB_PipeId_t PipeId, CFE_SB_PipeTransportFunc_t TransportFunc, void *Arg);
 /**@}*/
 
 /** @defgroup CFEAPISBSubscription cFE Message Subscription Control APIs
@@ -243,6 +323,13 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **          shortest possible time, the developer may consider holding off its
 **          subscription until other applications have subscribed to the message.
 **
+**          The QoS priority selects the lane of the pipe the messages are written
+**          to.  The first #CFE_SB_QosPriority_HIGH subscription to a pipe adds a
+**          high priority lane to it, of the same depth as the pipe.  Receiving from
+**          the pipe always returns a message from the high priority lane first, so
+**          these messages do not wait behind a backlog of normal priority messages.
+**          If the lane can not be created, the messages use the normal lane.
+**
 ** \param[in]  MsgId        The message ID of the message to be subscribed to.
 **
 ** \param[in]  PipeId       The pipe ID of the pipe the subscribed message
@@ -250,7 +337,7 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **
 ** \param[in]  Quality      The requested Quality of Service (QoS) required of
 **                          the messages. Most callers will use #CFE_SB_DEFAULT_QOS
-**                          for this parameter.
+**                          for this parameter, which is normal priority.
 **
 ** \param[in]  MsgLim       The maximum number of messages with this Message ID to
 **                          allow in this pipe at the same time.
@@ -386,6 +473,107 @@ CFE_Status_t CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
 ** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_SubscribeLocal, #CFE_SB_Unsubscribe
 **/
 CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Subscribe to all message IDs matching a value and mask
+**
+** \par Description
+**          This routine adds the specified pipe to the destination list of
+**          every message ID for which (ID & Mask) == (MsgId & Mask).  A range
+**          of message IDs aligned to a power of two can be subscribed to in a
+**          single call, for example all IDs from 0x1800 to 0x183F with
+**          MsgId 0x1800 and Mask 0xFFC0.
+**
+** \par Assumptions, External Events, and Notes:
+**          Matching message IDs are added to the routing table as they are first
+**          sent or subscribed to, so they use up routing table entries in the same
+**          way as explicit subscriptions.  The destinations are local to this CPU
+**          and are not reported, see #CFE_SB_SubscribeLocal.  An explicit
+**          subscription to a matching message ID on the same pipe replaces the
+**          destination added by this routine, and is not affected by
+**          #CFE_SB_UnsubscribeMask.  Only #CFE_PLATFORM_SB_MAX_MASK_SUBS mask
+**          subscriptions may exist at the same time across all pipes, and a mask
+**          that matches more than #CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS valid
+**          message IDs is rejected.
+**
+** \param[in]  MsgId        The message ID value to match, only the bits set in Mask are used.
+**
+** \param[in]  Mask         The bits of the message ID to compare.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the matching messages
+**                          should be sent to.
+**
+** \param[in]  Quality      The requested Quality of Service (QoS) required of
+**                          the messages, as for #CFE_SB_SubscribeEx.
+**
+** \param[in]  MsgLim       The maximum number of messages with each matching
+**                          Message ID to allow in this pipe at the same time.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_UnsubscribeMask, #CFE_SB_SubscribeEx
+**/
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  CFE_SB_Qos_t Quality, uint16 MsgLim);
+
+/*****************************************************************************/
+/**
+** \brief Remove a subscription added by #CFE_SB_SubscribeMask
+**
+** \par Description
+**          This routine removes the specified pipe from the destination list of
+**          all message IDs it was added to by the matching call to #CFE_SB_SubscribeMask,
+**          unless another mask subscription of the pipe still matches.
+**
+** \par Assumptions, External Events, and Notes:
+**          MsgId and Mask must be the same as given to #CFE_SB_SubscribeMask.
+**          If there is no such mask subscription, the CFE_SB_UNSUB_NO_SUBS_EID
+**          event will be generated and #CFE_SUCCESS will be returned.
+**
+** \param[in]  MsgId        The message ID value given when subscribing.
+**
+** \param[in]  Mask         The mask given when subscribing.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the matching messages
+**                          should no longer be sent to.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_SubscribeMask, #CFE_SB_Unsubscribe
+**/
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Check if a message currently has any subscribers
+**
+** \par Description
+**          This routine checks whether any pipe is currently subscribed to the
+**          specified message ID (with the route enabled), meaning a message sent
+**          with this ID would be delivered somewhere.
+**
+** \par Assumptions, External Events, and Notes:
+**          This is intended to allow an application to skip assembling a message
+**          that is expensive to produce when nobody is listening for it.  As
+**          subscriptions may change at any time, the result is only a hint, and
+**          it is always valid to send a message regardless of the result.
+**          For most message IDs without subscribers this does not take the SB
+**          shared data lock.
+**
+** \param[in]  MsgId        The message ID to check.
+**
+** \return true if the message ID has at least one active subscriber, false otherwise
+**          (including if the message ID is invalid)
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_TransmitMsg
+**/
+bool CFE_SB_HasSubscribers(CFE_SB_MsgId_t MsgId);
 /**@}*/
 
 /** @defgroup CFEAPISBMessage cFE Send/Receive Message APIs
@@ -446,6 +634,9 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 **          If the pipe is empty, this routine will block until either a new
 **          message comes in or the timeout value is reached.
 **
+**          If the pipe has a high priority lane (see #CFE_SB_SubscribeEx), any
+**          message in that lane is returned before the messages in the normal lane.
+**
 ** \par Assumptions, External Events, and Notes:
 **          Note - If an error occurs in this API, the *BufPtr value may be NULL or
 **          random. Therefore, it is recommended that the return code be tested
@@ -478,6 +669,102 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
 
+/*****************************************************************************/
+/**
+** \brief Receive a set of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to MaxBuffers messages from the specified pipe.
+**          If the pipe is empty, this routine will block until either a new
+**          message comes in or the timeout value is reached.  Once the first
+**          message has been received, any further messages that are already in
+**          the pipe are returned in the same call, without waiting for more.
+**
+**          This is intended for applications that drain a pipe on every wakeup,
+**          as the overhead of releasing the previously received buffers and
+**          retaining the newly received buffers is incurred once per call rather
+**          than once per message.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The buffers are returned in the order they were written to the pipe,
+**             except that all buffers from the high priority lane of the pipe (if any)
+**             are returned before those from the normal lane.
+**          -# All returned buffers are valid only until the next call to
+**             #CFE_SB_ReceiveBuffer or #CFE_SB_ReceiveBufferMulti for the same pipe.
+**          -# At most #CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE buffers are returned per call,
+**             regardless of MaxBuffers.
+**          -# If this returns an error, *NumReceived will be 0 and the content of
+**             BufPtrs is undefined.
+**
+** \param[out] BufPtrs       Array to store pointers to the received buffers @nonnull.
+**                           These should be used as read-only pointers, same as
+**                           with #CFE_SB_ReceiveBuffer.
+** \param[in]  MaxBuffers    The number of entries in BufPtrs, must be nonzero.
+** \param[out] NumReceived   Buffer to store the number of entries written to BufPtrs @nonnull.
+** \param[in]  PipeId        The pipe ID of the pipe containing the messages to be obtained.
+** \param[in]  TimeOut       The number of milliseconds to wait for a new message if the
+**                           pipe is empty at the time of the call.  This can also be set
+**                           to #CFE_SB_POLL for a non-blocking receive or
+**                           #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBufferMulti(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxBuffers, uint32 *NumReceived,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a message from any of a set of software bus pipes
+**
+** \par Description
+**          This routine retrieves the next message from the first pipe in the set
+**          that is not empty.  If all pipes are empty, this routine will block until
+**          either a new message comes in on any of the pipes or the timeout value
+**          is reached.
+**
+**          This allows a single task to service several pipes, without polling
+**          each of them in turn.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The pipes are checked in the order given, so a message on an earlier
+**             pipe in the set is returned before a message on a later pipe.  The high
+**             priority lane of each pipe (if any) is checked before its normal lane.
+**          -# Calling this routine releases the buffers returned by the previous
+**             receive call on every pipe in the set.  The *BufPtr value is valid
+**             only until the next receive call for the pipe given in *PipeIdPtr.
+**          -# A limited number of tasks (32) can wait on a set of pipes at the same
+**             time.  #CFE_STATUS_EXTERNAL_RESOURCE_FAIL is returned if this limit
+**             is exceeded, except when polling.
+**          -# If an error occurs in this API, the *BufPtr value may be NULL or
+**             random.
+**
+** \param[in, out] BufPtr   A pointer to the software bus buffer to receive to @nonnull.
+**                          Same as with #CFE_SB_ReceiveBuffer.
+** \param[out] PipeIdPtr    Buffer to store the pipe ID the message was received from @nonnull.
+** \param[in]  PipeIds      The pipe IDs of the pipes to receive from @nonnull.
+** \param[in]  NumPipes     The number of entries in PipeIds, must be nonzero and no more
+**                          than #CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES.
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if all
+**                          pipes are empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT               \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT                   \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR                \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE                 \copybrief CFE_SB_NO_MESSAGE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**/
+CFE_Status_t CFE_SB_ReceiveBufferAny(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t *PipeIdPtr,
+                                     const CFE_SB_PipeId_t PipeIds[], uint32 NumPipes, int32 TimeOut);
+
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -590,6 +877,186 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a set of buffers
+**
+** \par Description
+**          This routine sends a set of messages that have been created directly in
+**          internal SB message buffers, with the same semantics as calling
+**          #CFE_SB_TransmitBuffer on each buffer in turn.  The difference is that the
+**          routing of the buffers is done under a single acquisition of the software
+**          bus lock, and writes to the same destination pipe are grouped together,
+**          reducing the per-message overhead for high-rate senders.
+**
+**          Messages that are delivered to the same pipe are received in the same
+**          relative order as they appear in BufPtrs.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The outcome of each buffer is reported individually in StatusArray.  Each
+**             entry has the same meaning as the return value of #CFE_SB_TransmitBuffer
+**             for that buffer, including ownership of the buffer: buffers with a
+**             successful status are consumed, buffers with an error status are still
+**             owned by the calling application.
+**          -# A given buffer may only appear once in BufPtrs.  Subsequent instances are
+**             not sent and are reported as #CFE_SB_BUFFER_INVALID.
+**          -# The IsOrigination parameter applies to all buffers in the set.
+**          -# Sets larger than #CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE are processed in
+**             multiple chunks.
+**          -# The routing state for a chunk is taken from the SB memory pool.  If the pool
+**             is exhausted, the buffers are still sent, but one at a time.
+**
+** \param[in]  BufPtrs        Array of pointers to the buffers to be sent @nonnull.
+** \param[out] StatusArray    Array to store the status of each buffer @nonnull.
+** \param[in]  NumBuffers     Number of entries in BufPtrs and StatusArray.
+** \param[in]  IsOrigination  Update applicable header field(s) of newly constructed messages
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         All buffers were sent successfully
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+**
+** If any buffer fails, the status of the first failing buffer is returned.
+**/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const BufPtrs[], CFE_Status_t StatusArray[], uint32 NumBuffers,
+                                        bool IsOrigination);
+
+/*****************************************************************************/
+/**
+** \brief Transmit a buffer followed by segments of application memory
+**
+** \par Description
+**          This routine sends a message made of the content of an internal SB message
+**          buffer followed by a list of segments, which are sent without being copied.
+**          This allows a large payload (such as an image) to be sent from where it was
+**          produced, with only the header and any other leading content built in the
+**          buffer.  The message size in the header is the total size of the message,
+**          and the part of the message in the buffer is what is left after the segments.
+**
+**          Pipes created with the #CFE_SB_PIPEOPTS_SEGMENTS option receive the buffer
+**          as it was sent, and use #CFE_SB_GetSegment to get to the rest of the message.
+**          All other pipes, and pipes with a transport, receive a contiguous copy of
+**          the whole message, which is only made if any such pipe is subscribed.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only telemetry messages can be sent in segments, as the checksum of a command
+**             covers the whole message.
+**          -# If this function returns #CFE_SB_BAD_ARGUMENT, #CFE_SB_MSG_TOO_BIG or
+**             #CFE_SB_BUFFER_INVALID, neither the buffer nor the segments are taken, and
+**             the release function is not called.  Otherwise, the buffer is consumed as by
+**             #CFE_SB_TransmitBuffer, and the segments must not be changed until the release
+**             function of the list is called.  This happens once, when no pipe holds the
+**             message anymore, which may be before this function returns.
+**          -# The release function is called after the software bus internals are unlocked,
+**             in the context of the task that released the message last, so it should be short.
+**          -# The total size of the message is still limited to #CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+**
+** \param[in] BufPtr         A pointer to the buffer to be sent @nonnull.
+** \param[in] SegListPtr     A pointer to the list of segments following the buffer content @nonnull.
+** \param[in] IsOrigination  Update applicable header field(s) of a newly constructed message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG    \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_TransmitBuffer, #CFE_SB_GetSegment
+**/
+CFE_Status_t CFE_SB_TransmitSegments(CFE_SB_Buffer_t *BufPtr, const CFE_SB_SegmentList_t *SegListPtr,
+                                     bool IsOrigination);
+
+/*****************************************************************************/
+/**
+** \brief Get a part of a received message that was sent in segments
+**
+** \par Description
+**          This routine gets the location and size of one part of a message received
+**          on a pipe created with the #CFE_SB_PIPEOPTS_SEGMENTS option.  Index 0 is the
+**          part of the message in the received buffer itself, which starts with the
+**          header.  Index 1 and up are the segments that follow it, in order.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The buffer must have been received from the software bus, otherwise
+**             #CFE_SB_BUFFER_INVALID is returned.  A message that was not sent in
+**             segments has only index 0, which is the whole message.
+**          -# The segments are valid for as long as the received buffer is.
+**
+** \param[in]  BufPtr   A pointer to the received buffer @nonnull.
+** \param[in]  Index    Index of the part to get.
+** \param[out] DataPtr  Buffer to store the location of the part @nonnull.
+** \param[out] SizePtr  Buffer to store the size of the part @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**
+** \sa #CFE_SB_TransmitSegments
+**/
+CFE_Status_t CFE_SB_GetSegment(const CFE_SB_Buffer_t *BufPtr, uint32 Index, const void **DataPtr, size_t *SizePtr);
+
+/*****************************************************************************/
+/**
+** \brief Resolve the route of a message ID in advance
+**
+** \par Description
+**          This routine looks up the route of a message ID and stores it in a route
+**          handle, for use with #CFE_SB_TransmitBufferToRoute.  A message ID without
+**          any subscribers is also resolved, to a route without destinations.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The handle is marked with the generation of the subscriptions when it was
+**             resolved.  It becomes stale when a subscription change affects the routes,
+**             and is then resolved again when it is next used.  There is no need to call
+**             this function again after such a change.
+**          -# A handle is updated when it is used, so it must not be used by more than
+**             one task at the same time.
+**
+** \param[in]  MsgId      The message ID to resolve.
+** \param[out] HandlePtr  Buffer to store the route handle @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_TransmitBufferToRoute
+**/
+CFE_Status_t CFE_SB_GetRouteHandle(CFE_SB_MsgId_t MsgId, CFE_SB_RouteHandle_t *HandlePtr);
+
+/*****************************************************************************/
+/**
+** \brief Transmit a buffer using a pre-resolved route
+**
+** \par Description
+**          This routine is the same as #CFE_SB_TransmitBuffer, except that the route of
+**          the message is taken from a route handle if it is still current, avoiding the
+**          lookup of the message ID.  This is intended for applications that send the
+**          same message ID at a high rate.
+**
+**          If the handle is stale, or was resolved for a different message ID than the one
+**          in the message, the message ID is looked up as usual and the handle is updated.
+**          The message is always routed according to the message ID in its header.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The handle may be cleared to all zeros instead of being resolved by
+**             #CFE_SB_GetRouteHandle, in which case it is resolved on first use.
+**          -# A handle is updated when it is used, so it must not be used by more than
+**             one task at the same time.
+**
+** \param[in]    BufPtr         A pointer to the buffer to be sent @nonnull.
+** \param[inout] HandlePtr      A pointer to the route handle @nonnull.
+** \param[in]    IsOrigination  Update applicable header field(s) of a newly constructed message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+**
+** \sa #CFE_SB_TransmitBuffer, #CFE_SB_GetRouteHandle
+**/
+CFE_Status_t CFE_SB_TransmitBufferToRoute(CFE_SB_Buffer_t *BufPtr, CFE_SB_RouteHandle_t *HandlePtr, bool IsOrigination);
+
 /** @} */
 
 /** @defgroup CFEAPISBMessageCharacteristics cFE Message Characteristics APIs
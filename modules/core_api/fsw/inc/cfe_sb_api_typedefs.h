@@ -127,6 +127,8 @@
  */
 #define CFE_SB_PIPEOPTS_IGNOREMINE \
     0x00000001 /**< \brief Messages sent by the app that owns this pipe will not be sent to this pipe. */
+#define CFE_SB_PIPEOPTS_SEGMENTS \
+    0x00000002 /**< \brief Messages sent in segments are received as such, see #CFE_SB_GetSegment. */
 /**@}*/
 
 #define CFE_SB_DEFAULT_QOS ((CFE_SB_Qos_t) { 0 }) /**< \brief Default Qos macro */
@@ -143,4 +145,85 @@ typedef union CFE_SB_Msg
     long double       LongDouble; /**< \brief Align to support Long Double */
 } CFE_SB_Buffer_t;
 
+/**
+ * \brief Pipe readiness notification function
+ *
+ * Called when a pipe that was observed to be empty has a message again,
+ * see CFE_SB_SetPipeReadyHandler().  This runs in the context of the task
+ * that sent the message, so it must not block or call any SB API.
+ *
+ * \param[in] PipeId The pipe that has a message
+ * \param[in] Arg    The argument that was given with the handler
+ */
+typedef void (*CFE_SB_PipeReadyHandler_t)(CFE_SB_PipeId_t PipeId, void *Arg);
+
+/**
+ * \brief Pipe transport function
+ *
+ * Takes a message that was sent to a pipe, instead of the pipe queue, see
+ * CFE_SB_SetPipeTransport().  This runs in the context of the task that sent
+ * the message, so it must not block or call any SB API.  The message must be
+ * copied before returning, the buffer is not valid after the call.
+ *
+ * \param[in] PipeId  The pipe the message was sent to
+ * \param[in] BufPtr  The message
+ * \param[in] MsgSize Size of the message
+ * \param[in] Arg     The argument that was given with the transport function
+ *
+ * \return CFE_SUCCESS if the message was taken, any other status is counted as a pipe write error
+ */
+typedef CFE_Status_t (*CFE_SB_PipeTransportFunc_t)(CFE_SB_PipeId_t PipeId, const CFE_SB_Buffer_t *BufPtr,
+                                                   size_t MsgSize, void *Arg);
+
+/**
+ * \brief Externally owned part of a message sent with CFE_SB_TransmitSegments()
+ */
+typedef struct CFE_SB_Segment
+{
+    const void *DataPtr; /**< \brief Start of the segment */
+    size_t      Size;    /**< \brief Size of the segment in bytes */
+} CFE_SB_Segment_t;
+
+struct CFE_SB_SegmentList;
+
+/**
+ * \brief Segment release function
+ *
+ * Called once a message sent with CFE_SB_TransmitSegments() is no longer held
+ * by any pipe, so the segments and the list can be reused.  This runs in the
+ * context of whichever task released the message last, once that task has
+ * unlocked the SB internals, and should return quickly.
+ *
+ * \param[in] SegListPtr The segment list that was given with the message
+ */
+typedef void (*CFE_SB_SegmentReleaseFunc_t)(const struct CFE_SB_SegmentList *SegListPtr);
+
+/**
+ * \brief Payload segments of a message sent with CFE_SB_TransmitSegments()
+ *
+ * The list, the segment array and the data are owned by the sender, and must
+ * not change until the release function is called.
+ */
+typedef struct CFE_SB_SegmentList
+{
+    const CFE_SB_Segment_t     *Segments;    /**< \brief Segments following the header, in order */
+    uint32                      NumSegments; /**< \brief Number of entries in Segments */
+    CFE_SB_SegmentReleaseFunc_t ReleaseFunc; /**< \brief Called when the segments are released, may be NULL */
+    void                       *ReleaseArg;  /**< \brief For use by the release function */
+} CFE_SB_SegmentList_t;
+
+/**
+ * \brief Pre-resolved route of a message ID, see CFE_SB_GetRouteHandle()
+ *
+ * The content is private to the software bus.  A handle is only used as long
+ * as no subscription has changed since it was resolved, otherwise the message
+ * ID is looked up again and the handle is updated.
+ */
+typedef struct CFE_SB_RouteHandle
+{
+    CFE_SB_MsgId_t        MsgId;        /**< \brief Message ID the route was resolved for */
+    uint32                Generation;   /**< \brief Subscription generation when it was resolved */
+    CFE_SB_RouteId_Atom_t RouteIdValue; /**< \brief Resolved route */
+} CFE_SB_RouteHandle_t;
+
 #endif /* CFE_SB_API_TYPEDEFS_H */
@@ -672,6 +672,30 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
     return UT_GenStub_GetReturnValue(CFE_ES_PoolCreate, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolCreateConcurrent()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolCreateConcurrent(CFE_ES_MemHandle_t *PoolID,
+                                         void               *MemPtr,
+                                         size_t              Size,
+                                         uint16              NumBlockSizes,
+                                         const size_t       *BlockSizes)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateConcurrent, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolCreateConcurrent, CFE_ES_MemHandle_t *, PoolID);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateConcurrent, void *, MemPtr);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateConcurrent, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateConcurrent, uint16, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateConcurrent, const size_t *, BlockSizes);
+
+    UT_GenStub_Execute(CFE_ES_PoolCreateConcurrent, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateConcurrent, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_PoolCreateEx()
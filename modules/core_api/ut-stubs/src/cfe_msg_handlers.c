@@ -30,6 +30,7 @@
 /*
 ** Includes
 */
+#include <string.h>
 #include "cfe.h"
 #include "utstubs.h"
 #include "uttools.h"
@@ -42,6 +43,34 @@
 #define UTASSERT_GETSTUB(Expression) \
     UtAssert_Type(TSF, Expression, "%s: Check for get value provided by test", __func__);
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_MSG_DecodeHeader coverage stub function
+ *
+ * Copies the view from the data buffer if one is provided, otherwise
+ * builds it from the data buffers of the CFE_MSG_GetMsgId, CFE_MSG_GetSize
+ * and CFE_MSG_GetFcnCode stubs, so tests that provide the individual
+ * fields work with code that decodes the whole header.
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_MSG_DecodeHeader(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_HeaderView_t *View = UT_Hook_GetArgValueByName(Context, "View", CFE_MSG_HeaderView_t *);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status >= 0 && UT_Stub_CopyToLocal(UT_KEY(CFE_MSG_DecodeHeader), View, sizeof(*View)) != sizeof(*View))
+    {
+        memset(View, 0, sizeof(*View));
+        UT_Stub_CopyToLocal(UT_KEY(CFE_MSG_GetMsgId), &View->MsgId, sizeof(View->MsgId));
+        UT_Stub_CopyToLocal(UT_KEY(CFE_MSG_GetSize), &View->Size, sizeof(View->Size));
+        View->HasFcnCode =
+            (UT_Stub_CopyToLocal(UT_KEY(CFE_MSG_GetFcnCode), &View->FcnCode, sizeof(View->FcnCode)) ==
+             sizeof(View->FcnCode));
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_MSG_GetApId coverage stub function
@@ -25,6 +25,7 @@
 #include "cfe_msg.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_MSG_DecodeHeader(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_MSG_GetApId(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_MSG_GetEDSVersion(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_MSG_GetEndian(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -46,6 +47,23 @@ void UT_DefaultHandler_CFE_MSG_OriginationAction(void *, UT_EntryKey_t, const UT
 void UT_DefaultHandler_CFE_MSG_ValidateChecksum(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_MSG_VerificationAction(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MSG_DecodeHeader()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderView_t *View)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MSG_DecodeHeader, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_MSG_DecodeHeader, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(CFE_MSG_DecodeHeader, CFE_MSG_HeaderView_t *, View);
+
+    UT_GenStub_Execute(CFE_MSG_DecodeHeader, Basic, UT_DefaultHandler_CFE_MSG_DecodeHeader);
+
+    return UT_GenStub_GetReturnValue(CFE_MSG_DecodeHeader, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_MSG_GenerateChecksum()
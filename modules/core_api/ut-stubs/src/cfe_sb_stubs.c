@@ -166,6 +166,42 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_GetPipeOpts, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetRouteHandle()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetRouteHandle(CFE_SB_MsgId_t MsgId, CFE_SB_RouteHandle_t *HandlePtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetRouteHandle, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetRouteHandle, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_GetRouteHandle, CFE_SB_RouteHandle_t *, HandlePtr);
+
+    UT_GenStub_Execute(CFE_SB_GetRouteHandle, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetRouteHandle, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetSegment()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetSegment(const CFE_SB_Buffer_t *BufPtr, uint32 Index, const void **DataPtr, size_t *SizePtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetSegment, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetSegment, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_GetSegment, uint32, Index);
+    UT_GenStub_AddParam(CFE_SB_GetSegment, const void **, DataPtr);
+    UT_GenStub_AddParam(CFE_SB_GetSegment, size_t *, SizePtr);
+
+    UT_GenStub_Execute(CFE_SB_GetSegment, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetSegment, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_GetUserData()
@@ -230,6 +266,22 @@ CFE_SB_MsgId_Atom_t CFE_SB_GlobalTlmTopicIdToMsgId(uint16 TopicId)
     return UT_GenStub_GetReturnValue(CFE_SB_GlobalTlmTopicIdToMsgId, CFE_SB_MsgId_Atom_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_HasSubscribers()
+ * ----------------------------------------------------
+ */
+bool CFE_SB_HasSubscribers(CFE_SB_MsgId_t MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_HasSubscribers, bool);
+
+    UT_GenStub_AddParam(CFE_SB_HasSubscribers, CFE_SB_MsgId_t, MsgId);
+
+    UT_GenStub_Execute(CFE_SB_HasSubscribers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_HasSubscribers, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_IsValidMsgId()
@@ -359,6 +411,46 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferAny()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferAny(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t *PipeIdPtr,
+                                     const CFE_SB_PipeId_t PipeIds[], uint32 NumPipes, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferAny, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferAny, CFE_SB_Buffer_t **, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferAny, CFE_SB_PipeId_t *, PipeIdPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferAny, uint32, NumPipes);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferAny, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferAny, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferAny, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferMulti()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferMulti(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxBuffers, uint32 *NumReceived,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferMulti, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferMulti, uint32, MaxBuffers);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferMulti, uint32 *, NumReceived);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferMulti, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferMulti, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferMulti, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -375,6 +467,42 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_ReleaseMessageBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SetPipeTransport()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SetPipeTransport(CFE_SB_PipeId_t PipeId, CFE_SB_PipeTransportFunc_t TransportFunc, void *Arg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SetPipeTransport, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SetPipeTransport, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SetPipeTransport, CFE_SB_PipeTransportFunc_t, TransportFunc);
+    UT_GenStub_AddParam(CFE_SB_SetPipeTransport, void *, Arg);
+
+    UT_GenStub_Execute(CFE_SB_SetPipeTransport, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SetPipeTransport, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SetPipeReadyHandler()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SetPipeReadyHandler(CFE_SB_PipeId_t PipeId, CFE_SB_PipeReadyHandler_t Handler, void *Arg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SetPipeReadyHandler, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SetPipeReadyHandler, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SetPipeReadyHandler, CFE_SB_PipeReadyHandler_t, Handler);
+    UT_GenStub_AddParam(CFE_SB_SetPipeReadyHandler, void *, Arg);
+
+    UT_GenStub_Execute(CFE_SB_SetPipeReadyHandler, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SetPipeReadyHandler, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_SetPipeOpts()
@@ -459,6 +587,27 @@ CFE_Status_t CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
     return UT_GenStub_GetReturnValue(CFE_SB_SubscribeLocal, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SubscribeMask()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  CFE_SB_Qos_t Quality, uint16 MsgLim)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SubscribeMask, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_MsgId_Atom_t, Mask);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_Qos_t, Quality);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, uint16, MsgLim);
+
+    UT_GenStub_Execute(CFE_SB_SubscribeMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SubscribeMask, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TimeStampMsg()
@@ -505,6 +654,42 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const BufPtrs[], CFE_Status_t StatusArray[], uint32 NumBuffers,
+                                        bool IsOrigination)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, uint32, NumBuffers);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, bool, IsOrigination);
+
+    UT_GenStub_Execute(CFE_SB_TransmitBufferBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitBufferToRoute()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitBufferToRoute(CFE_SB_Buffer_t *BufPtr, CFE_SB_RouteHandle_t *HandlePtr, bool IsOrigination)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitBufferToRoute, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferToRoute, CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferToRoute, CFE_SB_RouteHandle_t *, HandlePtr);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferToRoute, bool, IsOrigination);
+
+    UT_GenStub_Execute(CFE_SB_TransmitBufferToRoute, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitBufferToRoute, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TransmitMsg()
@@ -522,6 +707,25 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitSegments()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitSegments(CFE_SB_Buffer_t *BufPtr, const CFE_SB_SegmentList_t *SegListPtr,
+                                     bool IsOrigination)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitSegments, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitSegments, CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_TransmitSegments, const CFE_SB_SegmentList_t *, SegListPtr);
+    UT_GenStub_AddParam(CFE_SB_TransmitSegments, bool, IsOrigination);
+
+    UT_GenStub_Execute(CFE_SB_TransmitSegments, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitSegments, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
@@ -555,3 +759,21 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 
     return UT_GenStub_GetReturnValue(CFE_SB_UnsubscribeLocal, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_UnsubscribeMask()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_UnsubscribeMask, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_MsgId_Atom_t, Mask);
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_PipeId_t, PipeId);
+
+    UT_GenStub_Execute(CFE_SB_UnsubscribeMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_UnsubscribeMask, CFE_Status_t);
+}
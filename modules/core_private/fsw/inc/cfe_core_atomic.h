@@ -0,0 +1,198 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:
+ *      Memory ordering primitives shared by the CFE core applications
+ *
+ * Design Notes:
+ *      cFE targets C99, and OSAL does not provide any atomic operations.
+ *      This is the only place in the core where compiler support for them
+ *      is detected, so all core modules follow the same policy:
+ *
+ *      - With C11 atomics, <stdatomic.h> is used.
+ *      - Otherwise with GCC compatible compilers (including C99 builds),
+ *        the __sync builtins are used.
+ *      - Otherwise #CFE_CORE_ATOMICS_AVAILABLE is false, and the fences
+ *        do nothing.  Code using this header must then fall back to an
+ *        OSAL mutex, and must not rely on the fences for correctness.
+ *        The operations below are still defined so that such code builds,
+ *        but they are plain accesses that are only safe from a single task.
+ *
+ *      All operations are sequentially consistent.  Objects of the atomic
+ *      types must only be accessed through these operations, except when
+ *      they are not yet visible to any other task.
+ */
+
+#ifndef CFE_CORE_ATOMIC_H
+#define CFE_CORE_ATOMIC_H
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+/** \brief True if the primitives in this header are implemented for the target */
+#define CFE_CORE_ATOMICS_AVAILABLE true
+
+/** \brief Loads before the fence are not reordered with accesses after it */
+#define CFE_CORE_ACQUIRE_FENCE() atomic_thread_fence(memory_order_acquire)
+
+/** \brief Stores after the fence are not reordered with accesses before it */
+#define CFE_CORE_RELEASE_FENCE() atomic_thread_fence(memory_order_release)
+
+/** \brief 32 bit value that is accessed atomically */
+typedef _Atomic uint32 CFE_CORE_AtomicU32_t;
+
+/** \brief 64 bit value that is accessed atomically */
+typedef _Atomic uint64 CFE_CORE_AtomicU64_t;
+
+/** \brief Reads the value of an atomic 32 bit object */
+static inline uint32 CFE_CORE_AtomicLoadU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    return atomic_load(Ptr);
+}
+
+/** \brief Adds one to an atomic 32 bit object */
+static inline void CFE_CORE_AtomicIncrementU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    atomic_fetch_add(Ptr, 1);
+}
+
+/** \brief Reads the value of an atomic 64 bit object */
+static inline uint64 CFE_CORE_AtomicLoadU64(CFE_CORE_AtomicU64_t *Ptr)
+{
+    return atomic_load(Ptr);
+}
+
+/** \brief Sets the value of an atomic 64 bit object */
+static inline void CFE_CORE_AtomicStoreU64(CFE_CORE_AtomicU64_t *Ptr, uint64 Value)
+{
+    atomic_store(Ptr, Value);
+}
+
+/**
+ * \brief Sets an atomic 64 bit object to Desired if it is equal to *ExpectedPtr
+ *
+ * \returns true if the object was set, otherwise false and *ExpectedPtr is set to the value of the object
+ */
+static inline bool CFE_CORE_AtomicCompareSwapU64(CFE_CORE_AtomicU64_t *Ptr, uint64 *ExpectedPtr, uint64 Desired)
+{
+    return atomic_compare_exchange_strong(Ptr, ExpectedPtr, Desired);
+}
+
+#elif defined(__GNUC__)
+
+#define CFE_CORE_ATOMICS_AVAILABLE true
+#define CFE_CORE_ACQUIRE_FENCE()   __sync_synchronize()
+#define CFE_CORE_RELEASE_FENCE()   __sync_synchronize()
+
+typedef volatile uint32 CFE_CORE_AtomicU32_t;
+typedef volatile uint64 CFE_CORE_AtomicU64_t;
+
+static inline uint32 CFE_CORE_AtomicLoadU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    return __sync_fetch_and_add(Ptr, 0);
+}
+
+static inline void CFE_CORE_AtomicIncrementU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    __sync_fetch_and_add(Ptr, 1);
+}
+
+static inline uint64 CFE_CORE_AtomicLoadU64(CFE_CORE_AtomicU64_t *Ptr)
+{
+    /* A plain load of a 64 bit value is not atomic on 32 bit targets */
+    return __sync_fetch_and_add(Ptr, 0);
+}
+
+static inline void CFE_CORE_AtomicStoreU64(CFE_CORE_AtomicU64_t *Ptr, uint64 Value)
+{
+    uint64 Prev;
+
+    Prev = CFE_CORE_AtomicLoadU64(Ptr);
+    while (!__sync_bool_compare_and_swap(Ptr, Prev, Value))
+    {
+        Prev = *Ptr;
+    }
+}
+
+static inline bool CFE_CORE_AtomicCompareSwapU64(CFE_CORE_AtomicU64_t *Ptr, uint64 *ExpectedPtr, uint64 Desired)
+{
+    uint64 Prev;
+
+    Prev = __sync_val_compare_and_swap(Ptr, *ExpectedPtr, Desired);
+    if (Prev != *ExpectedPtr)
+    {
+        *ExpectedPtr = Prev;
+        return false;
+    }
+
+    return true;
+}
+
+#else
+
+#define CFE_CORE_ATOMICS_AVAILABLE false
+#define CFE_CORE_ACQUIRE_FENCE()
+#define CFE_CORE_RELEASE_FENCE()
+
+typedef volatile uint32 CFE_CORE_AtomicU32_t;
+typedef volatile uint64 CFE_CORE_AtomicU64_t;
+
+static inline uint32 CFE_CORE_AtomicLoadU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    return *Ptr;
+}
+
+static inline void CFE_CORE_AtomicIncrementU32(CFE_CORE_AtomicU32_t *Ptr)
+{
+    ++(*Ptr);
+}
+
+static inline uint64 CFE_CORE_AtomicLoadU64(CFE_CORE_AtomicU64_t *Ptr)
+{
+    return *Ptr;
+}
+
+static inline void CFE_CORE_AtomicStoreU64(CFE_CORE_AtomicU64_t *Ptr, uint64 Value)
+{
+    *Ptr = Value;
+}
+
+static inline bool CFE_CORE_AtomicCompareSwapU64(CFE_CORE_AtomicU64_t *Ptr, uint64 *ExpectedPtr, uint64 Desired)
+{
+    if (*Ptr != *ExpectedPtr)
+    {
+        *ExpectedPtr = *Ptr;
+        return false;
+    }
+
+    *Ptr = Desired;
+    return true;
+}
+
+#endif
+
+#endif /* CFE_CORE_ATOMIC_H */
@@ -0,0 +1,244 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:
+ *      Table driven command dispatch shared by the CFE core applications
+ *
+ * Design Notes:
+ *      Each core application describes the messages accepted on its command
+ *      pipe with a constant table of slots, one per message ID.  Each slot
+ *      holds the handlers of the message indexed directly by function code,
+ *      so finding the handler and the expected length of a command takes
+ *      the same time whatever the number of commands.  Messages without
+ *      function codes, such as the housekeeping request, have a single
+ *      entry used for any function code.
+ *
+ *      Message IDs are only known at run time, so each slot refers to the
+ *      application's cached copy of its message ID and the slots are
+ *      compared in order.  Core applications only have a few slots.
+ *
+ *      Events and counters for rejected messages differ between the core
+ *      applications, so those are left to the caller.
+ */
+
+#ifndef CFE_CORE_CMDDISPATCH_H
+#define CFE_CORE_CMDDISPATCH_H
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_error.h"
+#include "cfe_sb.h"
+#include "cfe_msg.h"
+#include "cfe_es_core_internal.h"
+
+/******************************************************************************
+ * Type Definitions
+ */
+
+/**
+ * \brief Command handler function, called with the received message
+ */
+typedef int32 (*CFE_CORE_CmdHandler_t)(const void *CmdPtr);
+
+/**
+ * \brief Dispatch entry of one command
+ */
+typedef struct CFE_CORE_CmdDispatchEntry
+{
+    CFE_CORE_CmdHandler_t Handler;        /**< \brief Handler function, NULL if the function code is not defined */
+    size_t                ExpectedLength; /**< \brief Expected message length including header, 0 for any length */
+} CFE_CORE_CmdDispatchEntry_t;
+
+/**
+ * \brief Dispatch slot of one message ID
+ */
+typedef struct CFE_CORE_CmdDispatchSlot
+{
+    const CFE_SB_MsgId_t              *MsgIdPtr;   /**< \brief Cached message ID of the slot */
+    const CFE_CORE_CmdDispatchEntry_t *Entries;    /**< \brief Entries indexed by function code */
+    uint16                             NumEntries; /**< \brief Entries count, 0 if Entries[0] takes any function code */
+    uint16                             StatsBase;  /**< \brief Command statistics index of Entries[0] */
+} CFE_CORE_CmdDispatchSlot_t;
+
+/**
+ * \brief Dispatch table of a core application command pipe
+ */
+typedef struct CFE_CORE_CmdDispatchTable
+{
+    const CFE_CORE_CmdDispatchSlot_t *Slots;    /**< \brief Slots, one per message ID */
+    uint16                            NumSlots; /**< \brief Number of slots */
+    CFE_ES_CmdStatsService_Enum_t     Service;  /**< \brief Service the command statistics are recorded for */
+} CFE_CORE_CmdDispatchTable_t;
+
+/******************************************************************************
+ * Macro Definitions
+ */
+
+/**
+ * \brief Dispatch entry for a command with a fixed length message type
+ *
+ * For use with designated initializers, indexed by the function code:
+ *
+ *     [CFE_ES_NOOP_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_NoopCmd_t, CFE_ES_NoopCmd),
+ */
+#define CFE_CORE_CMDDISPATCH_ENTRY(cmdtype, handler) \
+    { (CFE_CORE_CmdHandler_t)(handler), sizeof(cmdtype) }
+
+/**
+ * \brief Dispatch entry for a message that is passed to the handler whatever its length
+ */
+#define CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(handler) \
+    { (CFE_CORE_CmdHandler_t)(handler), 0 }
+
+/**
+ * \brief Dispatch slot for a message with function codes, from an array of entries
+ */
+#define CFE_CORE_CMDDISPATCH_CMD_SLOT(msgid, entries, statsbase) \
+    { &(msgid), (entries), (uint16)(sizeof(entries) / sizeof((entries)[0])), (statsbase) }
+
+/**
+ * \brief Dispatch slot for a message without function codes, from a single entry
+ */
+#define CFE_CORE_CMDDISPATCH_MSG_SLOT(msgid, entry, statsbase) \
+    { &(msgid), &(entry), 0, (statsbase) }
+
+/**
+ * \brief Dispatch table from an array of slots
+ */
+#define CFE_CORE_CMDDISPATCH_TABLE(slots, service) \
+    { (slots), (uint16)(sizeof(slots) / sizeof((slots)[0])), (service) }
+
+/******************************************************************************
+ * Function Definitions
+ */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Finds the dispatch entry of a message and checks its length
+ *
+ * The entry and statistics index outputs are set if the message ID and function
+ * code are found, including when the length is wrong, so the caller can report
+ * the expected length.
+ *
+ * \param[in]  TablePtr      Dispatch table of the command pipe
+ * \param[in]  HdrView       Decoded header of the message
+ * \param[out] EntryPtr      Set to the dispatch entry of the message
+ * \param[out] StatsIndexPtr Set to the command statistics index of the message
+ *
+ * \return #CFE_SUCCESS                   if the message can be dispatched
+ * \return #CFE_STATUS_UNKNOWN_MSG_ID     if no slot matches the message ID
+ * \return #CFE_STATUS_BAD_COMMAND_CODE   if the function code is not defined for the message ID
+ * \return #CFE_STATUS_WRONG_MSG_LENGTH   if the message length is not the expected length
+ */
+static inline CFE_Status_t CFE_CORE_CmdDispatch_Lookup(const CFE_CORE_CmdDispatchTable_t  *TablePtr,
+                                                       const CFE_MSG_HeaderView_t         *HdrView,
+                                                       const CFE_CORE_CmdDispatchEntry_t **EntryPtr,
+                                                       uint16                             *StatsIndexPtr)
+{
+    const CFE_CORE_CmdDispatchSlot_t *SlotPtr;
+    CFE_SB_MsgId_t                    MsgId;
+    CFE_MSG_FcnCode_t                 Index;
+    uint16                            SlotNum;
+    CFE_Status_t                      Status;
+
+    MsgId   = CFE_MSG_HeaderView_GetMsgId(HdrView);
+    SlotPtr = NULL;
+    for (SlotNum = 0; SlotNum < TablePtr->NumSlots; ++SlotNum)
+    {
+        if (CFE_SB_MsgId_Equal(*TablePtr->Slots[SlotNum].MsgIdPtr, MsgId))
+        {
+            SlotPtr = &TablePtr->Slots[SlotNum];
+            break;
+        }
+    }
+
+    if (SlotPtr == NULL)
+    {
+        Status = CFE_STATUS_UNKNOWN_MSG_ID;
+    }
+    else
+    {
+        /* Messages without function codes use the single entry */
+        Index = 0;
+        if (SlotPtr->NumEntries != 0)
+        {
+            Index = CFE_MSG_HeaderView_GetFcnCode(HdrView);
+        }
+
+        if (SlotPtr->NumEntries != 0 && (Index >= SlotPtr->NumEntries || SlotPtr->Entries[Index].Handler == NULL))
+        {
+            Status = CFE_STATUS_BAD_COMMAND_CODE;
+        }
+        else
+        {
+            *EntryPtr      = &SlotPtr->Entries[Index];
+            *StatsIndexPtr = SlotPtr->StatsBase + Index;
+
+            if (SlotPtr->Entries[Index].ExpectedLength != 0 &&
+                SlotPtr->Entries[Index].ExpectedLength != CFE_MSG_HeaderView_GetSize(HdrView))
+            {
+                Status = CFE_STATUS_WRONG_MSG_LENGTH;
+            }
+            else
+            {
+                Status = CFE_SUCCESS;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Invokes the handler of a dispatch entry and records its command statistics
+ *
+ * \param[in] TablePtr   Dispatch table of the command pipe
+ * \param[in] EntryPtr   Dispatch entry found by CFE_CORE_CmdDispatch_Lookup()
+ * \param[in] StatsIndex Command statistics index found by CFE_CORE_CmdDispatch_Lookup()
+ * \param[in] SBBufPtr   The message to pass to the handler
+ * \param[in] HdrView    Decoded header of the message
+ *
+ * \return The value returned by the handler
+ */
+static inline int32 CFE_CORE_CmdDispatch_Invoke(const CFE_CORE_CmdDispatchTable_t *TablePtr,
+                                                const CFE_CORE_CmdDispatchEntry_t *EntryPtr,
+                                                uint16                             StatsIndex,
+                                                const CFE_SB_Buffer_t             *SBBufPtr,
+                                                const CFE_MSG_HeaderView_t        *HdrView)
+{
+    uint64 StartTicks;
+    int32  Status;
+
+    StartTicks = CFE_ES_CmdStatsStart();
+    Status     = EntryPtr->Handler(SBBufPtr);
+    CFE_ES_CmdStatsRecord(TablePtr->Service,
+                          StatsIndex,
+                          CFE_MSG_HeaderView_GetMsgId(HdrView),
+                          CFE_MSG_HeaderView_GetFcnCode(HdrView),
+                          StartTicks);
+
+    return Status;
+}
+
+#endif /* CFE_CORE_CMDDISPATCH_H */
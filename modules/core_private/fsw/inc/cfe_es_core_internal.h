@@ -35,6 +35,8 @@
 
 #include "common_types.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_msg_api_typedefs.h"
+#include "cfe_psp.h"
 
 /*
  * The internal APIs prototyped within this block are only intended to be invoked from
@@ -46,6 +48,18 @@
  * @{
  */
 
+/**
+ * \brief Locks recorded by the lock contention profiler
+ */
+typedef enum CFE_ES_LockProfileId
+{
+    CFE_ES_LockProfileId_ES_SHARED_DATA = 0, /**< ES shared data lock */
+    CFE_ES_LockProfileId_SB_SHARED_DATA,     /**< SB shared data lock */
+    CFE_ES_LockProfileId_FS_SHARED_DATA,     /**< FS shared data lock */
+    CFE_ES_LockProfileId_TBL_REGISTRY,       /**< TBL registry lock */
+    CFE_ES_LockProfileId_MAX                 /**< Number of profiled locks, always last */
+} CFE_ES_LockProfileId_t;
+
 /*****************************************************************************/
 /**
 ** \brief Entry Point for cFE Core Application
@@ -135,6 +149,191 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Marks the start of waiting for a profiled lock
+**
+** \par Description
+**        Called immediately before taking a lock that is recorded by the lock
+**        contention profiler.  The value returned is passed to
+**        CFE_ES_LockProfileAcquired() once the lock is taken.
+**
+** \par Assumptions, External Events, and Notes:
+**        Returns 0 without reading the timebase if profiling is disabled.
+**
+** \return Current timebase, in timer ticks
+**
+******************************************************************************/
+uint64 CFE_ES_LockProfileWaitStart(void);
+
+/*****************************************************************************/
+/**
+** \brief Records that a profiled lock was taken
+**
+** \par Description
+**        Called immediately after successfully taking a lock that is recorded
+**        by the lock contention profiler.  Adds the time spent waiting for the
+**        lock to the record of the place it was taken from, and starts the hold
+**        time, unless this is a nested (recursive) take by the task that
+**        already holds the lock.
+**
+** \par Assumptions, External Events, and Notes:
+**        Must only be called while holding the lock, which also serializes the
+**        updates to the profile of that lock.
+**
+** \param[in]  LockId         The lock that was taken
+** \param[in]  FunctionName   Name of the function the lock was taken from
+** \param[in]  LineNumber     Line number the lock was taken from, or 0 if not known
+** \param[in]  WaitStartTicks The value returned by CFE_ES_LockProfileWaitStart()
+**
+******************************************************************************/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId,
+                                const char            *FunctionName,
+                                int32                  LineNumber,
+                                uint64                 WaitStartTicks);
+
+/*****************************************************************************/
+/**
+** \brief Records that a profiled lock is about to be released
+**
+** \par Description
+**        Called immediately before giving a lock that is recorded by the lock
+**        contention profiler.  When the outermost take is released, adds the
+**        time the lock was held to the record of the place it was taken from.
+**
+** \par Assumptions, External Events, and Notes:
+**        Must only be called while holding the lock.
+**
+** \param[in]  LockId   The lock being released
+**
+******************************************************************************/
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_t LockId);
+
+/*****************************************************************************/
+/**
+** \brief Marks the start of a command handler
+**
+** \par Description
+**        Called by the command dispatcher of a core service immediately before
+**        invoking a command handler.  The value returned is passed to
+**        CFE_ES_CmdStatsRecord() once the handler returns.
+**
+** \par Assumptions, External Events, and Notes:
+**        Returns 0 without reading the timebase if command statistics are disabled.
+**
+** \return Current timebase, in timer ticks
+**
+******************************************************************************/
+uint64 CFE_ES_CmdStatsStart(void);
+
+/*****************************************************************************/
+/**
+** \brief Records the execution of a command handler
+**
+** \par Description
+**        Called by the command dispatcher of a core service immediately after
+**        a command handler returns.  Counts the command and adds the time the
+**        handler took to the statistics entry of the command.
+**
+** \par Assumptions, External Events, and Notes:
+**        Each service must only record its own commands, from its own task, as
+**        the entries of a service are updated without a lock.  Commands with a
+**        StatsIndex beyond #CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES are only counted.
+**
+** \param[in]  Service     The core service handling the command
+** \param[in]  StatsIndex  The statistics entry of the command within the service
+** \param[in]  MsgId       The message ID of the command
+** \param[in]  FcnCode     The function code of the command
+** \param[in]  StartTicks  The value returned by CFE_ES_CmdStatsStart()
+**
+******************************************************************************/
+void CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_Enum_t Service,
+                           uint16                        StatsIndex,
+                           CFE_SB_MsgId_t                MsgId,
+                           CFE_MSG_FcnCode_t             FcnCode,
+                           uint64                        StartTicks);
+
+/*****************************************************************************/
+/**
+** \brief Combines the upper and lower parts of a timebase value into a tick count
+**
+** \par Description
+**        This is the tick count used by the ES performance stream format, and
+**        for all time measurements in the core based on the PSP timebase.
+**
+** \param[in]  TimebaseUpper  Upper part of the timebase, from CFE_PSP_Get_Timebase()
+** \param[in]  TimebaseLower  Lower part of the timebase, from CFE_PSP_Get_Timebase()
+** \param[in]  Low32Rollover  Value from CFE_PSP_GetTimerLow32Rollover(), or 0 if the
+**                            lower part uses the full 32 bits
+**
+** \return Timebase, in timer ticks
+**
+******************************************************************************/
+static inline uint64 CFE_ES_TimebaseToTicks(uint32 TimebaseUpper, uint32 TimebaseLower, uint32 Low32Rollover)
+{
+    if (Low32Rollover != 0)
+    {
+        return ((uint64)TimebaseUpper * Low32Rollover) + TimebaseLower;
+    }
+
+    return ((uint64)TimebaseUpper << 32) | TimebaseLower;
+}
+
+/*****************************************************************************/
+/**
+** \brief Reads the PSP timebase as a tick count
+**
+** \param[in]  Low32Rollover  Value from CFE_PSP_GetTimerLow32Rollover(), see CFE_ES_TimebaseToTicks()
+**
+** \return Current timebase, in timer ticks
+**
+******************************************************************************/
+static inline uint64 CFE_ES_GetTimebaseTicks(uint32 Low32Rollover)
+{
+    uint32 TimebaseUpper = 0;
+    uint32 TimebaseLower = 0;
+
+    CFE_PSP_Get_Timebase(&TimebaseUpper, &TimebaseLower);
+
+    return CFE_ES_TimebaseToTicks(TimebaseUpper, TimebaseLower, Low32Rollover);
+}
+
+/*****************************************************************************/
+/**
+** \brief Converts the timer ticks between two timebase values to microseconds
+**
+** \par Assumptions, External Events, and Notes:
+**        The result is 0 if the timebase appears to have gone backwards, and
+**        is limited to the range of a uint32.
+**
+** \param[in]  StartTicks      Timebase at the start, in timer ticks
+** \param[in]  NowTicks        Timebase at the end, in timer ticks
+** \param[in]  TicksPerSecond  Value from CFE_PSP_GetTimerTicksPerSecond(), must not be 0
+**
+** \return Elapsed time, in microseconds
+**
+******************************************************************************/
+static inline uint32 CFE_ES_TimebaseElapsedUsec(uint64 StartTicks, uint64 NowTicks, uint32 TicksPerSecond)
+{
+    uint64 Elapsed;
+    uint64 Usec;
+
+    Elapsed = 0;
+    if (NowTicks > StartTicks)
+    {
+        Elapsed = NowTicks - StartTicks;
+    }
+
+    /* Split the conversion so the multiply cannot overflow */
+    Usec = ((Elapsed / TicksPerSecond) * 1000000) + (((Elapsed % TicksPerSecond) * 1000000) / TicksPerSecond);
+    if (Usec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+
+    return (uint32)Usec;
+}
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
@@ -0,0 +1,70 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Definition of the compact streaming performance log file format
+ *
+ * Each file in a performance stream starts with the usual CFE_FS_Header_t,
+ * followed by one CFE_ES_PerfStreamHeader_t, followed by a sequence of
+ * variable length marker records until the end of the file.
+ *
+ * Each record is a pair of unsigned LEB128 values (7 bits per byte, least
+ * significant group first, high bit set on all but the last byte):
+ *  - the marker ID shifted left by one, with the exit flag in bit 0
+ *  - the signed number of timer ticks since the previous record, zigzag
+ *    encoded (0, -1, 1, -2, ... map to 0, 1, 2, 3, ...).  This is normally
+ *    positive, but may occasionally be slightly negative where an entry was
+ *    added out of order.  The first record in each file is relative to the
+ *    BaseTicks value in the file header.
+ *
+ * Timer ticks are the 64-bit combination of the upper and lower timebase
+ * registers, (Upper * TimerLow32Rollover) + Lower, or (Upper << 32) + Lower
+ * if TimerLow32Rollover is zero.
+ *
+ * This file is also used by the host-side stream conversion tool, so it must
+ * not depend on anything other than the basic types.
+ */
+
+#ifndef CFE_ES_PERFSTREAM_TYPEDEF_H
+#define CFE_ES_PERFSTREAM_TYPEDEF_H
+
+#include "common_types.h"
+
+#define CFE_ES_PERFSTREAM_MAGIC   0x43505354 /**< "CPST", in the byte order of the target */
+#define CFE_ES_PERFSTREAM_VERSION 1
+
+/**
+ * Largest possible encoded record: a 32-bit marker value plus a 64-bit tick delta
+ */
+#define CFE_ES_PERFSTREAM_MAX_RECORD_SIZE (5 + 10)
+
+typedef struct
+{
+    uint32 Magic;               /**< CFE_ES_PERFSTREAM_MAGIC, also identifies the byte order */
+    uint32 Version;             /**< CFE_ES_PERFSTREAM_VERSION */
+    uint32 TimerTicksPerSecond; /**< Timebase tick rate */
+    uint32 TimerLow32Rollover;  /**< Rollover value of the lower timebase register, 0 if 2^32 */
+    uint32 FileSequence;        /**< Position of this file in the stream, starting at 0 */
+    uint32 LostEntries;         /**< Entries lost to a full buffer since the stream was started */
+    uint32 BaseTicksUpper;      /**< Upper 32 bits of the tick value the first record is relative to */
+    uint32 BaseTicksLower;      /**< Lower 32 bits of the tick value the first record is relative to */
+} CFE_ES_PerfStreamHeader_t;
+
+#endif /* CFE_ES_PERFSTREAM_TYPEDEF_H */
@@ -44,7 +44,9 @@ typedef struct CFE_SB_DestinationD
     uint16                      BuffCount;
     uint16                      DestCnt;
     uint8                       Scope;
-    uint8                       Spare[3];
+    uint8                       Priority; /* Lane of the pipe the messages are written to */
+    uint8                       MaskSub;  /* Added for a mask subscription, see CFE_SB_SubscribeMask() */
+    uint8                       Spare;
     struct CFE_SB_DestinationD *Prev;
     struct CFE_SB_DestinationD *Next;
 } CFE_SB_DestinationD_t;
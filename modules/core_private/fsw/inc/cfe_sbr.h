@@ -51,8 +51,9 @@ void CFE_SBR_Init(void);
  *  \brief Add a route for the given message id
  *
  *  Called for the first subscription to a message ID, uses up one
- *  element in the routing table.  Assumes check for existing
- *  route was already performed or routes could leak
+ *  element in the routing table until removed by CFE_SBR_RemoveRoute.
+ *  Assumes check for existing route was already performed or routes
+ *  could leak
  *
  *  \param[in]  MsgId         Message ID of the route to add
  *  \param[out] CollisionsPtr Number of collisions (if not null)
@@ -61,6 +62,20 @@ void CFE_SBR_Init(void);
  */
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
 
+/**
+ *  \brief Remove the given route
+ *
+ *  Called when the last destination of a message ID is removed.  The
+ *  message ID is removed from the map and the routing table element
+ *  is released, to be reused by a later CFE_SBR_AddRoute call.  Any
+ *  sequence counter associated with the route is lost.
+ *
+ *  \note The destination list of the route must already be empty.
+ *
+ *  \param[in] RouteId Route ID to remove
+ */
+void CFE_SBR_RemoveRoute(CFE_SBR_RouteId_t RouteId);
+
 /**
  *  \brief Obtain the route id given a message id
  *
@@ -126,6 +141,19 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
  */
 void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE_SBR_Throttle_t *ThrottlePtr);
 
+/**
+ * \brief Get a histogram of the map probe lengths of all current routes
+ *
+ * Counts the number of routes that are found in the message map after
+ * 0, 1, 2 ... probes beyond the initial lookup position.  The last entry
+ * of the histogram counts all routes with a longer probe length.  Map
+ * implementations that never collide report all routes in the first entry.
+ *
+ * \param[out] HistogramPtr Histogram to fill
+ * \param[in]  NumBins      Number of entries in the histogram
+ */
+void CFE_SBR_GetProbeHistogram(uint32 *HistogramPtr, uint32 NumBins);
+
 /******************************************************************************
 ** Inline functions
 */
@@ -41,6 +41,40 @@ int32 CFE_ES_CDS_EarlyInit(void)
     return UT_GenStub_GetReturnValue(CFE_ES_CDS_EarlyInit, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CmdStatsRecord()
+ * ----------------------------------------------------
+ */
+void CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_Enum_t Service,
+                           uint16                        StatsIndex,
+                           CFE_SB_MsgId_t                MsgId,
+                           CFE_MSG_FcnCode_t             FcnCode,
+                           uint64                        StartTicks)
+{
+    UT_GenStub_AddParam(CFE_ES_CmdStatsRecord, CFE_ES_CmdStatsService_Enum_t, Service);
+    UT_GenStub_AddParam(CFE_ES_CmdStatsRecord, uint16, StatsIndex);
+    UT_GenStub_AddParam(CFE_ES_CmdStatsRecord, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_ES_CmdStatsRecord, CFE_MSG_FcnCode_t, FcnCode);
+    UT_GenStub_AddParam(CFE_ES_CmdStatsRecord, uint64, StartTicks);
+
+    UT_GenStub_Execute(CFE_ES_CmdStatsRecord, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CmdStatsStart()
+ * ----------------------------------------------------
+ */
+uint64 CFE_ES_CmdStatsStart(void)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CmdStatsStart, uint64);
+
+    UT_GenStub_Execute(CFE_ES_CmdStatsStart, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CmdStatsStart, uint64);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_DeleteCDS()
@@ -58,6 +92,50 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
     return UT_GenStub_GetReturnValue(CFE_ES_DeleteCDS, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileAcquired()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId,
+                                const char            *FunctionName,
+                                int32                  LineNumber,
+                                uint64                 WaitStartTicks)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, CFE_ES_LockProfileId_t, LockId);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, const char *, FunctionName);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, int32, LineNumber);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, uint64, WaitStartTicks);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileAcquired, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileRelease()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_t LockId)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileRelease, CFE_ES_LockProfileId_t, LockId);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileWaitStart()
+ * ----------------------------------------------------
+ */
+uint64 CFE_ES_LockProfileWaitStart(void)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_LockProfileWaitStart, uint64);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileWaitStart, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_LockProfileWaitStart, uint64);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterCDSEx()
@@ -306,6 +306,49 @@ enum CFE_ES_AppState
  */
 typedef uint32 CFE_ES_AppState_Enum_t;
 
+/**
+ * @brief Label definitions associated with CFE_ES_CmdStatsService_Enum_t
+ */
+enum CFE_ES_CmdStatsService
+{
+    /**
+     * @brief Executive Services commands
+     */
+    CFE_ES_CmdStatsService_ES = 0,
+
+    /**
+     * @brief Event Services commands
+     */
+    CFE_ES_CmdStatsService_EVS = 1,
+
+    /**
+     * @brief Software Bus commands
+     */
+    CFE_ES_CmdStatsService_SB = 2,
+
+    /**
+     * @brief Table Services commands
+     */
+    CFE_ES_CmdStatsService_TBL = 3,
+
+    /**
+     * @brief Time Services commands
+     */
+    CFE_ES_CmdStatsService_TIME = 4,
+
+    /**
+     * @brief Reserved entry, marker for the number of services
+     */
+    CFE_ES_CmdStatsService_MAX
+};
+
+/**
+ * @brief Identifies the core service of a set of command statistics
+ *
+ * @sa enum CFE_ES_CmdStatsService
+ */
+typedef uint8 CFE_ES_CmdStatsService_Enum_t;
+
 /**
  * @brief A type for Application IDs
  *
@@ -467,6 +510,42 @@ typedef struct CFE_ES_CDSRegDumpRec
     uint8              ByteAlignSpare[3]; /**< \brief Spare bytes to ensure structure size is multiple of 4 bytes */
 } CFE_ES_CDSRegDumpRec_t;
 
+/**
+ * \brief Lock Profile Time Statistics
+ *
+ * Times spent waiting for or holding a lock, in microseconds.  Entry 0 of Bin
+ * counts times below 1 microsecond, entry N counts times from 2^(N-1) up to
+ * 2^N microseconds, and the last entry counts all longer times.
+ */
+typedef struct CFE_ES_LockProfileTimes
+{
+    uint64 TotalTime;                                  /**< \brief Sum of all times counted */
+    uint32 Count;                                      /**< \brief Number of times counted */
+    uint32 MaxTime;                                    /**< \brief Longest time counted */
+    uint32 Bin[CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS]; /**< \brief Number of times in each range */
+} CFE_ES_LockProfileTimes_t;
+
+/**
+ * \brief Lock Profile File Entry
+ *
+ * Structure of one element of the lock profile file written in response to
+ * #CFE_ES_WRITE_LOCK_PROFILE_CC.  There is one entry for each place a lock
+ * was taken from.  Hold time is counted against the place the lock was first
+ * taken from, nested (recursive) takes of the same lock are not counted.
+ *
+ * An entry with an empty FunctionName counts the number of times the lock was
+ * taken from a place that could not be recorded because all records for the
+ * lock were in use, in Wait.Count.
+ */
+typedef struct CFE_ES_LockProfileFileEntry
+{
+    CFE_ES_LockProfileTimes_t Wait;                                   /**< \brief Time spent waiting to take the lock */
+    CFE_ES_LockProfileTimes_t Hold;                                   /**< \brief Time the lock was held for */
+    uint32                    LineNumber;                             /**< \brief Line number, 0 if not known */
+    char                      LockName[CFE_MISSION_MAX_API_LEN];      /**< \brief Name of the lock */
+    char                      FunctionName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Function taking the lock */
+} CFE_ES_LockProfileFileEntry_t;
+
 /**
  * \brief Block statistics
  *
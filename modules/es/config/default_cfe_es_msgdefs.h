@@ -29,6 +29,7 @@
 #include "common_types.h"
 #include "cfe_mission_cfg.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_sb_extern_typedefs.h"
 #include "cfe_es_fcncodes.h"
 
 /********************************/
@@ -154,7 +155,8 @@ enum CFE_ES_PerfMode
 {
     CFE_ES_PerfTrigger_START = 0,
     CFE_ES_PerfTrigger_CENTER,
-    CFE_ES_PerfTrigger_END
+    CFE_ES_PerfTrigger_END,
+    CFE_ES_PerfTrigger_STREAM /**< Not a trigger position, continuously stream data to a series of files */
 };
 
 typedef uint32 CFE_ES_PerfMode_Enum_t;
@@ -168,7 +170,7 @@ typedef uint32 CFE_ES_PerfMode_Enum_t;
 typedef struct CFE_ES_StartPerfCmd_Payload
 {
     CFE_ES_PerfMode_Enum_t
-        TriggerMode; /**< \brief Desired trigger position (Start, Center, End). Values defined by #CFE_ES_PerfMode. */
+        TriggerMode; /**< \brief Desired trigger position (Start, Center, End) or Stream. Values defined by #CFE_ES_PerfMode. */
 } CFE_ES_StartPerfCmd_Payload_t;
 
 /**
@@ -256,6 +258,38 @@ typedef struct CFE_ES_PoolStatsTlm_Payload
     CFE_ES_MemPoolStats_t PoolStats; /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
 } CFE_ES_PoolStatsTlm_Payload_t;
 
+/**
+**  \brief Command Statistics Entry
+**
+**  Execution statistics of the handler of one command.  Used in the
+**  Command Statistics Packet #CFE_ES_CmdStatsTlm_Payload_t
+**/
+typedef struct CFE_ES_CmdStatsEntry
+{
+    uint64         TotalTime; /**< \brief Sum of the handler execution times, in microseconds */
+    CFE_SB_MsgId_t MsgId;     /**< \brief Message ID of the command */
+    uint16         FcnCode;   /**< \brief Function code of the command */
+    uint16         Spare;     /**< \brief Spare bytes to ensure structure size is multiple of 8 bytes */
+    uint32         Count;     /**< \brief Number of times the handler was invoked, 0 if the entry is unused */
+    uint32         MaxTime;   /**< \brief Longest handler execution time, in microseconds */
+} CFE_ES_CmdStatsEntry_t;
+
+/**
+**  \cfeestlm Command Statistics Packet
+**
+**  Sent for each core service in response to #CFE_ES_SEND_CMD_STATS_CC.  The
+**  statistics are only recorded if they are enabled with the
+**  #CFE_PLATFORM_ES_CMD_STATS_ENABLE configuration parameter.
+**/
+typedef struct CFE_ES_CmdStatsTlm_Payload
+{
+    CFE_ES_CmdStatsService_Enum_t Service;      /**< \brief Core service the statistics are for */
+    uint8                         Spare[3];     /**< \brief Spare bytes for alignment */
+    uint32                        DroppedCount; /**< \brief Commands handled that had no entry to record them in */
+    CFE_ES_CmdStatsEntry_t
+        Entries[CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES]; /**< \brief Statistics of each command of the service */
+} CFE_ES_CmdStatsTlm_Payload_t;
+
 /*************************************************************************/
 
 /**
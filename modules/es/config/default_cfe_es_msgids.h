@@ -37,5 +37,6 @@
 #define CFE_ES_HK_TLM_MID       CFE_PLATFORM_ES_TLM_MIDVAL(HK_TLM)
 #define CFE_ES_APP_TLM_MID      CFE_PLATFORM_ES_TLM_MIDVAL(APP_TLM)
 #define CFE_ES_MEMSTATS_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(MEMSTATS_TLM)
+#define CFE_ES_CMDSTATS_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(CMDSTATS_TLM)
 
 #endif
@@ -68,6 +68,11 @@ typedef struct CFE_ES_ResetPRCountCmd
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } CFE_ES_ResetPRCountCmd_t;
 
+typedef struct CFE_ES_SendCmdStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CFE_ES_SendCmdStatsCmd_t;
+
 typedef struct CFE_ES_SendHkCmd
 {
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
@@ -120,6 +125,12 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WriteLockProfileCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteLockProfileCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -266,6 +277,15 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Command Statistics Packet
+**/
+typedef struct CFE_ES_CmdStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t    TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_CmdStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_CmdStatsTlm_t;
+
 /**
 **  \cfeestlm Executive Services Housekeeping Packet
 **/
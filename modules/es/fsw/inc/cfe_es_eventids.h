@@ -1057,6 +1057,76 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief Performance Stream File Write Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  A file in the series written while collecting performance data in streaming
+ *  mode was successfully completed.
+ */
+#define CFE_ES_PERF_STREAM_EID 94
+
+/**
+ * \brief Performance Stream File Write Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  A file in the series written while collecting performance data in streaming
+ *  mode could not be created or written.  Streaming continues with the next file.
+ */
+#define CFE_ES_PERF_STREAM_ERR_EID 95
+
+/**
+ * \brief ES Write Lock Profile Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink success.
+ */
+#define CFE_ES_LOCKPROF_EID 96
+
+/**
+ * \brief ES Write Lock Profile Command File Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink failed
+ *  parsing file name or creating the file. OVERLOADED
+ */
+#define CFE_ES_LOCKPROF_ERR_EID 97
+
+/**
+ * \brief ES Write Lock Profile Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_LOCKPROF_PENDING_ERR_EID 98
+
+/**
+ * \brief ES Telemeter Command Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_SEND_CMD_STATS_CC ES Telemeter Command Statistics Command \endlink success.
+ */
+#define CFE_ES_CMDSTATS_EID 99
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
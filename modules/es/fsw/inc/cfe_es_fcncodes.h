@@ -603,7 +603,7 @@
 **         either WAITING FOR TRIGGER or, if conditions are appropriate fast enough,
 **         TRIGGERED.
 **       - \b \c \ES_PERFMODE - Performance Analyzer Mode will change to the commanded trigger mode (TRIGGER START,
-**         TRIGGER CENTER, or TRIGGER END).
+**         TRIGGER CENTER, TRIGGER END, or STREAM).
 **       - \b \c \ES_PERFTRIGCNT - Performance Trigger Count will go to zero
 **       - \b \c \ES_PERFDATASTART - Data Start Index will go to zero
 **       - \b \c \ES_PERFDATAEND - Data End Index will go to zero
@@ -614,6 +614,7 @@
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
 **       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
+**       - A previous collection in stream mode has not finished writing its files.
 **       - An invalid trigger mode is requested.
 **
 **       Evidence of failure may be found in the following telemetry:
@@ -1033,6 +1034,94 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC CFE_ES_CCVAL(QUERY_ALL_TASKS)
 
+/** \cfeescmd Write the Lock Contention Profile to a File
+**
+**  \par Description
+**       This command writes the lock contention profile to the specified file.
+**       For each place the ES, SB or FS shared data lock or the TBL registry lock
+**       was taken from, the file holds the number of times the lock was taken and
+**       the total, maximum and histogram of the time spent waiting for the lock
+**       and holding it.  The profile is only recorded if it is enabled with the
+**       #CFE_PLATFORM_ES_LOCK_PROFILE_ENABLE configuration parameter.
+**
+**  \cfecmdmnemonic \ES_WRITELOCKPROF2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteLockProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_LOCKPROF_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the lock profile has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_LockProfileFileEntry_t
+*/
+#define CFE_ES_WRITE_LOCK_PROFILE_CC CFE_ES_CCVAL(WRITE_LOCK_PROFILE)
+
+/** \cfeescmd Telemeter Command Execution Statistics
+**
+**  \par Description
+**       This command sends one \link #CFE_ES_CmdStatsTlm_t Command Statistics
+**       Telemetry Packet \endlink for each of the ES, EVS, SB, TBL and TIME
+**       services.  Each packet holds, for each command of the service, the
+**       number of times its handler was invoked and the total and maximum time
+**       the handler took.  The statistics are only recorded if they are enabled
+**       with the #CFE_PLATFORM_ES_CMD_STATS_ENABLE configuration parameter.
+**
+**  \cfecmdmnemonic \ES_SENDCMDSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_SendCmdStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_CMDSTATS_EID debug event message will be
+**         generated.
+**       - The \link #CFE_ES_CmdStatsTlm_t Command Statistics Telemetry Packet \endlink
+**         is produced for each service
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       None
+**
+**  \sa #CFE_ES_CmdStatsEntry_t
+*/
+#define CFE_ES_SEND_CMD_STATS_CC CFE_ES_CCVAL(SEND_CMD_STATS)
+
 /** \} */
 
 #endif
@@ -119,8 +119,10 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_16_ARC is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Must be one of the implemented algorithms (see brief in CFE_ES_CrcType_Enum
+**      definition in cfe_es_api_typedefs.h).  Critical Data Stores preserved
+**      across a processor reset are validated with this algorithm, so changing
+**      it invalidates them on the first restart with the new setting.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC         CFE_MISSION_ES_CFGVAL(DEFAULT_CRC)
 #define DEFAULT_CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_16_ARC
@@ -148,6 +150,47 @@
 /* Default value is calculated as: (CFE_MISSION_ES_CDS_MAX_NAME_LENGTH + CFE_MISSION_MAX_API_LEN + 4) */
 #define DEFAULT_CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN 40
 
+/**
+**  \cfeescfg Number of entries in the lock profile histograms
+**
+**  \par Description:
+**       The lock contention profile counts the time spent waiting for and
+**       holding each lock in histograms of this many entries.  Entry 0 counts
+**       times below 1 microsecond, entry N counts times from 2^(N-1) up to 2^N
+**       microseconds, and the last entry counts all longer times.
+**
+**       This affects the layout of the lock profile file but does not affect run
+**       time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be at least 1.  This value should be kept as a multiple of 2, to
+**       maintain alignment of the 64 bit fields in the profile without implicit
+**       padding.
+*/
+#define CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS         CFE_MISSION_ES_CFGVAL(LOCK_PROFILE_HIST_BINS)
+#define DEFAULT_CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS 20
+
+/**
+**  \cfeescfg Number of entries in the command statistics packet
+**
+**  \par Description:
+**       ES keeps execution statistics for each command of each core service,
+**       indexed by message and function code, and sends them in one packet per
+**       service.  This defines the number of entries in each packet, which must
+**       cover all commands of the core service with the most commands.
+**       Commands without an entry are only counted.
+**
+**       This affects the layout of command/telemetry messages and the size of
+**       the statistics kept by ES.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be at least 1.
+*/
+#define CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES         CFE_MISSION_ES_CFGVAL(CMD_STATS_MAX_ENTRIES)
+#define DEFAULT_CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES 32
+
 #ifndef CFE_OMIT_DEPRECATED_6_8
 /* These names have been converted to an enum in cfe_es_api_typedefs.h */
 
@@ -460,6 +460,37 @@
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME         CFE_PLATFORM_ES_CFGVAL(DEFAULT_PERF_DUMP_FILENAME)
 #define DEFAULT_CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Performance Stream Base Filename
+**
+**  \par Description:
+**       The value of this constant defines the path and base filename of the
+**       files written while performance data is collected in streaming mode.
+**       Each file in the series is named by appending an underscore, the
+**       three digit file number and ".dat" to this value.
+**
+**  \par Limits
+**       The length of the string, plus the 8 characters appended to it and the
+**       NULL terminator, cannot exceed the #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME         CFE_PLATFORM_ES_CFGVAL(DEFAULT_PERF_STREAM_FILENAME)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME "/ram/cfe_es_perfstream"
+
+/**
+**  \cfeescfg Default Lock Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       lock contention profile.  This filename is used only when no filename
+**       is specified in the command.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE         CFE_PLATFORM_ES_CFGVAL(DEFAULT_LOCK_PROFILE_FILE)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE "/ram/cfe_es_lockprof.dat"
+
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
 **
@@ -658,6 +689,105 @@
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS         CFE_PLATFORM_ES_CFGVAL(PERF_ENTRIES_BTWN_DLYS)
 #define DEFAULT_CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Define Performance Analyzer Per-Task Ring Size
+**
+**  \par Description:
+**       Performance markers are first recorded into a small ring owned by the
+**       calling task, which the ES background task periodically merges into the
+**       performance log.  This keeps the perf log mutex off the path of every
+**       marker.  This parameter defines the number of entries in each ring.
+**       If a ring fills before it is merged, the marker is instead written to
+**       the log directly under the mutex.
+**
+**       The rings rely on memory barriers to be safe on SMP targets, which are
+**       taken from C11 atomics or the GCC builtins.  If the compiler provides
+**       neither, the rings are not used and every marker is written under the
+**       mutex.
+**
+**  \par Limits
+**       Must be a power of two, and at least 2.  One ring is allocated for each
+**       of the OS_MAX_TASKS OSAL tasks, at 12 bytes per entry.
+*/
+#define CFE_PLATFORM_ES_PERF_TASK_RING_SIZE         CFE_PLATFORM_ES_CFGVAL(PERF_TASK_RING_SIZE)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_TASK_RING_SIZE 32
+
+/**
+**  \cfeescfg Define Performance Stream Entries Per File
+**
+**  \par Description:
+**       In streaming mode, performance data is continuously written to a
+**       series of files.  This parameter defines the maximum number of entries
+**       written to each file.  A new file is started whenever at least half
+**       this many entries are waiting in the performance data buffer.
+**
+**  \par Limits
+**       Must be at least 2, and no more than twice #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_FILE_ENTRIES)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES 4096
+
+/**
+**  \cfeescfg Define Performance Stream Number of Files
+**
+**  \par Description:
+**       In streaming mode, the file number wraps back to zero after this many
+**       files, so that only the most recent files are kept and a long capture
+**       cannot fill the available storage.
+**
+**  \par Limits
+**       Must be between 1 and 1000.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_MAX_FILES)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES 16
+
+/**
+**  \cfeescfg Enable Lock Contention Profiling
+**
+**  \par Description:
+**       If true, the time spent waiting for and holding the ES, SB and FS shared
+**       data locks and the TBL registry lock is recorded for each place the lock
+**       is taken.  This costs two timebase reads on every lock and unlock.  If
+**       false, or if the PSP does not report a timebase rate, nothing is recorded.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE_ENABLE         CFE_PLATFORM_ES_CFGVAL(LOCK_PROFILE_ENABLE)
+#define DEFAULT_CFE_PLATFORM_ES_LOCK_PROFILE_ENABLE false
+
+/**
+**  \cfeescfg Define Lock Profile Sites per Lock
+**
+**  \par Description:
+**       The lock contention profile keeps a separate record for each place
+**       (function and line) a lock is taken from.  This parameter defines the
+**       number of records kept for each profiled lock.  Locks taken from further
+**       places are only counted as dropped.
+**
+**  \par Limits
+**       Must be at least 1.  The records are allocated whether or not profiling
+**       is enabled, at about 200 bytes per record for each of the four locks.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES         CFE_PLATFORM_ES_CFGVAL(LOCK_PROFILE_MAX_SITES)
+#define DEFAULT_CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES 64
+
+/**
+**  \cfeescfg Enable Command Execution Statistics
+**
+**  \par Description:
+**       If true, the number of times each command of the ES, EVS, SB, TBL and
+**       TIME services is handled and the time its handler took are recorded,
+**       and can be sent with the #CFE_ES_SEND_CMD_STATS_CC command.  This costs
+**       two timebase reads for every command.  If false, or if the PSP does not
+**       report a timebase rate, nothing is recorded.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_CMD_STATS_ENABLE         CFE_PLATFORM_ES_CFGVAL(CMD_STATS_ENABLE)
+#define DEFAULT_CFE_PLATFORM_ES_CMD_STATS_ENABLE false
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
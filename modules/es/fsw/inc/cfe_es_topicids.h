@@ -54,5 +54,7 @@
 #define DEFAULT_CFE_MISSION_ES_APP_TLM_TOPICID      11
 #define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(MEMSTATS_TLM)
 #define DEFAULT_CFE_MISSION_ES_MEMSTATS_TLM_TOPICID 16
+#define CFE_MISSION_ES_CMDSTATS_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(CMDSTATS_TLM)
+#define DEFAULT_CFE_MISSION_ES_CMDSTATS_TLM_TOPICID 17
 
 #endif
@@ -1551,7 +1551,7 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
     {
         /* This always returns a valid object, even if it is not implemented */
         CrcParams = CFE_ES_ComputeCRC_GetParams(TypeCRC);
-        CrcResult = CrcParams->Algorithm(DataPtr, DataLength, InputCRC);
+        CrcResult = CrcParams->Algorithm(DataPtr, DataLength, InputCRC ^ CrcParams->FinalXOR) ^ CrcParams->FinalXOR;
     }
 
     return CrcResult;
@@ -2074,10 +2074,17 @@ CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx)
  *-----------------------------------------------------------------*/
 void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
 {
-    int32 OsStatus;
+    int32  OsStatus;
+    uint64 WaitStartTicks;
+
+    WaitStartTicks = CFE_ES_LockProfileWaitStart();
 
     OsStatus = OS_MutSemTake(CFE_ES_Global.SharedDataMutex);
-    if (OsStatus != OS_SUCCESS)
+    if (OsStatus == OS_SUCCESS)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, FunctionName, LineNumber, WaitStartTicks);
+    }
+    else
     {
         /*
          * NOTE: this is going to write into a buffer that itself
@@ -2101,6 +2108,8 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
 
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+
     OsStatus = OS_MutSemGive(CFE_ES_Global.SharedDataMutex);
     if (OsStatus != OS_SUCCESS)
     {
@@ -82,6 +82,16 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
      .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
      .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000 },
+    { /* Performance Log per-task ring merge */
+      .RunFunc      = CFE_ES_RunPerfLogMerge,
+     .JobArg       = NULL,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000 },
+    { /* Performance Log streaming to file series */
+      .RunFunc      = CFE_ES_RunPerfLogStream,
+     .JobArg       = &CFE_ES_Global.BackgroundPerfStreamState,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000 },
     { /* Check for exceptions stored in the PSP */
       .RunFunc      = CFE_ES_RunExceptionScan,
      .JobArg       = NULL,
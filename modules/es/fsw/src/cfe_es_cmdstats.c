@@ -0,0 +1,136 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_es_cmdstats.c
+**
+** Purpose: This file contains the functions that record the execution
+**  statistics of the commands of the core services.
+**
+*/
+
+/*
+** Include Section
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CmdStatsInit(void)
+{
+    CFE_ES_CmdStatsGlobal_t *StatsPtr;
+
+    StatsPtr = &CFE_ES_Global.CmdStats;
+
+    memset(StatsPtr, 0, sizeof(*StatsPtr));
+
+    StatsPtr->TicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+    StatsPtr->Low32Rollover  = CFE_PSP_GetTimerLow32Rollover();
+    StatsPtr->IsEnabled      = (CFE_PLATFORM_ES_CMD_STATS_ENABLE && StatsPtr->TicksPerSecond != 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CmdStatsGetPayload(CFE_ES_CmdStatsService_Enum_t Service, CFE_ES_CmdStatsTlm_Payload_t *PayloadPtr)
+{
+    const CFE_ES_CmdStatsRecord_t *RecordPtr;
+
+    memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+    PayloadPtr->Service = Service;
+
+    if (Service < CFE_ES_CmdStatsService_MAX)
+    {
+        RecordPtr = &CFE_ES_Global.CmdStats.Services[Service];
+
+        PayloadPtr->DroppedCount = RecordPtr->DroppedCount;
+        memcpy(PayloadPtr->Entries, RecordPtr->Entries, sizeof(PayloadPtr->Entries));
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 CFE_ES_CmdStatsStart(void)
+{
+    if (!CFE_ES_Global.CmdStats.IsEnabled)
+    {
+        return 0;
+    }
+
+    return CFE_ES_GetTimebaseTicks(CFE_ES_Global.CmdStats.Low32Rollover);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_Enum_t Service,
+                           uint16                        StatsIndex,
+                           CFE_SB_MsgId_t                MsgId,
+                           CFE_MSG_FcnCode_t             FcnCode,
+                           uint64                        StartTicks)
+{
+    CFE_ES_CmdStatsRecord_t *RecordPtr;
+    CFE_ES_CmdStatsEntry_t  *EntryPtr;
+    uint64                   NowTicks;
+    uint32                   Usec;
+
+    if (!CFE_ES_Global.CmdStats.IsEnabled || Service >= CFE_ES_CmdStatsService_MAX)
+    {
+        return;
+    }
+
+    RecordPtr = &CFE_ES_Global.CmdStats.Services[Service];
+
+    if (StatsIndex >= CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES)
+    {
+        ++RecordPtr->DroppedCount;
+        return;
+    }
+
+    NowTicks = CFE_ES_GetTimebaseTicks(CFE_ES_Global.CmdStats.Low32Rollover);
+    Usec     = CFE_ES_TimebaseElapsedUsec(StartTicks, NowTicks, CFE_ES_Global.CmdStats.TicksPerSecond);
+    EntryPtr = &RecordPtr->Entries[StatsIndex];
+
+    /* A message without function codes uses one entry for any function code, this keeps the latest */
+    EntryPtr->MsgId   = MsgId;
+    EntryPtr->FcnCode = FcnCode;
+
+    ++EntryPtr->Count;
+    EntryPtr->TotalTime += Usec;
+
+    if (Usec > EntryPtr->MaxTime)
+    {
+        EntryPtr->MaxTime = Usec;
+    }
+}
@@ -0,0 +1,93 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Command execution statistics data structures
+ *
+ * Design Notes:
+ *   Each core service has its own table of entries, indexed by the statistics
+ *   index its command dispatch table assigns to each message and function code.
+ *   The entries of a service are only updated by the task of that service, so
+ *   no lock is needed.  The telemetry reads the entries without a lock, so the
+ *   counts of an entry may be slightly inconsistent with each other while a
+ *   command of the service is being handled.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_CMDSTATS_H
+#define CFE_ES_CMDSTATS_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_es_core_internal.h"
+#include "cfe_es_msg.h"
+
+/** @defgroup CFEESCmdStats Command Execution Statistics Data Structures
+ * @{
+ */
+
+/**
+ * @brief Command statistics of one core service
+ *
+ * All members are owned by the task of the service.
+ */
+typedef struct
+{
+    uint32                 DroppedCount; /* commands handled with a statistics index beyond the entries */
+    CFE_ES_CmdStatsEntry_t Entries[CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES];
+} CFE_ES_CmdStatsRecord_t;
+
+/**
+ * @brief Command statistics global state
+ */
+typedef struct
+{
+    bool                    IsEnabled;      /* set at startup, if configured and the timebase rate is known */
+    uint32                  TicksPerSecond; /* timebase tick rate */
+    uint32                  Low32Rollover;  /* rollover value of the lower timebase register, 0 if 2^32 */
+    CFE_ES_CmdStatsRecord_t Services[CFE_ES_CmdStatsService_MAX];
+} CFE_ES_CmdStatsGlobal_t;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initializes the command execution statistics
+ *
+ * Clears all entries and enables recording if #CFE_PLATFORM_ES_CMD_STATS_ENABLE
+ * is set and the PSP reports a timebase rate.  Must be called before any core
+ * service task is started.
+ */
+void CFE_ES_CmdStatsInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies the command statistics of one core service to a telemetry payload
+ *
+ * @param[in]  Service    The core service to copy the statistics of
+ * @param[out] PayloadPtr The telemetry payload to fill
+ */
+void CFE_ES_CmdStatsGetPayload(CFE_ES_CmdStatsService_Enum_t Service, CFE_ES_CmdStatsTlm_Payload_t *PayloadPtr);
+
+/** @} */
+
+#endif /* CFE_ES_CMDSTATS_H */
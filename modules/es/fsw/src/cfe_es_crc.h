@@ -21,7 +21,8 @@
  *  Implemention of the CRC algorithm(s) for CFE ES
  *
  *  Notes:
- *    Historically only CRC-16/ARC is defined, but this can be expanded.
+ *    Historically only CRC-16/ARC was defined, CRC-32 and CRC-32C are also
+ *    implemented now.  Algorithms are added as entries in the parameter table.
  *
  */
 
@@ -38,7 +39,19 @@ typedef uint32 (*const CFE_ES_ComputeCRC_Algo_t)(const void *DataPtr, size_t Dat
 
 typedef const struct CFE_ES_ComputeCRC_Params
 {
+    /**
+     * CRC register value at the start of the computation, as given in the
+     * catalog entry of the algorithm.  For informational purposes; the
+     * caller supplies the initial value as the InputCRC.
+     */
     uint32 InitialValue;
+
+    /**
+     * Value XOR'd into the CRC register on both entry and exit, so the
+     * result of one call can be passed as the InputCRC of the next call
+     * to compute a CRC across non-contiguous chunks.  Where this is the
+     * same as InitialValue, an InputCRC of 0 starts a new CRC.
+     */
     uint32 FinalXOR;
 
     /**
@@ -50,4 +63,26 @@ typedef const struct CFE_ES_ComputeCRC_Params
 
 CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t CrcType);
 
+/**
+ * Computes a reflected 16 bit CRC, slicing-by-8
+ *
+ * \param Table      Lookup tables for the polynomial, table N for a byte followed by N zero bytes
+ * \param DataPtr    Data to compute the CRC over
+ * \param DataLength Size of the data in bytes
+ * \param Crc        CRC register value to start from
+ * \returns CRC register value after the data
+ */
+uint16 CFE_ES_ComputeCRC_Slice8_16(const uint16 Table[8][256], const void *DataPtr, size_t DataLength, uint16 Crc);
+
+/**
+ * Computes a reflected 32 bit CRC, slicing-by-8
+ *
+ * \param Table      Lookup tables for the polynomial, table N for a byte followed by N zero bytes
+ * \param DataPtr    Data to compute the CRC over
+ * \param DataLength Size of the data in bytes
+ * \param Crc        CRC register value to start from
+ * \returns CRC register value after the data
+ */
+uint32 CFE_ES_ComputeCRC_Slice8_32(const uint32 Table[8][256], const void *DataPtr, size_t DataLength, uint32 Crc);
+
 #endif /* CFE_ES_CRC_H */
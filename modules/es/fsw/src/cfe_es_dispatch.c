@@ -32,236 +32,61 @@
 #include "cfe_es_verify.h"
 
 #include "cfe_config.h"
+#include "cfe_core_cmddispatch.h"
 
 #include <string.h>
 
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-bool CFE_ES_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
-{
-    bool              result       = true;
-    CFE_MSG_Size_t    ActualLength = 0;
-    CFE_MSG_FcnCode_t FcnCode      = 0;
-    CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
-
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
-
-    /*
-     ** Verify the command packet length
-     */
-    if (ExpectedLength != ActualLength)
-    {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
-
-        CFE_EVS_SendEvent(CFE_ES_LEN_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                          (unsigned int)FcnCode,
-                          (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
-        result = false;
-        CFE_ES_Global.TaskData.CommandErrorCounter++;
-    }
-
-    return result;
-}
-
-/*----------------------------------------------------------------
- *
- * Local Helper function
- *
- *-----------------------------------------------------------------*/
-void CFE_ES_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
-{
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
-    switch (CommandCode)
-    {
-        case CFE_ES_NOOP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_NoopCmd_t)))
-            {
-                CFE_ES_NoopCmd((const CFE_ES_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESET_COUNTERS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetCountersCmd_t)))
-            {
-                CFE_ES_ResetCountersCmd((const CFE_ES_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESTART_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_RestartCmd_t)))
-            {
-                CFE_ES_RestartCmd((const CFE_ES_RestartCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_START_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartAppCmd_t)))
-            {
-                CFE_ES_StartAppCmd((const CFE_ES_StartAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_STOP_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StopAppCmd_t)))
-            {
-                CFE_ES_StopAppCmd((const CFE_ES_StopAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESTART_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_RestartAppCmd_t)))
-            {
-                CFE_ES_RestartAppCmd((const CFE_ES_RestartAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RELOAD_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ReloadAppCmd_t)))
-            {
-                CFE_ES_ReloadAppCmd((const CFE_ES_ReloadAppCmd_t *)SBBufPtr);
-            }
-            break;
+/* local cache of runtime MsgIDs for ES */
+static CFE_SB_MsgId_t CFE_ES_CMD_MID_CACHE     = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_ES_SEND_HK_MID_CACHE = CFE_SB_MSGID_RESERVED;
 
-        case CFE_ES_QUERY_ONE_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryOneCmd_t)))
-            {
-                CFE_ES_QueryOneCmd((const CFE_ES_QueryOneCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_QUERY_ALL_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryAllCmd_t)))
-            {
-                CFE_ES_QueryAllCmd((const CFE_ES_QueryAllCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_QUERY_ALL_TASKS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryAllTasksCmd_t)))
-            {
-                CFE_ES_QueryAllTasksCmd((const CFE_ES_QueryAllTasksCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_CLEAR_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ClearSysLogCmd_t)))
-            {
-                CFE_ES_ClearSysLogCmd((const CFE_ES_ClearSysLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_WRITE_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteSysLogCmd_t)))
-            {
-                CFE_ES_WriteSysLogCmd((const CFE_ES_WriteSysLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_OVER_WRITE_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_OverWriteSysLogCmd_t)))
-            {
-                CFE_ES_OverWriteSysLogCmd((const CFE_ES_OverWriteSysLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_CLEAR_ER_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ClearERLogCmd_t)))
-            {
-                CFE_ES_ClearERLogCmd((const CFE_ES_ClearERLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_WRITE_ER_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteERLogCmd_t)))
-            {
-                CFE_ES_WriteERLogCmd((const CFE_ES_WriteERLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_START_PERF_DATA_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartPerfDataCmd_t)))
-            {
-                CFE_ES_StartPerfDataCmd((const CFE_ES_StartPerfDataCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_STOP_PERF_DATA_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StopPerfDataCmd_t)))
-            {
-                CFE_ES_StopPerfDataCmd((const CFE_ES_StopPerfDataCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_PERF_FILTER_MASK_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetPerfFilterMaskCmd_t)))
-            {
-                CFE_ES_SetPerfFilterMaskCmd((const CFE_ES_SetPerfFilterMaskCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_PERF_TRIGGER_MASK_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetPerfTriggerMaskCmd_t)))
-            {
-                CFE_ES_SetPerfTriggerMaskCmd((const CFE_ES_SetPerfTriggerMaskCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESET_PR_COUNT_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetPRCountCmd_t)))
-            {
-                CFE_ES_ResetPRCountCmd((const CFE_ES_ResetPRCountCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_MAX_PR_COUNT_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetMaxPRCountCmd_t)))
-            {
-                CFE_ES_SetMaxPRCountCmd((const CFE_ES_SetMaxPRCountCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_DELETE_CDS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_DeleteCDSCmd_t)))
-            {
-                CFE_ES_DeleteCDSCmd((const CFE_ES_DeleteCDSCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SEND_MEM_POOL_STATS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SendMemPoolStatsCmd_t)))
-            {
-                CFE_ES_SendMemPoolStatsCmd((const CFE_ES_SendMemPoolStatsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_DUMP_CDS_REGISTRY_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_DumpCDSRegistryCmd_t)))
-            {
-                CFE_ES_DumpCDSRegistryCmd((const CFE_ES_DumpCDSRegistryCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Invalid ground command code: ID = 0x%X, CC = %d",
-                              (unsigned int)CFE_ES_CMD_MID,
-                              (int)CommandCode);
-            CFE_ES_Global.TaskData.CommandErrorCounter++;
-            break;
-    }
-}
+/*
+ * Command dispatch table, indexed by function code
+ */
+static const CFE_CORE_CmdDispatchEntry_t CFE_ES_CMD_DISPATCH[] = {
+    [CFE_ES_NOOP_CC]               = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_NoopCmd_t, CFE_ES_NoopCmd),
+    [CFE_ES_RESET_COUNTERS_CC]     = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_ResetCountersCmd_t, CFE_ES_ResetCountersCmd),
+    [CFE_ES_RESTART_CC]            = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_RestartCmd_t, CFE_ES_RestartCmd),
+    [CFE_ES_START_APP_CC]          = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_StartAppCmd_t, CFE_ES_StartAppCmd),
+    [CFE_ES_STOP_APP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_StopAppCmd_t, CFE_ES_StopAppCmd),
+    [CFE_ES_RESTART_APP_CC]        = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_RestartAppCmd_t, CFE_ES_RestartAppCmd),
+    [CFE_ES_RELOAD_APP_CC]         = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_ReloadAppCmd_t, CFE_ES_ReloadAppCmd),
+    [CFE_ES_QUERY_ONE_CC]          = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_QueryOneCmd_t, CFE_ES_QueryOneCmd),
+    [CFE_ES_QUERY_ALL_CC]          = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_QueryAllCmd_t, CFE_ES_QueryAllCmd),
+    [CFE_ES_QUERY_ALL_TASKS_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_QueryAllTasksCmd_t, CFE_ES_QueryAllTasksCmd),
+    [CFE_ES_CLEAR_SYS_LOG_CC]      = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_ClearSysLogCmd_t, CFE_ES_ClearSysLogCmd),
+    [CFE_ES_WRITE_SYS_LOG_CC]      = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_WriteSysLogCmd_t, CFE_ES_WriteSysLogCmd),
+    [CFE_ES_OVER_WRITE_SYS_LOG_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_OverWriteSysLogCmd_t, CFE_ES_OverWriteSysLogCmd),
+    [CFE_ES_CLEAR_ER_LOG_CC]       = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_ClearERLogCmd_t, CFE_ES_ClearERLogCmd),
+    [CFE_ES_WRITE_ER_LOG_CC]       = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_WriteERLogCmd_t, CFE_ES_WriteERLogCmd),
+    [CFE_ES_WRITE_LOCK_PROFILE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_WriteLockProfileCmd_t, CFE_ES_WriteLockProfileCmd),
+    [CFE_ES_START_PERF_DATA_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_StartPerfDataCmd_t, CFE_ES_StartPerfDataCmd),
+    [CFE_ES_STOP_PERF_DATA_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_StopPerfDataCmd_t, CFE_ES_StopPerfDataCmd),
+    [CFE_ES_SET_PERF_FILTER_MASK_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_SetPerfFilterMaskCmd_t, CFE_ES_SetPerfFilterMaskCmd),
+    [CFE_ES_SET_PERF_TRIGGER_MASK_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_SetPerfTriggerMaskCmd_t, CFE_ES_SetPerfTriggerMaskCmd),
+    [CFE_ES_RESET_PR_COUNT_CC]   = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_ResetPRCountCmd_t, CFE_ES_ResetPRCountCmd),
+    [CFE_ES_SET_MAX_PR_COUNT_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_SetMaxPRCountCmd_t, CFE_ES_SetMaxPRCountCmd),
+    [CFE_ES_DELETE_CDS_CC]       = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_DeleteCDSCmd_t, CFE_ES_DeleteCDSCmd),
+    [CFE_ES_SEND_MEM_POOL_STATS_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_SendMemPoolStatsCmd_t, CFE_ES_SendMemPoolStatsCmd),
+    [CFE_ES_SEND_CMD_STATS_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_SendCmdStatsCmd_t, CFE_ES_SendCmdStatsCmd),
+    [CFE_ES_DUMP_CDS_REGISTRY_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_ES_DumpCDSRegistryCmd_t, CFE_ES_DumpCDSRegistryCmd),
+};
+
+/* The housekeeping request has no function codes and no length check */
+static const CFE_CORE_CmdDispatchEntry_t CFE_ES_SEND_HK_DISPATCH = CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_ES_SendHkCmd);
+
+/* Command statistics index of each message, after the one of the housekeeping request */
+static const CFE_CORE_CmdDispatchSlot_t CFE_ES_DISPATCH_SLOTS[] = {
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_ES_SEND_HK_MID_CACHE, CFE_ES_SEND_HK_DISPATCH, 0),
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_ES_CMD_MID_CACHE, CFE_ES_CMD_DISPATCH, 1),
+};
+
+static const CFE_CORE_CmdDispatchTable_t CFE_ES_DISPATCH_TABLE =
+    CFE_CORE_CMDDISPATCH_TABLE(CFE_ES_DISPATCH_SLOTS, CFE_ES_CmdStatsService_ES);
 
 /*----------------------------------------------------------------
  *
@@ -271,40 +96,54 @@ void CFE_ES_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
  *-----------------------------------------------------------------*/
 void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID     = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID = CFE_SB_MSGID_RESERVED;
-
-    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_HeaderView_t               HdrView;
+    const CFE_CORE_CmdDispatchEntry_t *EntryPtr;
+    uint16                             StatsIndex;
+    CFE_Status_t                       Status;
 
     /* cache the local MID Values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CMD_MID))
+    if (!CFE_SB_IsValidMsgId(CFE_ES_CMD_MID_CACHE))
     {
-        CMD_MID     = CFE_SB_ValueToMsgId(CFE_ES_CMD_MID);
-        SEND_HK_MID = CFE_SB_ValueToMsgId(CFE_ES_SEND_HK_MID);
+        CFE_ES_CMD_MID_CACHE     = CFE_SB_ValueToMsgId(CFE_ES_CMD_MID);
+        CFE_ES_SEND_HK_MID_CACHE = CFE_SB_ValueToMsgId(CFE_ES_SEND_HK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    /* Ignore return, buffer from SB is never NULL */
+    CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
 
-    if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
+    Status = CFE_CORE_CmdDispatch_Lookup(&CFE_ES_DISPATCH_TABLE, &HdrView, &EntryPtr, &StatsIndex);
+
+    if (Status == CFE_SUCCESS)
     {
-        /*
-        ** Housekeeping telemetry request
-        */
-        CFE_ES_SendHkCmd((const CFE_ES_SendHkCmd_t *)SBBufPtr);
+        /* Command handlers report their own errors */
+        CFE_CORE_CmdDispatch_Invoke(&CFE_ES_DISPATCH_TABLE, EntryPtr, StatsIndex, SBBufPtr, &HdrView);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, CMD_MID))
+    else if (Status == CFE_STATUS_WRONG_MSG_LENGTH)
     {
-        /*
-        ** ES task ground commands
-        */
-        CFE_ES_ProcessGroundCmd(SBBufPtr);
+        CFE_EVS_SendEvent(CFE_ES_LEN_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
+                          (unsigned int)CFE_SB_MsgIdToValue(CFE_MSG_HeaderView_GetMsgId(&HdrView)),
+                          (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView),
+                          (unsigned int)CFE_MSG_HeaderView_GetSize(&HdrView),
+                          (unsigned int)EntryPtr->ExpectedLength);
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else if (Status == CFE_STATUS_BAD_COMMAND_CODE)
+    {
+        CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid ground command code: ID = 0x%X, CC = %d",
+                          (unsigned int)CFE_ES_CMD_MID,
+                          (int)CFE_MSG_HeaderView_GetFcnCode(&HdrView));
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
     }
     else
     {
         CFE_EVS_SendEvent(CFE_ES_MID_ERR_EID,
                           CFE_EVS_EventType_ERROR,
                           "Invalid command pipe message ID: 0x%X",
-                          (unsigned int)CFE_SB_MsgIdToValue(MessageID));
+                          (unsigned int)CFE_SB_MsgIdToValue(CFE_MSG_HeaderView_GetMsgId(&HdrView)));
         CFE_ES_Global.TaskData.CommandErrorCounter++;
     }
 }
@@ -53,6 +53,7 @@ static const EdsDispatchTable_EdsComponent_CFE_ES_Application_CFE_SB_Telecommand
         .OverWriteSysLogCmd_indication    = CFE_ES_OverWriteSysLogCmd,
         .ClearERLogCmd_indication         = CFE_ES_ClearERLogCmd,
         .WriteERLogCmd_indication         = CFE_ES_WriteERLogCmd,
+        .WriteLockProfileCmd_indication   = CFE_ES_WriteLockProfileCmd,
         .StartPerfDataCmd_indication      = CFE_ES_StartPerfDataCmd,
         .StopPerfDataCmd_indication       = CFE_ES_StopPerfDataCmd,
         .SetPerfFilterMaskCmd_indication  = CFE_ES_SetPerfFilterMaskCmd,
@@ -61,6 +62,7 @@ static const EdsDispatchTable_EdsComponent_CFE_ES_Application_CFE_SB_Telecommand
         .SetMaxPRCountCmd_indication      = CFE_ES_SetMaxPRCountCmd,
         .DeleteCDSCmd_indication          = CFE_ES_DeleteCDSCmd,
         .SendMemPoolStatsCmd_indication   = CFE_ES_SendMemPoolStatsCmd,
+        .SendCmdStatsCmd_indication       = CFE_ES_SendCmdStatsCmd,
         .DumpCDSRegistryCmd_indication    = CFE_ES_DumpCDSRegistryCmd,
     },
     .SEND_HK =
@@ -78,10 +80,11 @@ static const EdsDispatchTable_EdsComponent_CFE_ES_Application_CFE_SB_Telecommand
  *-----------------------------------------------------------------*/
 void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    int32             Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_Size_t    MsgSize;
-    CFE_MSG_FcnCode_t MsgFc;
+    int32                Status;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_MSG_Size_t       MsgSize;
+    CFE_MSG_FcnCode_t    MsgFc;
+    CFE_MSG_HeaderView_t HdrView;
 
     Status = EdsDispatch_EdsComponent_CFE_ES_Application_Telecommand(SBBufPtr, &CFE_ES_TC_DISPATCH_TABLE);
 
@@ -89,9 +92,10 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
     if (Status == CFE_STATUS_BAD_COMMAND_CODE || Status == CFE_STATUS_WRONG_MSG_LENGTH
         || Status == CFE_STATUS_UNKNOWN_MSG_ID)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+        CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+        MsgId   = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+        MsgFc   = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
+        MsgSize = CFE_MSG_HeaderView_GetSize(&HdrView);
 
         CFE_ES_Global.TaskData.CommandErrorCounter++;
 
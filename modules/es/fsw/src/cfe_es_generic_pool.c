@@ -45,22 +45,66 @@
 
 /*----------------------------------------------------------------
  *
- * Internal helper routine only, not part of API.
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
- * Find the appropriate bucket given a requested block size
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolSizeClass(size_t Size)
+{
+    uint16 SizeClass;
+    uint16 Shift;
+    size_t Value;
+
+    if (Size <= 1)
+    {
+        return 0;
+    }
+
+    /*
+     * Binary search for the highest set bit of (Size - 1).  This takes
+     * a fixed number of steps for a given size_t width, and the initial
+     * shift of half the width keeps every shift in range.
+     */
+    Value     = Size - 1;
+    SizeClass = 0;
+    Shift     = sizeof(size_t) * 4;
+    while (Shift > 0)
+    {
+        if ((Value >> Shift) != 0)
+        {
+            Value >>= Shift;
+            SizeClass += Shift;
+        }
+        Shift >>= 1;
+    }
+
+    /* Value is now exactly 1, which accounts for the highest bit itself */
+    return SizeClass + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
 uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Every bucket before the start of this size class is too small,
+     * so only the (few) buckets within the class need to be checked.
+     */
+    Index = PoolRecPtr->SizeClassStart[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets)
     {
         if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
         {
             /* it fits - stop here */
             break;
         }
+        ++Index;
     }
 
     /*
@@ -247,6 +291,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t    *PoolRecPtr,
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    uint16                  Index;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     if (NumBlockSizes == 0)
@@ -331,6 +376,21 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t    *PoolRecPtr,
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class lookup table.  For each class, record the
+     * first bucket whose block size is not entirely below that class.
+     * Buckets are sorted, so this is a single forward pass.
+     */
+    Index = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        while (Index < NumBlockSizes && CFE_ES_GenPoolSizeClass(PoolRecPtr->Buckets[Index].BlockSize) < i)
+        {
+            ++Index;
+        }
+        PoolRecPtr->SizeClassStart[i] = Index;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -404,6 +464,20 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOf
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GenPoolGetBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset)
+{
+    return CFE_ES_GenPoolGetBlockSizeInRange(PoolRecPtr, BlockSizePtr, BlockOffset, PoolRecPtr->TailPosition);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolGetBlockSizeInRange(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+                                        size_t                 *BlockSizePtr,
+                                        size_t                  BlockOffset,
+                                        size_t                  TailPosition)
 {
     size_t                  DescOffset;
     CFE_ES_GenPoolBucket_t *BucketPtr;
@@ -411,7 +485,7 @@ int32 CFE_ES_GenPoolGetBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *Blo
     int32                   Status;
     uint16                  BucketId;
 
-    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    if (BlockOffset >= TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
     {
         /* outside the bounds of the pool */
         return CFE_ES_BUFFER_NOT_IN_POOL;
@@ -49,6 +49,13 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of entries in the size class lookup table.  Each class covers
+ * request sizes in the range (2^(N-1), 2^N], so one class is needed for
+ * every bit in a size_t, plus one for requests of 0 or 1 bytes.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES ((sizeof(size_t) * 8) + 1)
+
 /*
 ** Type Definitions
 */
@@ -116,6 +123,12 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * First bucket index that may satisfy a request in each size class,
+     * built at init time so bucket lookup does not scan the whole list.
+     */
+    uint16 SizeClassStart[CFE_ES_GENERIC_POOL_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
@@ -150,6 +163,39 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t    *PoolRecPtr,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc,
                                CFE_ES_PoolCommit_Func_t   CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Compute the size class of a block or request size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * The size class is the number of bits needed to represent (Size - 1),
+ * i.e. the base 2 logarithm of Size rounded up.  Sizes of 0 and 1 are
+ * both in class 0.
+ *
+ * \param[in]    Size            Block or request size in bytes
+ *
+ * \return Size class, always less than #CFE_ES_GENERIC_POOL_SIZE_CLASSES
+ */
+uint16 CFE_ES_GenPoolSizeClass(size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the appropriate bucket given a requested block size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * Uses the size class table built by CFE_ES_GenPoolInitialize() to
+ * start the search at the first bucket that could fit the request, so
+ * at most the buckets within a single size class are examined.
+ *
+ * \param[in]    PoolRecPtr      Pointer to pool structure
+ * \param[in]    ReqSize         Size of block requested
+ *
+ * \return Bucket ID of the smallest bucket that fits, or 0 if none fit
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -253,6 +299,25 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr);
  */
 int32 CFE_ES_GenPoolGetBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get size of pool block, given the pool tail position
+ *
+ * Same as CFE_ES_GenPoolGetBlockSize(), except that the block offset is checked
+ * against the given tail position instead of the one in the pool structure.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockSizePtr   Location to output original allocation size
+ * \param[in]    BlockOffset    Offset of data block
+ * \param[in]    TailPosition   Tail position of the pool to check the offset against
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolGetBlockSizeInRange(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+                                        size_t                 *BlockSizePtr,
+                                        size_t                  BlockOffset,
+                                        size_t                  TailPosition);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Validate a pool structure
@@ -117,6 +117,11 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Command statistics telemetry
+    */
+    CFE_ES_CmdStatsTlm_t CmdStatsPacket;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
@@ -205,6 +210,27 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * Persistent state data associated with performance log streaming
+     */
+    CFE_ES_PerfStreamGlobal_t BackgroundPerfStreamState;
+
+    /*
+     * Per-task performance marker rings, indexed by OSAL task index
+     */
+    CFE_ES_PerfTaskRing_t PerfTaskRing[OS_MAX_TASKS];
+
+    /*
+     * Lock contention profile, and the state of its file dump
+     */
+    CFE_ES_LockProfileGlobal_t     LockProfile;
+    CFE_ES_LockProfileDumpGlobal_t BackgroundLockProfileDumpState;
+
+    /*
+     * Command execution statistics of the core services
+     */
+    CFE_ES_CmdStatsGlobal_t CmdStats;
+
     /*
      * Persistent state data associated with background app table scans
      */
@@ -0,0 +1,368 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_es_lockprof.c
+**
+** Purpose: This file contains the functions that implement the lock
+**  contention profiler for the core shared data locks.
+**
+*/
+
+/*
+** Include Section
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+
+/*
+ * Names of the profiled locks, as written to the profile file
+ */
+static const char *const CFE_ES_LockProfileNames[CFE_ES_LockProfileId_MAX] = {
+    [CFE_ES_LockProfileId_ES_SHARED_DATA] = "ES_SHARED_DATA",
+    [CFE_ES_LockProfileId_SB_SHARED_DATA] = "SB_SHARED_DATA",
+    [CFE_ES_LockProfileId_FS_SHARED_DATA] = "FS_SHARED_DATA",
+    [CFE_ES_LockProfileId_TBL_REGISTRY]   = "TBL_REGISTRY",
+};
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finds the record for the place a lock is taken from, assigning
+ * an unused record on first use.  Returns NULL if all are in use.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_LockProfileSite_t *CFE_ES_LockProfileFindSite(CFE_ES_LockProfileRecord_t *RecordPtr,
+                                                            const char                 *FunctionName,
+                                                            int32                       LineNumber)
+{
+    CFE_ES_LockProfileSite_t *SitePtr;
+    uint32                    Index;
+    uint32                    Probes;
+
+    /*
+     * Open addressing with linear probing, records are never removed.
+     * The function name strings are constant, so comparing the address is enough.
+     */
+    Index = ((uint32)((cpuaddr)FunctionName >> 2) + ((uint32)LineNumber * 31)) % CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES;
+
+    for (Probes = 0; Probes < CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES; ++Probes)
+    {
+        SitePtr = &RecordPtr->Sites[Index];
+
+        if (SitePtr->FunctionName == NULL)
+        {
+            /* Set the name last, it marks the record as in use for the file dump */
+            SitePtr->LineNumber   = LineNumber;
+            SitePtr->FunctionName = FunctionName;
+            return SitePtr;
+        }
+
+        if (SitePtr->FunctionName == FunctionName && SitePtr->LineNumber == LineNumber)
+        {
+            return SitePtr;
+        }
+
+        ++Index;
+        if (Index >= CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES)
+        {
+            Index = 0;
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileInit(void)
+{
+    CFE_ES_LockProfileGlobal_t *ProfPtr;
+
+    ProfPtr = &CFE_ES_Global.LockProfile;
+
+    memset(ProfPtr, 0, sizeof(*ProfPtr));
+
+    ProfPtr->TicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+    ProfPtr->Low32Rollover  = CFE_PSP_GetTimerLow32Rollover();
+    ProfPtr->IsEnabled      = (CFE_PLATFORM_ES_LOCK_PROFILE_ENABLE && ProfPtr->TicksPerSecond != 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileTimes_Add(CFE_ES_LockProfileTimes_t *TimesPtr, uint32 Usec)
+{
+    uint32 BinIdx;
+    uint32 Remaining;
+
+    /* The bin is the number of significant bits, so bin N holds [2^(N-1), 2^N) */
+    BinIdx    = 0;
+    Remaining = Usec;
+    while (Remaining != 0 && BinIdx < (CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS - 1))
+    {
+        Remaining >>= 1;
+        ++BinIdx;
+    }
+
+    ++TimesPtr->Bin[BinIdx];
+    ++TimesPtr->Count;
+    TimesPtr->TotalTime += Usec;
+
+    if (Usec > TimesPtr->MaxTime)
+    {
+        TimesPtr->MaxTime = Usec;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 CFE_ES_LockProfileWaitStart(void)
+{
+    if (!CFE_ES_Global.LockProfile.IsEnabled)
+    {
+        return 0;
+    }
+
+    return CFE_ES_GetTimebaseTicks(CFE_ES_Global.LockProfile.Low32Rollover);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId,
+                                const char            *FunctionName,
+                                int32                  LineNumber,
+                                uint64                 WaitStartTicks)
+{
+    CFE_ES_LockProfileRecord_t *RecordPtr;
+    CFE_ES_LockProfileSite_t   *SitePtr;
+    uint64                      NowTicks;
+
+    if (!CFE_ES_Global.LockProfile.IsEnabled || LockId >= CFE_ES_LockProfileId_MAX)
+    {
+        return;
+    }
+
+    RecordPtr = &CFE_ES_Global.LockProfile.Locks[LockId];
+
+    /* A nested take by the task already holding the lock never waits, and does not start a new hold */
+    ++RecordPtr->Depth;
+    if (RecordPtr->Depth > 1)
+    {
+        return;
+    }
+
+    NowTicks = CFE_ES_GetTimebaseTicks(CFE_ES_Global.LockProfile.Low32Rollover);
+    SitePtr  = NULL;
+    if (FunctionName != NULL)
+    {
+        SitePtr = CFE_ES_LockProfileFindSite(RecordPtr, FunctionName, LineNumber);
+    }
+
+    if (SitePtr != NULL)
+    {
+        CFE_ES_LockProfileTimes_Add(
+            &SitePtr->Wait,
+            CFE_ES_TimebaseElapsedUsec(WaitStartTicks, NowTicks, CFE_ES_Global.LockProfile.TicksPerSecond));
+    }
+    else
+    {
+        ++RecordPtr->DroppedCount;
+    }
+
+    RecordPtr->HolderSitePtr = SitePtr;
+    RecordPtr->AcquireTicks  = NowTicks;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_t LockId)
+{
+    CFE_ES_LockProfileRecord_t *RecordPtr;
+    uint64                      NowTicks;
+
+    if (!CFE_ES_Global.LockProfile.IsEnabled || LockId >= CFE_ES_LockProfileId_MAX)
+    {
+        return;
+    }
+
+    RecordPtr = &CFE_ES_Global.LockProfile.Locks[LockId];
+
+    /* Ignore an unbalanced release, the give itself will fail and be reported */
+    if (RecordPtr->Depth == 0)
+    {
+        return;
+    }
+
+    --RecordPtr->Depth;
+    if (RecordPtr->Depth == 0 && RecordPtr->HolderSitePtr != NULL)
+    {
+        NowTicks = CFE_ES_GetTimebaseTicks(CFE_ES_Global.LockProfile.Low32Rollover);
+        CFE_ES_LockProfileTimes_Add(
+            &RecordPtr->HolderSitePtr->Hold,
+            CFE_ES_TimebaseElapsedUsec(RecordPtr->AcquireTicks, NowTicks, CFE_ES_Global.LockProfile.TicksPerSecond));
+        RecordPtr->HolderSitePtr = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_LockProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_LockProfileDumpGlobal_t *BgFilePtr;
+    CFE_ES_LockProfileFileEntry_t  *EntryPtr;
+    CFE_ES_LockProfileRecord_t     *RecordPtr;
+    CFE_ES_LockProfileSite_t       *SitePtr;
+    const char                     *FunctionName;
+    uint32                          LockIdx;
+    uint32                          SiteIdx;
+    bool                            IsValid;
+
+    BgFilePtr = (CFE_ES_LockProfileDumpGlobal_t *)Meta;
+    EntryPtr  = &BgFilePtr->EntryBuffer;
+    IsValid   = false;
+
+    LockIdx = RecordNum / (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+    SiteIdx = RecordNum % (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+
+    if (LockIdx < CFE_ES_LockProfileId_MAX)
+    {
+        /* First wipe the buffer before re-use */
+        memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+        RecordPtr = &CFE_ES_Global.LockProfile.Locks[LockIdx];
+        strncpy(EntryPtr->LockName, CFE_ES_LockProfileNames[LockIdx], sizeof(EntryPtr->LockName) - 1);
+
+        /*
+         * The records are read without taking the lock they belong to, as this
+         * would distort the profile of that lock.  A record may be updated while
+         * it is copied, which is acceptable for statistics.
+         */
+        if (SiteIdx < CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES)
+        {
+            SitePtr      = &RecordPtr->Sites[SiteIdx];
+            FunctionName = SitePtr->FunctionName;
+            if (FunctionName != NULL)
+            {
+                strncpy(EntryPtr->FunctionName, FunctionName, sizeof(EntryPtr->FunctionName) - 1);
+                EntryPtr->LineNumber = SitePtr->LineNumber;
+                EntryPtr->Wait       = SitePtr->Wait;
+                EntryPtr->Hold       = SitePtr->Hold;
+                IsValid              = true;
+            }
+        }
+        else if (RecordPtr->DroppedCount != 0)
+        {
+            /* Takes from places that could not be recorded, with no name */
+            EntryPtr->Wait.Count = RecordPtr->DroppedCount;
+            IsValid              = true;
+        }
+    }
+
+    if (IsValid)
+    {
+        *Buffer  = EntryPtr;
+        *BufSize = sizeof(*EntryPtr);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= ((CFE_ES_LockProfileId_MAX * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1)) - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileEventHandler(void                   *Meta,
+                                    CFE_FS_FileWriteEvent_t Event,
+                                    int32                   Status,
+                                    uint32                  RecordNum,
+                                    size_t                  BlockSize,
+                                    size_t                  Position)
+{
+    CFE_ES_LockProfileDumpGlobal_t *BgFilePtr;
+
+    BgFilePtr = (CFE_ES_LockProfileDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_EID,
+                              CFE_EVS_EventType_DEBUG,
+                              "%s written:Size=%lu,Enabled=%d",
+                              BgFilePtr->FileWrite.FileName,
+                              (unsigned long)Position,
+                              (int)CFE_ES_Global.LockProfile.IsEnabled);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u",
+                              BgFilePtr->FileWrite.FileName,
+                              (int)BlockSize,
+                              (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error creating file %s, RC = %d",
+                              BgFilePtr->FileWrite.FileName,
+                              (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
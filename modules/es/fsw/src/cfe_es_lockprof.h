@@ -0,0 +1,142 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Lock contention profiler data structures
+ *
+ * Design Notes:
+ *   Each profiled lock has its own table of records, one per place (function
+ *   and line) the lock is taken from.  The records of a lock are only updated
+ *   by the task currently holding that lock, so the lock itself serializes the
+ *   updates and the profiler needs no lock of its own.  The file dump reads the
+ *   records without taking the locks, so the counts of a record may be slightly
+ *   inconsistent with each other while the lock is in use.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_LOCKPROF_H
+#define CFE_ES_LOCKPROF_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_es_core_internal.h"
+#include "cfe_es_extern_typedefs.h"
+#include "cfe_fs_api_typedefs.h"
+
+/** @defgroup CFEESLockProfile Lock Contention Profiler Data Structures
+ * @{
+ */
+
+/**
+ * @brief Lock profile record for one place a lock is taken from
+ */
+typedef struct
+{
+    const char               *FunctionName; /* function the lock is taken from, compared by address, NULL if unused */
+    int32                     LineNumber;   /* line the lock is taken from, 0 if not known */
+    CFE_ES_LockProfileTimes_t Wait;         /* time spent waiting to take the lock */
+    CFE_ES_LockProfileTimes_t Hold;         /* time the lock was held for, from the outermost take */
+} CFE_ES_LockProfileSite_t;
+
+/**
+ * @brief Lock profile state of one lock
+ *
+ * All members are owned by the task holding the lock.
+ */
+typedef struct
+{
+    uint32                    Depth;         /* number of nested takes by the task holding the lock */
+    uint64                    AcquireTicks;  /* timebase when the outermost take completed */
+    CFE_ES_LockProfileSite_t *HolderSitePtr; /* record of the outermost take, NULL if not recorded */
+    uint32                    DroppedCount;  /* takes from places that could not be recorded, all records in use */
+    CFE_ES_LockProfileSite_t  Sites[CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES];
+} CFE_ES_LockProfileRecord_t;
+
+/**
+ * @brief Lock profile global state
+ */
+typedef struct
+{
+    bool                       IsEnabled;      /* set at startup, if configured and the timebase rate is known */
+    uint32                     TicksPerSecond; /* timebase tick rate */
+    uint32                     Low32Rollover;  /* rollover value of the lower timebase register, 0 if 2^32 */
+    CFE_ES_LockProfileRecord_t Locks[CFE_ES_LockProfileId_MAX];
+} CFE_ES_LockProfileGlobal_t;
+
+/**
+ * @brief Lock profile file dump state structure
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t    FileWrite;   /* FS state data - must be first */
+    CFE_ES_LockProfileFileEntry_t EntryBuffer; /* Temp holding area for record to write */
+} CFE_ES_LockProfileDumpGlobal_t;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initializes the lock contention profiler
+ *
+ * Clears all records and enables the profiler if #CFE_PLATFORM_ES_LOCK_PROFILE_ENABLE
+ * is set and the PSP reports a timebase rate.  Must be called before any of the
+ * profiled locks are used.
+ */
+void CFE_ES_LockProfileInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds one time to lock profile time statistics
+ *
+ * @param[inout] TimesPtr Time statistics to add to
+ * @param[in]    Usec     Time to add, in microseconds
+ */
+void CFE_ES_LockProfileTimes_Add(CFE_ES_LockProfileTimes_t *TimesPtr, uint32 Usec);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the data for one record of the lock profile file
+ *
+ * There are #CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1 records for each lock,
+ * one for each place the lock was taken from, then one for the number of takes
+ * that could not be recorded.  Records that are not in use are skipped.
+ *
+ * @sa CFE_FS_FileWriteGetData_t
+ */
+bool CFE_ES_LockProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Event handler for the lock profile file
+ *
+ * @sa CFE_FS_FileWriteOnEvent_t
+ */
+void CFE_ES_LockProfileEventHandler(void                   *Meta,
+                                    CFE_FS_FileWriteEvent_t Event,
+                                    int32                   Status,
+                                    uint32                  RecordNum,
+                                    size_t                  BlockSize,
+                                    size_t                  Position);
+
+/** @} */
+
+#endif /* CFE_ES_LOCKPROF_H */
@@ -211,6 +211,24 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID,
                                                const size_t       *BlockSizes,
                                                bool                UseMutex,
                                                size_t              Alignment)
+{
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, Alignment, false);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID,
+                           void               *MemPtr,
+                           size_t              Size,
+                           uint16              NumBlockSizes,
+                           const size_t       *BlockSizes,
+                           bool                UseMutex,
+                           size_t              Alignment,
+                           bool                IsConcurrent)
 {
     int32                   OsStatus;
     int32                   Status;
@@ -371,6 +389,15 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID,
          */
         CFE_ES_GetAppID(&PoolRecPtr->OwnerAppID);
 
+        /*
+         * The free stacks of a concurrent pool are already empty, as the
+         * entry was cleared.  The tail and the stacks are used without any
+         * lock once the ID is stored, so complete their setup first.
+         */
+        PoolRecPtr->IsConcurrent = IsConcurrent;
+        CFE_CORE_AtomicStoreU64(&PoolRecPtr->TailPosition, PoolRecPtr->Pool.TailPosition);
+        CFE_CORE_RELEASE_FENCE();
+
         /*
          * Store the actual/correct pool ID in the record.
          */
@@ -393,6 +420,39 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID,
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateConcurrent(CFE_ES_MemHandle_t *PoolID,
+                                         void               *MemPtr,
+                                         size_t              Size,
+                                         uint16              NumBlockSizes,
+                                         const size_t       *BlockSizes)
+{
+    /* Offsets of blocks on the free stacks must fit in 32 bits */
+    if ((uint64)Size > CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK)
+    {
+        CFE_ES_WriteToSysLog("%s: Pool size(%lu) too large for a concurrent pool\n", __func__, (unsigned long)Size);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /*
+     * The pool mutex is only used for carving new blocks from the pool tail.
+     * Without atomic operations this is a regular mutex-protected pool.
+     */
+    return CFE_ES_MemPoolCreate(PoolID,
+                                MemPtr,
+                                Size,
+                                NumBlockSizes,
+                                BlockSizes,
+                                CFE_ES_USE_MUTEX,
+                                ALIGN_OF(CFE_ES_PoolAlign_t),
+                                CFE_CORE_ATOMICS_AVAILABLE);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -477,30 +537,38 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (CFE_ES_MemPoolIsConcurrent(PoolRecPtr))
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        /* Concurrent pools take the pool mutex only when needed */
+        Status = CFE_ES_MemPoolGetBlockConcurrent(PoolRecPtr, &DataOffset, Size);
     }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /* If not successful, return error now */
@@ -541,26 +609,34 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+    if (CFE_ES_MemPoolIsConcurrent(PoolRecPtr))
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        /* Concurrent pools take the pool mutex only when needed */
+        Status = CFE_ES_MemPoolGetBlockSizeConcurrent(PoolRecPtr, &DataSize, DataOffset);
     }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
-
-    Status = CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, &DataSize, DataOffset);
+        Status = CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     if (Status == CFE_SUCCESS)
@@ -603,32 +679,40 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+    if (CFE_ES_MemPoolIsConcurrent(PoolRecPtr))
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        /* Concurrent pools take the pool mutex only when needed */
+        Status = CFE_ES_MemPoolPutBlockConcurrent(PoolRecPtr, &DataSize, DataOffset);
     }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
-
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /*
@@ -663,10 +747,12 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHandle_t Handle)
 {
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    uint16                  NumBuckets;
-    uint16                  Idx;
+    CFE_ES_AppId_t             AppId;
+    CFE_ES_MemPoolRecord_t    *PoolRecPtr;
+    CFE_ES_MemPoolFreeStack_t *StackPtr;
+    uint32                     RecycleCount;
+    uint16                     NumBuckets;
+    uint16                     Idx;
 
     if (BufPtr == NULL)
     {
@@ -709,6 +795,19 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
     {
         CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
 
+        /*
+         * Blocks returned to a concurrent pool are counted by its free stacks.
+         * A block is counted as released before it is pushed, so reading the
+         * recycle count first never gives more recycled than released blocks.
+         */
+        if (CFE_ES_MemPoolIsConcurrent(PoolRecPtr) && NumBuckets > 0)
+        {
+            StackPtr     = &PoolRecPtr->FreeStack[NumBuckets - 1];
+            RecycleCount = CFE_CORE_AtomicLoadU32(&StackPtr->RecycleCount);
+
+            BufPtr->BlockStats[Idx].NumFree = CFE_CORE_AtomicLoadU32(&StackPtr->ReleaseCount) - RecycleCount;
+        }
+
         if (NumBuckets > 0)
         {
             --NumBuckets;
@@ -761,3 +860,196 @@ bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t Handle)
 
     return true;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolPopFreeBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr,
+                                 uint16                  BucketId,
+                                 size_t                  NewSize,
+                                 size_t                 *DataOffsetPtr)
+{
+    CFE_ES_MemPoolFreeStack_t *StackPtr;
+    CFE_ES_GenPoolBD_t        *BdPtr;
+    size_t                     DataOffset;
+    uint64                     Top;
+    uint64                     NewTop;
+    uint64                     PrevTop;
+
+    StackPtr = &PoolRecPtr->FreeStack[BucketId - 1];
+
+    Top = CFE_CORE_AtomicLoadU64(&StackPtr->Top);
+    while (true)
+    {
+        DataOffset = (size_t)(Top & CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK);
+        if (DataOffset == 0)
+        {
+            /* no buffers in pool to recycle */
+            return CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+
+        CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+
+        /*
+         * The descriptor may be changed by another task that popped the block
+         * after the top was read.  In that case the top has changed as well,
+         * so the compare and swap fails and the descriptor is not used.
+         */
+        if (BdPtr->CheckBits == CFE_ES_CHECK_PATTERN && BdPtr->Allocated == (CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            NewTop  = (Top & ~CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK) + CFE_ES_MEMPOOL_FREE_STACK_TAG_INCR;
+            NewTop |= (uint64)BdPtr->NextOffset;
+            if (CFE_CORE_AtomicCompareSwapU64(&StackPtr->Top, &Top, NewTop))
+            {
+                break;
+            }
+        }
+        else
+        {
+            /* sanity check failed - possible pool corruption, unless the top has changed */
+            PrevTop = Top;
+            Top     = CFE_CORE_AtomicLoadU64(&StackPtr->Top);
+            if (Top == PrevTop)
+            {
+                return CFE_ES_BUFFER_NOT_IN_POOL;
+            }
+        }
+    }
+
+    /* The block is now owned by the caller */
+    BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+    BdPtr->ActualSize = NewSize;
+    BdPtr->NextOffset = 0;
+
+    CFE_CORE_AtomicIncrementU32(&StackPtr->RecycleCount);
+
+    *DataOffsetPtr = DataOffset;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolPushFreeBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t DataOffset)
+{
+    CFE_ES_MemPoolFreeStack_t *StackPtr;
+    CFE_ES_GenPoolBD_t        *BdPtr;
+    uint64                     Top;
+    uint64                     NewTop;
+
+    StackPtr = &PoolRecPtr->FreeStack[BucketId - 1];
+
+    CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+
+    BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+
+    /* Counted first, so statistics never see more recycled than released blocks */
+    CFE_CORE_AtomicIncrementU32(&StackPtr->ReleaseCount);
+
+    Top = CFE_CORE_AtomicLoadU64(&StackPtr->Top);
+    do
+    {
+        BdPtr->NextOffset = (size_t)(Top & CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK);
+
+        NewTop  = (Top & ~CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK) + CFE_ES_MEMPOOL_FREE_STACK_TAG_INCR;
+        NewTop |= (uint64)DataOffset;
+    } while (!CFE_CORE_AtomicCompareSwapU64(&StackPtr->Top, &Top, NewTop));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolGetBlockConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size)
+{
+    int32  Status;
+    uint16 BucketId;
+
+    /* The bucket list does not change after creation, so this needs no lock */
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+    if (BucketId == 0)
+    {
+        /* Let the generic routine report the error */
+        return CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, DataOffsetPtr, Size);
+    }
+
+    /* first attempt to recycle any buffers from the same bucket that were freed */
+    Status = CFE_ES_MemPoolPopFreeBlock(PoolRecPtr, BucketId, Size, DataOffsetPtr);
+    if (Status != CFE_SUCCESS)
+    {
+        /*
+         * recycling not available - make a new one instead.
+         * This moves the pool tail, which is shared by all buckets.
+         */
+        OS_MutSemTake(PoolRecPtr->MutexId);
+        Status = CFE_ES_GenPoolCreatePoolBlock(&PoolRecPtr->Pool, BucketId, Size, DataOffsetPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_CORE_AtomicStoreU64(&PoolRecPtr->TailPosition, PoolRecPtr->Pool.TailPosition);
+        }
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolGetBlockSizeConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    size_t TailPosition;
+
+    /*
+     * The tail never moves back.  A block being looked up by the caller was
+     * created before this call, so it is below the tail read here.
+     */
+    TailPosition = (size_t)CFE_CORE_AtomicLoadU64(&PoolRecPtr->TailPosition);
+
+    return CFE_ES_GenPoolGetBlockSizeInRange(&PoolRecPtr->Pool, DataSizePtr, DataOffset, TailPosition);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolPutBlockConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    int32               Status;
+    CFE_ES_GenPoolBD_t *BdPtr;
+
+    /*
+     * A block that was allocated has the same valid descriptor as for a size
+     * lookup.  Two tasks putting the same block at the same time is not
+     * detected, as the descriptor is not changed atomically.
+     */
+    Status = CFE_ES_MemPoolGetBlockSizeConcurrent(PoolRecPtr, DataSizePtr, DataOffset);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_MemPoolDirectRetrieve(&PoolRecPtr->Pool, DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        CFE_ES_MemPoolPushFreeBlock(PoolRecPtr, BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED, DataOffset);
+    }
+    else if (Status == CFE_ES_POOL_BLOCK_INVALID)
+    {
+        /* The count is for the whole pool, so it is kept under the pool mutex */
+        OS_MutSemTake(PoolRecPtr->MutexId);
+        ++PoolRecPtr->Pool.ValidationErrorCount;
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    return Status;
+}
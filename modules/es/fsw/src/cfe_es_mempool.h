@@ -34,6 +34,28 @@
 #include "common_types.h"
 #include "cfe_resourceid.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_core_atomic.h"
+
+/*
+ * The top of a free stack holds the offset of its first block in the lower
+ * 32 bits, and a count of changes in the upper 32 bits.
+ */
+#define CFE_ES_MEMPOOL_FREE_STACK_OFFSET_MASK ((uint64)0xFFFFFFFF)
+#define CFE_ES_MEMPOOL_FREE_STACK_TAG_INCR    ((uint64)0x100000000)
+
+/**
+ * Lock-free stack of the blocks of one bucket that were returned to a
+ * concurrent pool, linked by the NextOffset field of the block descriptors.
+ *
+ * The count in the top is changed with every push and pop, so a pop fails
+ * if the block it read was popped and pushed again in the meantime (ABA).
+ */
+typedef struct
+{
+    CFE_CORE_AtomicU64_t Top;          /**< Offset of the first block and change count */
+    CFE_CORE_AtomicU32_t ReleaseCount; /**< Total number of blocks pushed */
+    CFE_CORE_AtomicU32_t RecycleCount; /**< Total number of blocks popped */
+} CFE_ES_MemPoolFreeStack_t;
 
 typedef struct
 {
@@ -67,8 +89,28 @@ typedef struct
 
     /**
      * Optional Mutex for serializing get/put operations
+     *
+     * For concurrent pools this only serializes carving new blocks
+     * from the pool tail.
      */
     osal_id_t MutexId;
+
+    /**
+     * Set for pools created with CFE_ES_PoolCreateConcurrent(), where returned
+     * blocks go to the free stacks below instead of those of the generic pool.
+     */
+    bool IsConcurrent;
+
+    /**
+     * Tail position of a concurrent pool, for checking blocks without the
+     * pool mutex.  This is stored under the pool mutex after the tail moves.
+     */
+    CFE_CORE_AtomicU64_t TailPosition;
+
+    /**
+     * Free stacks of a concurrent pool, indexed by bucket ID - 1
+     */
+    CFE_ES_MemPoolFreeStack_t FreeStack[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
 } CFE_ES_MemPoolRecord_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -241,4 +283,120 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a memory pool
+ *
+ * Internal function used to implement CFE_ES_PoolCreateEx_WithAlignment() and
+ * CFE_ES_PoolCreateConcurrent().  A concurrent pool is fully set up before
+ * its ID is stored in the record, after which other tasks can use it.
+ *
+ * @param[out]  PoolID        Location to output the memory pool handle
+ * @param[in]   MemPtr        Pointer to the memory of the pool
+ * @param[in]   Size          Size of the memory of the pool
+ * @param[in]   NumBlockSizes Number of entries in BlockSizes, 0 for the default
+ * @param[in]   BlockSizes    Block sizes of the pool, NULL for the default
+ * @param[in]   UseMutex      Whether the pool is protected by a mutex
+ * @param[in]   Alignment     Required alignment of the blocks
+ * @param[in]   IsConcurrent  Whether returned blocks go to the lock-free free stacks
+ *
+ * @return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID,
+                           void               *MemPtr,
+                           size_t              Size,
+                           uint16              NumBlockSizes,
+                           const size_t       *BlockSizes,
+                           bool                UseMutex,
+                           size_t              Alignment,
+                           bool                IsConcurrent);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a memory pool keeps returned blocks on lock-free free stacks
+ *
+ * @param[in]   PoolRecPtr    pointer to Pool table entry
+ * @returns true if the pool was created with CFE_ES_PoolCreateConcurrent()
+ */
+static inline bool CFE_ES_MemPoolIsConcurrent(const CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    return PoolRecPtr->IsConcurrent;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Pop a block from the free stack of a bucket in a concurrent pool
+ *
+ * If the block on top of the stack does not have a valid descriptor of a
+ * returned block of the bucket, it is left there and no block is output,
+ * the same as for recycling a block from the generic pool.
+ *
+ * @param[inout] PoolRecPtr     pointer to Pool table entry
+ * @param[in]    BucketId       bucket ID of the stack, must be valid
+ * @param[in]    NewSize        size of block requested
+ * @param[out]   DataOffsetPtr  Location to output the block offset
+ *
+ * @return #CFE_SUCCESS, or #CFE_ES_BUFFER_NOT_IN_POOL if no block was popped
+ */
+int32 CFE_ES_MemPoolPopFreeBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr,
+                                 uint16                  BucketId,
+                                 size_t                  NewSize,
+                                 size_t                 *DataOffsetPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Push a block to the free stack of its bucket in a concurrent pool
+ *
+ * @param[inout] PoolRecPtr     pointer to Pool table entry
+ * @param[in]    BucketId       bucket ID of the block, must be valid
+ * @param[in]    DataOffset     offset of the block, which must have been validated
+ */
+void CFE_ES_MemPoolPushFreeBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t DataOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets a block from a concurrent pool
+ *
+ * Pops a previously returned block from the free stack of the bucket that
+ * fits the request, without a lock.  The pool mutex is only taken if a new
+ * block must be carved from the pool tail.
+ *
+ * @param[inout] PoolRecPtr     pointer to Pool table entry
+ * @param[out]   DataOffsetPtr  Location to output new block offset
+ * @param[in]    Size           Size of block requested
+ *
+ * @return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_MemPoolGetBlockConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the size of a block in a concurrent pool
+ *
+ * Checks the block against the tail position of the concurrent pool,
+ * without a lock.
+ *
+ * @param[inout] PoolRecPtr     pointer to Pool table entry
+ * @param[out]   DataSizePtr    Location to output the block size
+ * @param[in]    DataOffset     offset of the block within the pool
+ *
+ * @return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_MemPoolGetBlockSizeConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Returns a block to a concurrent pool
+ *
+ * Validates the block and pushes it to the free stack of its bucket, without
+ * a lock.  The pool mutex is only taken to count a block that fails validation.
+ *
+ * @param[inout] PoolRecPtr     pointer to Pool table entry
+ * @param[out]   DataSizePtr    Location to output the original allocation size
+ * @param[in]    DataOffset     offset of the block within the pool
+ *
+ * @return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_MemPoolPutBlockConcurrent(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset);
+
 #endif /* CFE_ES_MEMPOOL_H */
@@ -43,6 +43,8 @@
 #include "cfe_es_cds.h"
 #include "cfe_es_crc.h"
 #include "cfe_es_perf.h"
+#include "cfe_es_lockprof.h"
+#include "cfe_es_cmdstats.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
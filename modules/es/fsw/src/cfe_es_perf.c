@@ -28,9 +28,78 @@
 ** Include Section
 */
 #include "cfe_es_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 
+/*
+ * Memory ordering for the per-task rings.  On weakly ordered SMP targets the
+ * stores of an entry and of WriteCount (or the loads of an entry and of
+ * ReadCount) may otherwise be seen by the other CPU in the opposite order.
+ * Without the fences (see cfe_core_atomic.h) the rings are not used and
+ * markers always go to the log under the perf log mutex.
+ */
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns true if the next pending entry in ring A has an
+ * older timestamp than the next pending entry in ring B.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfTaskRingIsOlder(const CFE_ES_PerfTaskRing_t *RingA, const CFE_ES_PerfTaskRing_t *RingB)
+{
+    const volatile CFE_ES_PerfDataEntry_t *EntryA;
+    const volatile CFE_ES_PerfDataEntry_t *EntryB;
+
+    EntryA = &RingA->Entries[RingA->ReadCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)];
+    EntryB = &RingB->Entries[RingB->ReadCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)];
+
+    if (EntryA->TimerUpper32 != EntryB->TimerUpper32)
+    {
+        return (EntryA->TimerUpper32 < EntryB->TimerUpper32);
+    }
+
+    return (EntryA->TimerLower32 < EntryB->TimerLower32);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Combines the upper and lower timebase values of an entry
+ * into a single 64-bit tick count.
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CFE_ES_PerfEntryTicks(const CFE_ES_PerfMetaData_t *MetaData, const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    return CFE_ES_TimebaseToTicks(EntryPtr->TimerUpper32, EntryPtr->TimerLower32, MetaData->TimerLow32Rollover);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes a value as unsigned LEB128 and returns the number of bytes used.
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_PerfStreamPutVarint(uint8 *Dest, uint64 Value)
+{
+    size_t Len = 0;
+
+    while (Value >= 0x80)
+    {
+        Dest[Len] = (uint8)(Value | 0x80);
+        Value >>= 7;
+        ++Len;
+    }
+
+    Dest[Len] = (uint8)Value;
+
+    return Len + 1;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -143,7 +212,9 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 {
     const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
     CFE_ES_PerfDumpGlobal_t             *PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t           *StreamState   = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t                   *Perf;
+    uint32                               i;
 
     /*
     ** Set the pointer to the data area
@@ -152,13 +223,28 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 
     /* Ensure there is no file write in progress before proceeding */
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE
-        && PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+        && PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE && !StreamState->IsActive)
     {
         /* Make sure Trigger Mode is valid */
-        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_END)
+        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_STREAM)
         {
             CFE_ES_Global.TaskData.CommandCounter++;
 
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                /* Reset the entire state object, as it may have stale data from a previous stream */
+                memset(StreamState, 0, sizeof(*StreamState));
+
+                StreamState->FileWrite.FileSubType = CFE_FS_SubType_ES_PERFSTREAM;
+                snprintf(StreamState->FileWrite.Description,
+                         sizeof(StreamState->FileWrite.Description),
+                         CFE_ES_PERF_STREAM_DESC);
+
+                StreamState->FileWrite.GetData = CFE_ES_PerfStreamDataGetter;
+                StreamState->FileWrite.OnEvent = CFE_ES_PerfStreamEventHandler;
+                StreamState->IsActive          = true;
+            }
+
             /* Taking lock here as this might be changing states from one active mode to another.
              * In that case, need to make sure that the log is not written to while resetting the counters. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
@@ -168,9 +254,27 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+
+            /* Discard anything left in the per-task rings from a previous collection */
+            for (i = 0; i < OS_MAX_TASKS; ++i)
+            {
+                CFE_ES_Global.PerfTaskRing[i].ReadCount = CFE_ES_Global.PerfTaskRing[i].WriteCount;
+            }
+
+            /* this must be done last - streaming does not use the trigger, it records from the start */
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+            }
+            else
+            {
+                Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+            }
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
+            /* Wake the background task so it begins merging the per-task rings */
+            CFE_ES_BackgroundWakeup();
+
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID,
                               CFE_EVS_EventType_DEBUG,
                               "Start collecting performance data cmd received, trigger mode = %d",
@@ -184,7 +288,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
                               "Cannot start collecting performance data, trigger mode (%d) out of range (%d to %d)",
                               (int)CmdPtr->TriggerMode,
                               (int)CFE_ES_PerfTrigger_START,
-                              (int)CFE_ES_PerfTrigger_END);
+                              (int)CFE_ES_PerfTrigger_STREAM);
         }
     }
     else
@@ -222,38 +326,57 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE
         && PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
+        /* Merge markers still pending in the per-task rings before going idle */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+        CFE_ES_PerfLogMergeTaskRings();
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
-        /* Copy out the string, using default if unspecified */
-        Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName,
-                                             CmdPtr->DataFileName,
-                                             sizeof(PerfDumpState->DataFileName),
-                                             sizeof(CmdPtr->DataFileName),
-                                             CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME,
-                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
-                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
-
-        if (Status == CFE_SUCCESS)
+        if (CFE_ES_Global.BackgroundPerfStreamState.IsActive)
         {
-            PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
+            /* Streaming - no dump file, the stream job writes out whatever is left as the last file */
             CFE_ES_BackgroundWakeup();
 
             CFE_ES_Global.TaskData.CommandCounter++;
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID,
                               CFE_EVS_EventType_DEBUG,
-                              "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d entries",
-                              (int)Perf->MetaData.DataCount,
-                              (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-                              (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
+                              "Perf Stop Cmd Rcvd, will stream remaining %d entries",
+                              (int)Perf->MetaData.DataCount);
         }
         else
         {
-            CFE_ES_Global.TaskData.CommandErrorCounter++;
-            CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Error parsing filename, RC = %d",
-                              (int)Status);
+            /* Copy out the string, using default if unspecified */
+            Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName,
+                                                 CmdPtr->DataFileName,
+                                                 sizeof(PerfDumpState->DataFileName),
+                                                 sizeof(CmdPtr->DataFileName),
+                                                 CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME,
+                                                 CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                                 CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+            if (Status == CFE_SUCCESS)
+            {
+                PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
+                CFE_ES_BackgroundWakeup();
+
+                CFE_ES_Global.TaskData.CommandCounter++;
+
+                CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID,
+                                  CFE_EVS_EventType_DEBUG,
+                                  "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d entries",
+                                  (int)Perf->MetaData.DataCount,
+                                  (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                                  (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
+            }
+            else
+            {
+                CFE_ES_Global.TaskData.CommandErrorCounter++;
+                CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "Error parsing filename, RC = %d",
+                                  (int)Status);
+            }
         }
 
     } /* if data to write == 0 */
@@ -499,6 +622,237 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     return (State->CurrentState != CFE_ES_PerfDumpState_IDLE);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    CFE_ES_PerfData_t         *Perf;
+    bool                       IsStopped;
+    int32                      Status;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    if (!State->IsActive)
+    {
+        return false;
+    }
+
+    /* Still writing the current file */
+    if (CFE_FS_BackgroundFileDumpIsPending(&State->FileWrite))
+    {
+        return true;
+    }
+
+    IsStopped = (Perf->MetaData.State == CFE_ES_PERF_IDLE);
+
+    if (IsStopped && Perf->MetaData.DataCount == 0)
+    {
+        /* Everything has been written out, the stream is complete */
+        State->IsActive = false;
+        return false;
+    }
+
+    /*
+     * Start the next file once there is a reasonable amount of data waiting,
+     * so the series is not made up of many tiny files, or once collection
+     * has stopped, to write out whatever is left.
+     */
+    if (IsStopped || Perf->MetaData.DataCount >= (CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES / 2))
+    {
+        snprintf(State->FileWrite.FileName,
+                 sizeof(State->FileWrite.FileName),
+                 "%s_%03u.dat",
+                 CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME,
+                 (unsigned int)(State->FileSequence % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES));
+
+        State->FileEntries = 0;
+
+        Status = CFE_FS_BackgroundFileDumpRequest(&State->FileWrite);
+        if (Status != CFE_SUCCESS && IsStopped)
+        {
+            /* While streaming this is retried on the next cycle, but once stopped just give up */
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Cannot write last perf stream file %s, RC = %d",
+                              State->FileWrite.FileName,
+                              (int)Status);
+            State->IsActive = false;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfStreamDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Meta;
+    CFE_ES_PerfDataEntry_t    *EntryPtr;
+    CFE_ES_PerfData_t         *Perf;
+    uint64                     Ticks;
+    uint64                     MarkerValue;
+    size_t                     BlockSize;
+    uint32                     DataStart;
+    bool                       IsEOF;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+    if (RecordNum == 0)
+    {
+        /* The first record in each file is the stream header, based on the oldest waiting entry */
+        State->PrevTicks = 0;
+        if (Perf->MetaData.DataCount > 0)
+        {
+            State->PrevTicks = CFE_ES_PerfEntryTicks(&Perf->MetaData, &Perf->DataBuffer[Perf->MetaData.DataStart]);
+        }
+
+        memset(&State->Header, 0, sizeof(State->Header));
+        State->Header.Magic               = CFE_ES_PERFSTREAM_MAGIC;
+        State->Header.Version             = CFE_ES_PERFSTREAM_VERSION;
+        State->Header.TimerTicksPerSecond = Perf->MetaData.TimerTicksPerSecond;
+        State->Header.TimerLow32Rollover  = Perf->MetaData.TimerLow32Rollover;
+        State->Header.FileSequence        = State->FileSequence;
+        State->Header.LostEntries         = State->LostEntries;
+        State->Header.BaseTicksUpper      = (uint32)(State->PrevTicks >> 32);
+        State->Header.BaseTicksLower      = (uint32)State->PrevTicks;
+
+        *Buffer  = &State->Header;
+        *BufSize = sizeof(State->Header);
+        IsEOF    = false;
+    }
+    else
+    {
+        /*
+         * Remove as many entries from the buffer as will fit in one block.
+         * Each is encoded as the marker/exit value followed by the zigzag
+         * encoded tick difference from the previous entry - normally positive,
+         * but entries added directly by a task with a full ring may be slightly
+         * out of order.
+         */
+        BlockSize = 0;
+        DataStart = Perf->MetaData.DataStart;
+        while (Perf->MetaData.DataCount > 0 && State->FileEntries < CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES &&
+               (BlockSize + CFE_ES_PERFSTREAM_MAX_RECORD_SIZE) <= sizeof(State->Block))
+        {
+            EntryPtr    = &Perf->DataBuffer[DataStart];
+            Ticks       = CFE_ES_PerfEntryTicks(&Perf->MetaData, EntryPtr);
+            MarkerValue = ((uint64)(EntryPtr->Data & ~CFE_ES_DBIT(CFE_MISSION_ES_PERF_EXIT_BIT)) << 1) |
+                          CFE_ES_DTEST(EntryPtr->Data, CFE_MISSION_ES_PERF_EXIT_BIT);
+
+            BlockSize += CFE_ES_PerfStreamPutVarint(&State->Block[BlockSize], MarkerValue);
+            if (Ticks >= State->PrevTicks)
+            {
+                BlockSize += CFE_ES_PerfStreamPutVarint(&State->Block[BlockSize], (Ticks - State->PrevTicks) << 1);
+            }
+            else
+            {
+                BlockSize +=
+                    CFE_ES_PerfStreamPutVarint(&State->Block[BlockSize], ((State->PrevTicks - Ticks) << 1) - 1);
+            }
+            State->PrevTicks = Ticks;
+
+            ++DataStart;
+            if (DataStart >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+            {
+                DataStart = 0;
+            }
+            --Perf->MetaData.DataCount;
+            ++State->FileEntries;
+        }
+        Perf->MetaData.DataStart = DataStart;
+
+        *Buffer  = State->Block;
+        *BufSize = BlockSize;
+
+        /* This file is done when the buffer is drained, the next file will pick up from here */
+        IsEOF = (Perf->MetaData.DataCount == 0 || State->FileEntries >= CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES);
+    }
+
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+    return IsEOF;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStreamEventHandler(void                   *Meta,
+                                   CFE_FS_FileWriteEvent_t Event,
+                                   int32                   Status,
+                                   uint32                  RecordNum,
+                                   size_t                  BlockSize,
+                                   size_t                  Position)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Meta;
+    CFE_ES_PerfData_t         *Perf;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_EID,
+                              CFE_EVS_EventType_DEBUG,
+                              "%s written:Size=%lu,EntryCount=%lu",
+                              State->FileWrite.FileName,
+                              (unsigned long)Position,
+                              (unsigned long)State->FileEntries);
+            ++State->FileSequence;
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error writing perf stream file %s, RC = %d, streaming stopped",
+                              State->FileWrite.FileName,
+                              (int)Status);
+
+            /*
+             * Stop collecting and discard the rest, the next file would most
+             * likely fail the same way.  The stream job sees the empty buffer
+             * and ends the stream.
+             */
+            OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            Perf->MetaData.State     = CFE_ES_PERF_IDLE;
+            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+            Perf->MetaData.DataCount = 0;
+            OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -585,15 +939,15 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
+ * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+void CFE_ES_PerfLogAppendEntry(const CFE_ES_PerfDataEntry_t *EntryData)
 {
-    CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
-    CFE_ES_PerfData_t     *Perf;
+    uint32             Marker;
+    uint32             DataEnd;
+    CFE_ES_PerfData_t *Perf;
 
     /*
     ** Set the pointer to the data area
@@ -601,66 +955,14 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
-     */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
-    {
-        return;
-    }
-
-    /* if marker is out of range... */
-    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
-    {
-        /* if marker has not been reported previously ... */
-        if (Perf->MetaData.InvalidMarkerReported == false)
-        {
-            CFE_ES_WriteToSysLog("%s: Invalid performance marker %d,max is %d\n",
-                                 __func__,
-                                 (unsigned int)Marker,
-                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
-            Perf->MetaData.InvalidMarkerReported = true;
-        }
-
-        return;
-    }
-
-    /*
-     * check if this ID is filtered.
-     * This is also done outside the lock -
-     * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
-     */
-    if (!CFE_ES_TEST_U32_MASK(Perf->MetaData.FilterMask, Marker))
-    {
-        return;
-    }
-
-    /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
-     */
-    EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
-    CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
-
-    /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
-     */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
-
-    /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
+     * Confirm that the global is still non-idle
+     * (state could become idle while getting lock, or while the entry was pending in a ring)
      */
     if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
     {
         /* copy data to next perflog slot */
         DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
+        Perf->DataBuffer[DataEnd] = *EntryData;
 
         ++DataEnd;
         if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
@@ -679,12 +981,19 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
             /* after the buffer fills up start and end point to the same entry since we
                are now overwriting old data */
             Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+
+            /* when streaming, the overwritten entry is lost before it could be written out */
+            if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM)
+            {
+                ++CFE_ES_Global.BackgroundPerfStreamState.LostEntries;
+            }
         }
 
         /* waiting for trigger */
         if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
         {
-            if (CFE_ES_TEST_U32_MASK(Perf->MetaData.TriggerMask, Marker))
+            Marker = EntryData->Data & ~CFE_ES_DBIT(CFE_MISSION_ES_PERF_EXIT_BIT);
+            if (Marker < CFE_MISSION_ES_PERF_MAX_IDS && CFE_ES_TEST_U32_MASK(Perf->MetaData.TriggerMask, Marker))
             {
                 Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
             }
@@ -712,8 +1021,223 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
             {
                 Perf->MetaData.State = CFE_ES_PERF_IDLE;
             }
+
+            /* CFE_ES_PerfTrigger_STREAM continues until stopped by command */
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogMergeTaskRings(void)
+{
+    CFE_ES_PerfTaskRing_t *Ring;
+    CFE_ES_PerfTaskRing_t *OldestRing;
+    CFE_ES_PerfDataEntry_t EntryData;
+    uint32                 PendingRing[OS_MAX_TASKS];
+    uint32                 PendingEnd[OS_MAX_TASKS];
+    uint32                 NumPending;
+    uint32                 Oldest;
+    uint32                 WriteCount;
+    uint32                 ReadCount;
+    uint32                 i;
+
+    /*
+     * Snapshot the write position of every ring which has pending entries.
+     * Anything a task adds after this point is left for the next merge,
+     * which bounds the amount of work done here.
+     */
+    NumPending = 0;
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        Ring       = &CFE_ES_Global.PerfTaskRing[i];
+        WriteCount = Ring->WriteCount;
+        if (WriteCount != Ring->ReadCount)
+        {
+            PendingRing[NumPending] = i;
+            PendingEnd[NumPending]  = WriteCount;
+            ++NumPending;
+        }
+    }
+
+    /* Pairs with the release in CFE_ES_PerfLogAdd(), entries up to the snapshot are complete */
+    CFE_CORE_ACQUIRE_FENCE();
+
+    /*
+     * Each ring is already in time order, so repeatedly take the oldest
+     * entry from the head of all pending rings.  In practice only a few
+     * tasks are recording at any given time, so a linear scan is fine.
+     */
+    while (NumPending > 0)
+    {
+        Oldest     = 0;
+        OldestRing = &CFE_ES_Global.PerfTaskRing[PendingRing[0]];
+        for (i = 1; i < NumPending; ++i)
+        {
+            Ring = &CFE_ES_Global.PerfTaskRing[PendingRing[i]];
+            if (CFE_ES_PerfTaskRingIsOlder(Ring, OldestRing))
+            {
+                Oldest     = i;
+                OldestRing = Ring;
+            }
+        }
+
+        ReadCount = OldestRing->ReadCount;
+        EntryData = OldestRing->Entries[ReadCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)];
+        ++ReadCount;
+
+        /* The entry must be read before its slot is handed back to the task */
+        CFE_CORE_RELEASE_FENCE();
+        OldestRing->ReadCount = ReadCount;
+
+        CFE_ES_PerfLogAppendEntry(&EntryData);
+
+        if (ReadCount == PendingEnd[Oldest])
+        {
+            /* this ring is drained, replace it with the last pending ring */
+            --NumPending;
+            PendingRing[Oldest] = PendingRing[NumPending];
+            PendingEnd[Oldest]  = PendingEnd[NumPending];
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogMerge(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfData_t *Perf;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /*
+     * Tasks do not record into their rings while the log is idle,
+     * and the rings are reset when collection is started again
+     */
+    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    {
+        return false;
+    }
+
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    CFE_ES_PerfLogMergeTaskRings();
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+    /*
+     * Return "true" if activity is ongoing, or "false" if not active
+     */
+    return (Perf->MetaData.State != CFE_ES_PERF_IDLE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfDataEntry_t EntryData;
+    CFE_ES_PerfTaskRing_t *Ring;
+    osal_index_t           TaskIndex = OSAL_INDEX_C(0);
+    uint32                 WriteCount;
+    CFE_ES_PerfData_t     *Perf;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /*
+     * If the global state is idle, exit immediately without locking or doing anything
+     */
+    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
+
+    /* if marker is out of range... */
+    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        /* if marker has not been reported previously ... */
+        if (Perf->MetaData.InvalidMarkerReported == false)
+        {
+            CFE_ES_WriteToSysLog("%s: Invalid performance marker %d,max is %d\n",
+                                 __func__,
+                                 (unsigned int)Marker,
+                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
+            Perf->MetaData.InvalidMarkerReported = true;
+        }
+
+        return;
+    }
+
+    /*
+     * check if this ID is filtered.
+     * This is also done outside the lock -
+     * normally masks should NOT be changed while perf log is active / non-idle,
+     * so although this is reading a global it should be constant, and this avoids
+     * locking (and potential task switch) if the data is ultimately not going to
+     * be written to the log.
+     */
+    if (!CFE_ES_TEST_U32_MASK(Perf->MetaData.FilterMask, Marker))
+    {
+        return;
+    }
+
+    /*
+     * prepare the entry data (timestamp) before locking,
+     * just in case the locking operation incurs a delay
+     */
+    EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
+    CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
+
+    /*
+     * Normally the entry goes into the ring owned by the calling task.
+     * The calling task is the only writer of its ring, so no lock is needed -
+     * the entry is stored first, and only then is WriteCount advanced to
+     * make it visible to the merge.  The barriers keep this order as seen
+     * by the merge on another CPU.
+     */
+    if (CFE_CORE_ATOMICS_AVAILABLE &&
+        OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex) == OS_SUCCESS)
+    {
+        Ring       = &CFE_ES_Global.PerfTaskRing[TaskIndex];
+        WriteCount = Ring->WriteCount;
+        if ((WriteCount - Ring->ReadCount) < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE)
+        {
+            /* Pairs with the release in the merge, which is done reading this slot */
+            CFE_CORE_ACQUIRE_FENCE();
+            Ring->Entries[WriteCount & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)] = EntryData;
+            CFE_CORE_RELEASE_FENCE();
+            Ring->WriteCount = WriteCount + 1;
+            return;
         }
     }
 
+    /*
+     * Otherwise (ring is full, or the caller is not an OSAL task) acquire the
+     * perflog mutex and write into the shared area directly.  Pending ring
+     * entries are older than this one, so merge them first to keep the log in
+     * time order.
+     *
+     * Note this lock is held for long periods while a background dump
+     * is taking place, but the dump should never be active at the
+     * same time that a capture/record is taking place.
+     */
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    CFE_ES_PerfLogMergeTaskRings();
+    CFE_ES_PerfLogAppendEntry(&EntryData);
     OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 }
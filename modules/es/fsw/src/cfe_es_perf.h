@@ -36,11 +36,16 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_perfdata_typedef.h"
+#include "cfe_es_perfstream_typedef.h"
+#include "cfe_fs_api_typedefs.h"
 
 /*
 ** Macro Definitions
 */
 
+#define CFE_ES_PERF_STREAM_BLOCK_SIZE 512 /* Size of each block of encoded records passed to the file writer */
+
 #define CFE_ES_DBIT(x)     ((uint32)1 << (x))            /* Places a one at bit positions 0 thru 31 */
 #define CFE_ES_DTEST(i, x) (((i) & CFE_ES_DBIT(x)) != 0) /* true iff bit x of i is set */
 
@@ -134,6 +139,51 @@ typedef struct
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
+/**
+ * @brief Performance log streaming state structure
+ *
+ * In streaming mode (#CFE_ES_PerfTrigger_STREAM) the performance data buffer
+ * is continuously drained to a series of files through the FS background
+ * file writer, one write request per file.  The stream background job
+ * posts the request for the next file once enough data is waiting, and the
+ * data getter encodes entries into the compact stream format as the file
+ * is written.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite; /* FS state data - must be first */
+
+    volatile bool IsActive;     /* set on start, cleared once the last file is written after stop */
+    uint32        FileSequence; /* sequence number of the current file */
+    uint32        FileEntries;  /* number of entries written to the current file */
+    uint32        LostEntries;  /* number of entries overwritten before they could be streamed */
+    uint64        PrevTicks;    /* tick value of the last entry written, for delta encoding */
+
+    CFE_ES_PerfStreamHeader_t Header;                               /* holding area for the file header */
+    uint8                     Block[CFE_ES_PERF_STREAM_BLOCK_SIZE]; /* holding area for encoded records */
+} CFE_ES_PerfStreamGlobal_t;
+
+/**
+ * @brief Per-task performance marker ring
+ *
+ * CFE_ES_PerfLogAdd() records markers into the ring associated with the
+ * calling task's OSAL task index, without taking the perf log mutex.  The
+ * rings are merged into the global perf log, in timestamp order, by the
+ * background task (or by a task whose ring is full).
+ *
+ * Each ring has a single producer, the task which owns it, which writes the
+ * entry and then advances WriteCount.  The consumer is whoever holds the
+ * perf log mutex, which reads entries up to WriteCount and then advances
+ * ReadCount.  Both counters are free-running and are reduced modulo the
+ * (power of two) ring size to get the entry index.
+ */
+typedef struct
+{
+    volatile uint32                 WriteCount; /* number of entries ever written, owned by the task */
+    volatile uint32                 ReadCount;  /* number of entries ever merged, owned by the mutex holder */
+    volatile CFE_ES_PerfDataEntry_t Entries[CFE_PLATFORM_ES_PERF_TASK_RING_SIZE];
+} CFE_ES_PerfTaskRing_t;
+
 /**
  * @brief Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -161,6 +211,84 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Append a single entry to the performance log
+ *
+ * Stores the entry at the end of the perf log and applies the trigger
+ * logic, exactly as a marker would have been recorded directly.  Entries
+ * are discarded if the perf log is idle.
+ *
+ * @note The caller must hold the perf log mutex
+ *
+ * @param[in] EntryData the entry to append
+ */
+void CFE_ES_PerfLogAppendEntry(const CFE_ES_PerfDataEntry_t *EntryData);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Merge the per-task marker rings into the performance log
+ *
+ * Moves all entries pending in the per-task rings into the perf log,
+ * oldest timestamp first.  Entries added by tasks while the merge is in
+ * progress are left for the next merge.
+ *
+ * @note The caller must hold the perf log mutex
+ */
+void CFE_ES_PerfLogMergeTaskRings(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job to merge the per-task marker rings
+ *
+ * Periodically merges the per-task rings into the perf log while
+ * performance data collection is active.
+ *
+ * Returns true while data collection is active, false when idle.
+ */
+bool CFE_ES_RunPerfLogMerge(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job to stream performance data to files
+ *
+ * While streaming mode is active, requests a background write of the next
+ * file in the series whenever enough data is waiting, and once more after
+ * collection is stopped to write out whatever is left.
+ *
+ * Returns true while streaming is active, false when idle.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Data getter for performance stream files
+ *
+ * Record 0 is the stream file header.  Each following record is a block of
+ * entries removed from the performance data buffer and delta encoded.  The
+ * file ends when the buffer is empty or the file holds
+ * #CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES entries.
+ *
+ * @sa CFE_FS_FileWriteGetData_t
+ */
+bool CFE_ES_PerfStreamDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Event handler for performance stream files
+ *
+ * Reports completion or failure of each stream file and advances the
+ * file sequence number.
+ *
+ * @sa CFE_FS_FileWriteOnEvent_t
+ */
+void CFE_ES_PerfStreamEventHandler(void                   *Meta,
+                                   CFE_FS_FileWriteEvent_t Event,
+                                   int32                   Status,
+                                   uint32                  RecordNum,
+                                   size_t                  BlockSize,
+                                   size_t                  Position);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
@@ -86,6 +86,16 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     */
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
 
+    /*
+    ** Set up the lock contention profile, before any of the profiled locks are used
+    */
+    CFE_ES_LockProfileInit();
+
+    /*
+    ** Set up the command statistics, before any of the core service tasks are started
+    */
+    CFE_ES_CmdStatsInit();
+
     /*
     ** Create the ES Shared Data Mutex
     ** This must be done before ANY calls to CFE_ES_WriteToSysLog(), since this uses the mutex
@@ -361,6 +361,13 @@ int32 CFE_ES_TaskInit(void)
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID),
                  sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize command statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.CmdStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_CMDSTATS_TLM_MID),
+                 sizeof(CFE_ES_Global.TaskData.CmdStatsPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -1607,6 +1614,86 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_LockProfileDumpGlobal_t     *StatePtr;
+    int32                               Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundLockProfileDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        /*
+         * Fill out the remainder of meta data.
+         * This data is currently the same for every request
+         */
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_LOCKPROFILE;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "ES Lock Profile");
+
+        StatePtr->FileWrite.GetData = CFE_ES_LockProfileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_LockProfileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName,
+                                             CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName),
+                                             sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            /* Specific event if already pending */
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_PENDING_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Lock profile write already in progress");
+        }
+        else
+        {
+            /* Some other validation issue e.g. bad file name */
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error creating file, RC = %d",
+                              (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1774,6 +1861,36 @@ int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SendCmdStatsCmd(const CFE_ES_SendCmdStatsCmd_t *data)
+{
+    uint8 Service;
+
+    /*
+    ** Send one command statistics telemetry packet per core service
+    */
+    for (Service = 0; Service < CFE_ES_CmdStatsService_MAX; ++Service)
+    {
+        CFE_ES_CmdStatsGetPayload(Service, &CFE_ES_Global.TaskData.CmdStatsPacket.Payload);
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.CmdStatsPacket.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.CmdStatsPacket.TelemetryHeader), true);
+    }
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_CMDSTATS_EID,
+                      CFE_EVS_EventType_DEBUG,
+                      "Successfully telemetered command statistics, recording %s",
+                      CFE_ES_Global.CmdStats.IsEnabled ? "enabled" : "disabled");
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
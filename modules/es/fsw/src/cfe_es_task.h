@@ -54,11 +54,12 @@
 /*
 ** ES File descriptions
 */
-#define CFE_ES_SYS_LOG_DESC  "ES system log data file"
-#define CFE_ES_TASK_LOG_DESC "ES Task Info file"
-#define CFE_ES_APP_LOG_DESC  "ES Application Info file"
-#define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
-#define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_SYS_LOG_DESC     "ES system log data file"
+#define CFE_ES_TASK_LOG_DESC    "ES Task Info file"
+#define CFE_ES_APP_LOG_DESC     "ES Application Info file"
+#define CFE_ES_ER_LOG_DESC      "ES ERlog data file"
+#define CFE_ES_PERF_LOG_DESC    "ES Performance data file"
+#define CFE_ES_PERF_STREAM_DESC "ES Performance data stream file"
 
 /*
  * Limit for the total number of entries that may be
@@ -213,6 +214,12 @@ int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLogCmd_t *data);
  */
 int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the lock contention profile to a file.
+ */
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Processor Reset Count
@@ -261,6 +268,12 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
  */
 int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Telemeter Command Execution Statistics
+ */
+int32 CFE_ES_SendCmdStatsCmd(const CFE_ES_SendCmdStatsCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Dump CDS Registry to a file
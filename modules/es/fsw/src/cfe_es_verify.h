@@ -142,6 +142,48 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance per-task ring size (indexed by masking, so must be a power of two)
+*/
+#if CFE_PLATFORM_ES_PERF_TASK_RING_SIZE < 2
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE cannot be less than 2!
+#elif (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE & (CFE_PLATFORM_ES_PERF_TASK_RING_SIZE - 1)) != 0
+#error CFE_PLATFORM_ES_PERF_TASK_RING_SIZE must be a power of two!
+#endif
+
+/*
+** Performance stream file size and count
+*/
+#if CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES < 2
+#error CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES cannot be less than 2!
+#elif CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES > (2 * CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+#error CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES cannot be more than twice CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES > 1000
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be more than 1000!
+#endif
+
+/*
+** Lock contention profile
+*/
+#if CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES < 1
+#error CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES cannot be less than 1!
+#endif
+
+#if CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS < 1
+#error CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS cannot be less than 1!
+#endif
+
+/*
+** Command execution statistics
+*/
+#if CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES < 1
+#error CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES cannot be less than 1!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -0,0 +1,339 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host tool to convert ES performance stream files to the JSON trace event
+ * format understood by Perfetto and chrome://tracing.
+ *
+ * Each performance marker is shown as its own timeline (thread), as the
+ * markers are normally allocated per application or task.  Names for the
+ * timelines can be taken from any header file that defines the marker IDs
+ * in the usual "#define XXX_PERF_ID value" form.
+ */
+
+#include "cfe_es_perfstream_typedef.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Size of the standard cFE file header (CFE_FS_Header_t) at the start of each file.
+ * This is a fixed layout: 8 x uint32 followed by a 32 character description.
+ */
+#define CFE_ES_PERFSTREAM_TOOL_FS_HEADER_SIZE 64
+
+#define CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS  65536
+#define CFE_ES_PERFSTREAM_TOOL_MAX_NAME_LEN 64
+
+typedef struct
+{
+    bool  Seen[CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS];
+    char *Name[CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS];
+    bool  IsFirstEvent;
+} CFE_ES_PerfStreamTool_State_t;
+
+static CFE_ES_PerfStreamTool_State_t CFE_ES_PerfStreamTool_State;
+
+/*----------------------------------------------------------------
+ *
+ * Prints command line usage information
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStreamTool_PrintUsage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s [-n perfids.h] streamfile...\n\n", cmd);
+    fprintf(stderr, "Converts performance stream files, given in sequence order, to trace event JSON on stdout\n");
+    fprintf(stderr, " -n: read marker names from \"#define NAME value\" lines in the given file\n");
+    fprintf(stderr, "     (may be given more than once)\n\n");
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reads marker names from a header file
+ *
+ *-----------------------------------------------------------------*/
+int CFE_ES_PerfStreamTool_ReadNames(const char *FileName)
+{
+    FILE *fp;
+    char  Line[256];
+    char  Name[CFE_ES_PERFSTREAM_TOOL_MAX_NAME_LEN];
+    long  Value;
+    char *EndPtr;
+
+    fp = fopen(FileName, "r");
+    if (fp == NULL)
+    {
+        perror(FileName);
+        return -1;
+    }
+
+    while (fgets(Line, sizeof(Line), fp) != NULL)
+    {
+        if (sscanf(Line, " #define %63s %li", Name, &Value) != 2)
+        {
+            continue;
+        }
+
+        /* Only take the IDs, not other definitions that happen to be numeric */
+        EndPtr = strstr(Name, "_PERF_ID");
+        if (EndPtr == NULL || Value < 0 || Value >= CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS)
+        {
+            continue;
+        }
+
+        *EndPtr = 0;
+        free(CFE_ES_PerfStreamTool_State.Name[Value]);
+        CFE_ES_PerfStreamTool_State.Name[Value] = strdup(Name);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reads one unsigned LEB128 value
+ * Returns false at the end of the file (or if the value is truncated)
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfStreamTool_GetVarint(FILE *fp, uint64_t *Value)
+{
+    int      ch;
+    unsigned Shift;
+
+    *Value = 0;
+    Shift  = 0;
+    do
+    {
+        ch = fgetc(fp);
+        if (ch == EOF || Shift >= 64)
+        {
+            return false;
+        }
+        *Value |= (uint64_t)(ch & 0x7F) << Shift;
+        Shift += 7;
+    } while (ch & 0x80);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reverses the byte order of a 32 bit value
+ *
+ *-----------------------------------------------------------------*/
+uint32_t CFE_ES_PerfStreamTool_Swap32(uint32_t Value)
+{
+    return ((Value & 0xFF) << 24) | ((Value & 0xFF00) << 8) | ((Value >> 8) & 0xFF00) | (Value >> 24);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Converts all records in a single stream file
+ *
+ *-----------------------------------------------------------------*/
+int CFE_ES_PerfStreamTool_ConvertFile(const char *FileName)
+{
+    FILE                     *fp;
+    CFE_ES_PerfStreamHeader_t Header;
+    uint32_t                 *Word;
+    uint64_t                  Ticks;
+    uint64_t                  MarkerValue;
+    uint64_t                  Delta;
+    uint32_t                  Marker;
+    size_t                    i;
+    double                    TimeUs;
+    unsigned long             Count;
+
+    fp = fopen(FileName, "rb");
+    if (fp == NULL)
+    {
+        perror(FileName);
+        return -1;
+    }
+
+    if (fseek(fp, CFE_ES_PERFSTREAM_TOOL_FS_HEADER_SIZE, SEEK_SET) != 0 ||
+        fread(&Header, sizeof(Header), 1, fp) != 1)
+    {
+        fprintf(stderr, "%s: file too short\n", FileName);
+        fclose(fp);
+        return -1;
+    }
+
+    /* The stream header is written in the byte order of the target, which is identified by the magic number */
+    if (Header.Magic != CFE_ES_PERFSTREAM_MAGIC)
+    {
+        Word = (uint32_t *)&Header;
+        for (i = 0; i < (sizeof(Header) / sizeof(uint32_t)); ++i)
+        {
+            Word[i] = CFE_ES_PerfStreamTool_Swap32(Word[i]);
+        }
+    }
+
+    if (Header.Magic != CFE_ES_PERFSTREAM_MAGIC || Header.Version != CFE_ES_PERFSTREAM_VERSION)
+    {
+        fprintf(stderr, "%s: not a performance stream file (or unsupported version)\n", FileName);
+        fclose(fp);
+        return -1;
+    }
+
+    if (Header.TimerTicksPerSecond == 0)
+    {
+        fprintf(stderr, "%s: invalid timer tick rate\n", FileName);
+        fclose(fp);
+        return -1;
+    }
+
+    if (Header.LostEntries != 0)
+    {
+        fprintf(stderr, "%s: %lu entries lost so far in this stream\n", FileName, (unsigned long)Header.LostEntries);
+    }
+
+    Ticks = ((uint64_t)Header.BaseTicksUpper << 32) | Header.BaseTicksLower;
+    Count = 0;
+
+    while (CFE_ES_PerfStreamTool_GetVarint(fp, &MarkerValue))
+    {
+        if (!CFE_ES_PerfStreamTool_GetVarint(fp, &Delta))
+        {
+            fprintf(stderr, "%s: truncated record\n", FileName);
+            break;
+        }
+
+        /* Undo the zigzag encoding of the signed tick difference */
+        if (Delta & 1)
+        {
+            Ticks -= (Delta >> 1) + 1;
+        }
+        else
+        {
+            Ticks += Delta >> 1;
+        }
+
+        Marker = (uint32_t)(MarkerValue >> 1);
+        TimeUs = ((double)Ticks * 1000000.0) / Header.TimerTicksPerSecond;
+
+        if (Marker < CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS)
+        {
+            CFE_ES_PerfStreamTool_State.Seen[Marker] = true;
+        }
+
+        printf("%s\n{\"name\":\"%lu\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%lu}",
+               CFE_ES_PerfStreamTool_State.IsFirstEvent ? "" : ",",
+               (unsigned long)Marker,
+               (MarkerValue & 1) ? 'E' : 'B',
+               TimeUs,
+               (unsigned long)Marker);
+        CFE_ES_PerfStreamTool_State.IsFirstEvent = false;
+        ++Count;
+    }
+
+    fprintf(stderr, "%s: sequence %lu, %lu entries\n", FileName, (unsigned long)Header.FileSequence, Count);
+
+    fclose(fp);
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Writes the timeline names for all markers that appeared in the stream
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStreamTool_WriteNames(void)
+{
+    uint32_t Marker;
+
+    for (Marker = 0; Marker < CFE_ES_PERFSTREAM_TOOL_MAX_MARKERS; ++Marker)
+    {
+        if (!CFE_ES_PerfStreamTool_State.Seen[Marker])
+        {
+            continue;
+        }
+
+        printf("%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%lu,\"args\":{\"name\":\"",
+               CFE_ES_PerfStreamTool_State.IsFirstEvent ? "" : ",",
+               (unsigned long)Marker);
+        if (CFE_ES_PerfStreamTool_State.Name[Marker] != NULL)
+        {
+            printf("%s", CFE_ES_PerfStreamTool_State.Name[Marker]);
+        }
+        else
+        {
+            printf("Marker %lu", (unsigned long)Marker);
+        }
+        printf("\"}}");
+        CFE_ES_PerfStreamTool_State.IsFirstEvent = false;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int  i;
+    int  Result;
+    bool HaveFile;
+
+    Result   = EXIT_SUCCESS;
+    HaveFile = false;
+
+    CFE_ES_PerfStreamTool_State.IsFirstEvent = true;
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-n") == 0)
+        {
+            ++i;
+            if (i >= argc || CFE_ES_PerfStreamTool_ReadNames(argv[i]) != 0)
+            {
+                Result = EXIT_FAILURE;
+                break;
+            }
+        }
+        else if (argv[i][0] == '-')
+        {
+            Result = EXIT_FAILURE;
+            break;
+        }
+        else
+        {
+            HaveFile = true;
+            if (CFE_ES_PerfStreamTool_ConvertFile(argv[i]) != 0)
+            {
+                Result = EXIT_FAILURE;
+            }
+        }
+    }
+
+    CFE_ES_PerfStreamTool_WriteNames();
+
+    printf("\n]}\n");
+
+    if (!HaveFile || (Result != EXIT_SUCCESS && i < argc))
+    {
+        CFE_ES_PerfStreamTool_PrintUsage(argv[0]);
+        Result = EXIT_FAILURE;
+    }
+
+    return Result;
+}
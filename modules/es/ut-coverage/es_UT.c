@@ -56,6 +56,8 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestApps);
     UT_ADD_TEST(TestLibs);
     UT_ADD_TEST(TestERLog);
+    UT_ADD_TEST(TestLockProfile);
+    UT_ADD_TEST(TestCmdStats);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
     UT_ADD_TEST(TestAPI);
@@ -535,6 +537,18 @@ static void ES_UT_ForEachObjectFail(void *UserObj, UT_EntryKey_t FuncKey, const
     (*callback_ptr)(id, callback_arg);
 }
 
+static void ES_UT_LockProfileTimebase(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *Tbu   = UT_Hook_GetArgValueByName(Context, "Tbu", uint32 *);
+    uint32 *Tbl   = UT_Hook_GetArgValueByName(Context, "Tbl", uint32 *);
+    uint64 *Ticks = (uint64 *)UserObj;
+
+    /* Each read of the timebase is 1000 ticks after the previous one */
+    *Tbu = (uint32)(*Ticks >> 32);
+    *Tbl = (uint32)*Ticks;
+    *Ticks += 1000;
+}
+
 static void ES_UT_Config_IterateAll(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     CFE_Config_Callback_t Callback = UT_Hook_GetArgValueByName(Context, "Callback", CFE_Config_Callback_t);
@@ -1590,6 +1604,291 @@ void TestERLog(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+void TestLockProfile(void)
+{
+    static const char               UT_FuncName[] = "UT_Func";
+    CFE_ES_LockProfileRecord_t     *RecordPtr;
+    CFE_ES_LockProfileSite_t       *SitePtr;
+    CFE_ES_LockProfileTimes_t       Times;
+    CFE_ES_LockProfileDumpGlobal_t  State;
+    void                           *LocalBuffer;
+    size_t                          LocalBufSize;
+    uint64                          Ticks;
+    uint64                          WaitStart;
+    uint32                          Idx;
+    uint32                          NumRecords;
+
+    UtPrintf("Begin Test Lock Profile");
+
+    /* Test that the profiler stays disabled without a timebase rate */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 0);
+    CFE_ES_LockProfileInit();
+    UtAssert_BOOL_FALSE(CFE_ES_Global.LockProfile.IsEnabled);
+    UtAssert_ZERO(CFE_ES_LockProfileWaitStart());
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 1, 0);
+    UtAssert_ZERO(CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_ES_SHARED_DATA].Depth);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 0);
+
+    /* Force the profiler on, with a 1MHz timebase so ticks are microseconds */
+    ES_ResetUnitTest();
+    CFE_ES_Global.LockProfile.IsEnabled      = true;
+    CFE_ES_Global.LockProfile.TicksPerSecond = 1000000;
+    Ticks                                    = 0;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_LockProfileTimebase, &Ticks);
+    RecordPtr = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_ES_SHARED_DATA];
+
+    /* Test a nested take and release, only the outermost is recorded */
+    WaitStart = CFE_ES_LockProfileWaitStart();
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 10, WaitStart);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 20, WaitStart);
+    UtAssert_UINT32_EQ(RecordPtr->Depth, 2);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_NOT_NULL(RecordPtr->HolderSitePtr);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_ZERO(RecordPtr->Depth);
+    UtAssert_NULL(RecordPtr->HolderSitePtr);
+
+    SitePtr = NULL;
+    for (Idx = 0; Idx < CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES; ++Idx)
+    {
+        if (RecordPtr->Sites[Idx].FunctionName != NULL)
+        {
+            UtAssert_NULL(SitePtr);
+            SitePtr = &RecordPtr->Sites[Idx];
+        }
+    }
+    UtAssert_NOT_NULL(SitePtr);
+    UtAssert_ADDRESS_EQ(SitePtr->FunctionName, UT_FuncName);
+    UtAssert_INT32_EQ(SitePtr->LineNumber, 10);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Count, 1);
+    UtAssert_UINT32_EQ(SitePtr->Wait.MaxTime, 1000);
+    UtAssert_UINT32_EQ(SitePtr->Wait.TotalTime, 1000);
+    UtAssert_UINT32_EQ(SitePtr->Hold.Count, 1);
+    UtAssert_UINT32_EQ(SitePtr->Hold.MaxTime, 1000);
+    if (CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS > 10)
+    {
+        UtAssert_UINT32_EQ(SitePtr->Wait.Bin[10], 1);
+    }
+
+    /* Test a second take from the same place, with the timebase going backwards */
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 10, Ticks + 5000);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Count, 2);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Bin[0], 1);
+    UtAssert_UINT32_EQ(SitePtr->Hold.Count, 2);
+
+    /* Test an unbalanced release and an invalid lock ID, neither has any effect */
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_ZERO(RecordPtr->Depth);
+    UtAssert_UINT32_EQ(SitePtr->Hold.Count, 2);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_MAX, UT_FuncName, 10, 0);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_MAX);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Count, 2);
+
+    /* Test a wait too long to count in microseconds, with a rollover value */
+    CFE_ES_Global.LockProfile.Low32Rollover = 1000;
+    Ticks                                   = 0x0000100000000000;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 10, 0);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_UINT32_EQ(SitePtr->Wait.MaxTime, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Bin[CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS - 1], 1);
+    CFE_ES_Global.LockProfile.Low32Rollover = 0;
+
+    /* Test takes that cannot be recorded, without a name or with all records in use */
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, NULL, 0, 0);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_UINT32_EQ(RecordPtr->DroppedCount, 1);
+    for (Idx = 0; Idx < CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES; ++Idx)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, UT_FuncName, 100 + Idx, 0);
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    }
+    UtAssert_UINT32_EQ(RecordPtr->DroppedCount, 2);
+    UtAssert_UINT32_EQ(SitePtr->Wait.Count, 3);
+
+    /* Test the time statistics at both ends of the histogram */
+    memset(&Times, 0, sizeof(Times));
+    CFE_ES_LockProfileTimes_Add(&Times, 0);
+    CFE_ES_LockProfileTimes_Add(&Times, 1);
+    CFE_ES_LockProfileTimes_Add(&Times, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(Times.Count, 3);
+    UtAssert_UINT32_EQ(Times.MaxTime, 0xFFFFFFFF);
+    UtAssert_True(Times.TotalTime == 0x100000000, "TotalTime (%lu) == 0x100000000", (unsigned long)Times.TotalTime);
+    UtAssert_UINT32_EQ(Times.Bin[0], 1);
+    UtAssert_UINT32_EQ(Times.Bin[CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS - 1], 1);
+    if (CFE_MISSION_ES_LOCK_PROFILE_HIST_BINS > 2)
+    {
+        UtAssert_UINT32_EQ(Times.Bin[1], 1);
+    }
+
+    /* Test lock profile background write functions */
+    ES_ResetUnitTest();
+    memset(&State, 0, sizeof(State));
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+    RecordPtr    = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_SB_SHARED_DATA];
+
+    RecordPtr->Sites[1].FunctionName = UT_FuncName;
+    RecordPtr->Sites[1].LineNumber   = 5;
+    RecordPtr->Sites[1].Hold.Count   = 3;
+    RecordPtr->DroppedCount          = 2;
+
+    NumRecords = CFE_ES_LockProfileId_MAX * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+    Idx        = CFE_ES_LockProfileId_SB_SHARED_DATA * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+
+    /* Record in use */
+    memset(&State.EntryBuffer, 0xEE, sizeof(State.EntryBuffer));
+    UtAssert_BOOL_FALSE(CFE_ES_LockProfileDataGetter(&State, Idx + 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State.EntryBuffer);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(State.EntryBuffer));
+    UtAssert_STRINGBUF_EQ(State.EntryBuffer.LockName, sizeof(State.EntryBuffer.LockName), "SB_SHARED_DATA", SIZE_MAX);
+    UtAssert_STRINGBUF_EQ(State.EntryBuffer.FunctionName,
+                          sizeof(State.EntryBuffer.FunctionName),
+                          UT_FuncName,
+                          SIZE_MAX);
+    UtAssert_UINT32_EQ(State.EntryBuffer.LineNumber, 5);
+    UtAssert_UINT32_EQ(State.EntryBuffer.Hold.Count, 3);
+    UtAssert_ZERO(State.EntryBuffer.Wait.Count);
+
+    /* Record not in use */
+    UtAssert_BOOL_FALSE(CFE_ES_LockProfileDataGetter(&State, Idx, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Dropped count record, only written if nonzero */
+    UtAssert_BOOL_FALSE(CFE_ES_LockProfileDataGetter(
+        &State, Idx + CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES, &LocalBuffer, &LocalBufSize));
+    UtAssert_NOT_NULL(LocalBuffer);
+    UtAssert_ZERO(State.EntryBuffer.FunctionName[0]);
+    UtAssert_UINT32_EQ(State.EntryBuffer.Wait.Count, 2);
+    UtAssert_BOOL_FALSE(
+        CFE_ES_LockProfileDataGetter(&State, CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+
+    /* Last record and beyond */
+    UtAssert_BOOL_TRUE(CFE_ES_LockProfileDataGetter(&State, NumRecords - 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_BOOL_TRUE(CFE_ES_LockProfileDataGetter(&State, NumRecords, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Test lock profile background write event handling */
+    UT_ClearEventHistory();
+    CFE_ES_LockProfileEventHandler(&State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_LockProfileEventHandler(&State, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_LockProfileEventHandler(&State, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_LockProfileEventHandler(&State, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_LockProfileEventHandler(&State, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+void TestCmdStats(void)
+{
+    CFE_ES_CmdStatsTlm_Payload_t Payload;
+    CFE_ES_CmdStatsRecord_t     *RecordPtr;
+    CFE_ES_CmdStatsEntry_t      *EntryPtr;
+    CFE_SB_MsgId_t               MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID);
+    uint64                       Ticks;
+    uint64                       StartTicks;
+
+    UtPrintf("Begin Test Command Statistics");
+
+    /* Test that recording stays disabled without a timebase rate */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 0);
+    CFE_ES_CmdStatsInit();
+    UtAssert_BOOL_FALSE(CFE_ES_Global.CmdStats.IsEnabled);
+    UtAssert_ZERO(CFE_ES_CmdStatsStart());
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 1, MsgId, 0, 0);
+    UtAssert_ZERO(CFE_ES_Global.CmdStats.Services[CFE_ES_CmdStatsService_ES].Entries[1].Count);
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 0);
+
+    /* Test that recording follows the platform configuration with a timebase rate */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 1000000);
+    CFE_ES_CmdStatsInit();
+    UtAssert_True(CFE_ES_Global.CmdStats.IsEnabled == CFE_PLATFORM_ES_CMD_STATS_ENABLE,
+                  "IsEnabled (%d) == CFE_PLATFORM_ES_CMD_STATS_ENABLE (%d)",
+                  (int)CFE_ES_Global.CmdStats.IsEnabled,
+                  (int)CFE_PLATFORM_ES_CMD_STATS_ENABLE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.CmdStats.TicksPerSecond, 1000000);
+
+    /* Force recording on, with a 1MHz timebase so ticks are microseconds */
+    ES_ResetUnitTest();
+    CFE_ES_Global.CmdStats.IsEnabled      = true;
+    CFE_ES_Global.CmdStats.TicksPerSecond = 1000000;
+    Ticks                                 = 0;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_LockProfileTimebase, &Ticks);
+    RecordPtr = &CFE_ES_Global.CmdStats.Services[CFE_ES_CmdStatsService_ES];
+    EntryPtr  = &RecordPtr->Entries[2];
+
+    /* Test recording a command, each read of the timebase is 1000 ticks apart */
+    StartTicks = CFE_ES_CmdStatsStart();
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 2, MsgId, 1, StartTicks);
+    CFE_UtAssert_MSGID_EQ(EntryPtr->MsgId, MsgId);
+    UtAssert_UINT32_EQ(EntryPtr->FcnCode, 1);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 1);
+    UtAssert_UINT32_EQ(EntryPtr->MaxTime, 1000);
+    UtAssert_True(EntryPtr->TotalTime == 1000, "TotalTime (%lu) == 1000", (unsigned long)EntryPtr->TotalTime);
+
+    /* Test a longer command, which updates the maximum */
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 2, MsgId, 1, 0);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 2);
+    UtAssert_UINT32_EQ(EntryPtr->MaxTime, 2000);
+    UtAssert_True(EntryPtr->TotalTime == 3000, "TotalTime (%lu) == 3000", (unsigned long)EntryPtr->TotalTime);
+
+    /* Test a command with the timebase going backwards, counted as zero time */
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 2, MsgId, 1, Ticks + 5000);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 3);
+    UtAssert_UINT32_EQ(EntryPtr->MaxTime, 2000);
+    UtAssert_True(EntryPtr->TotalTime == 3000, "TotalTime (%lu) == 3000", (unsigned long)EntryPtr->TotalTime);
+
+    /* Test a command with a rollover value for the lower timebase register */
+    CFE_ES_Global.CmdStats.Low32Rollover = 1000;
+    Ticks                                = 0x0000000300000000;
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 2, MsgId, 1, 0);
+    UtAssert_UINT32_EQ(EntryPtr->MaxTime, 3000);
+    CFE_ES_Global.CmdStats.Low32Rollover = 0;
+
+    /* Test a command too long to count in microseconds */
+    Ticks = 0x0000100000000000;
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, 2, MsgId, 1, 0);
+    UtAssert_UINT32_EQ(EntryPtr->MaxTime, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 5);
+
+    /* Test commands that cannot be recorded, beyond the entries or with an invalid service */
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_ES, CFE_MISSION_ES_CMD_STATS_MAX_ENTRIES, MsgId, 1, 0);
+    UtAssert_UINT32_EQ(RecordPtr->DroppedCount, 1);
+    CFE_ES_CmdStatsRecord(CFE_ES_CmdStatsService_MAX, 2, MsgId, 1, 0);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 5);
+
+    /* Test copying the statistics of a service to the telemetry payload */
+    CFE_ES_CmdStatsGetPayload(CFE_ES_CmdStatsService_ES, &Payload);
+    UtAssert_UINT32_EQ(Payload.Service, CFE_ES_CmdStatsService_ES);
+    UtAssert_UINT32_EQ(Payload.DroppedCount, 1);
+    UtAssert_UINT32_EQ(Payload.Entries[2].Count, 5);
+    UtAssert_ZERO(Payload.Entries[0].Count);
+
+    /* Test an invalid service, which gives an empty payload */
+    CFE_ES_CmdStatsGetPayload(CFE_ES_CmdStatsService_MAX, &Payload);
+    UtAssert_UINT32_EQ(Payload.Service, CFE_ES_CmdStatsService_MAX);
+    UtAssert_ZERO(Payload.DroppedCount);
+    UtAssert_ZERO(Payload.Entries[2].Count);
+}
+
 void TestGenericPool(void)
 {
     CFE_ES_GenPoolRecord_t Pool1;
@@ -1605,6 +1904,7 @@ void TestGenericPool(void)
     uint16                 NumBlocks;
     uint32                 CountBuf;
     uint32                 ErrBuf;
+    uint32                 MismatchCount;
     CFE_ES_BlockStats_t    BlockStats;
     static const size_t    UT_POOL_BLOCK_SIZES[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] = {
         /*
@@ -1644,6 +1944,30 @@ void TestGenericPool(void)
                                                   ES_UT_PoolDirectRetrieve,
                                                   ES_UT_PoolDirectCommit));
 
+    /* Size class boundaries */
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(0), 0);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(1), 0);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(2), 1);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(64), 6);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(65), 7);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolSizeClass(SIZE_MAX), CFE_ES_GENERIC_POOL_SIZE_CLASSES - 1);
+
+    /* The size class lookup must select the same bucket as a linear scan of the sorted list */
+    MismatchCount = 0;
+    for (BlockSize = 0; BlockSize <= 130; ++BlockSize)
+    {
+        for (i = 0; i < Pool1.NumBuckets && BlockSize > Pool1.Buckets[i].BlockSize; ++i)
+        {
+            /* find first bucket that fits */
+        }
+        if (CFE_ES_GenPoolFindBucket(&Pool1, BlockSize) != (Pool1.NumBuckets - i))
+        {
+            ++MismatchCount;
+        }
+    }
+    UtAssert_ZERO(MismatchCount);
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool1, SIZE_MAX));
+
     /* Allocate buffers until no space left */
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 44));
     UtAssert_NONZERO(Offset1);
@@ -1946,6 +2270,25 @@ void TestGenericPool(void)
     BdPtr->ActualSize = 0;
     UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
 
+    /* Block size lookup limited to a given tail position */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1,
+                                                  0,
+                                                  sizeof(UT_MemPoolIndirectBuffer.Data),
+                                                  32,
+                                                  CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                                  UT_POOL_BLOCK_SIZES,
+                                                  ES_UT_PoolDirectRetrieve,
+                                                  ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 44));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 72));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSizeInRange(&Pool1, &BlockSize, Offset1, Offset2));
+    UtAssert_UINT32_EQ(BlockSize, 44);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSizeInRange(&Pool1, &BlockSize, Offset2, Offset2),
+                      CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSizeInRange(&Pool1, &BlockSize, 0, Pool1.TailPosition),
+                      CFE_ES_BUFFER_NOT_IN_POOL);
+
     /* Rebuild generic pool actual size error cases */
     ES_ResetUnitTest();
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1,
@@ -1998,9 +2341,11 @@ void TestTask(void)
         CFE_ES_OverWriteSysLogCmd_t  OverwriteSysLogCmd;
         CFE_ES_WriteSysLogCmd_t      WriteSysLogCmd;
         CFE_ES_WriteERLogCmd_t       WriteERLogCmd;
+        CFE_ES_WriteLockProfileCmd_t WriteLockProfileCmd;
         CFE_ES_SetMaxPRCountCmd_t    SetMaxPRCountCmd;
         CFE_ES_DeleteCDSCmd_t        DeleteCDSCmd;
         CFE_ES_SendMemPoolStatsCmd_t SendMemPoolStatsCmd;
+        CFE_ES_SendCmdStatsCmd_t     SendCmdStatsCmd;
         CFE_ES_DumpCDSRegistryCmd_t  DumpCDSRegistryCmd;
         CFE_ES_QueryAllTasksCmd_t    QueryAllTasksCmd;
     } CmdBuf;
@@ -2730,6 +3075,49 @@ void TestTask(void)
                     UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_ERLOG_PENDING_ERR_EID);
 
+    /* Test successful request to write the lock profile, also done by the background task */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    strncpy(CmdBuf.WriteLockProfileCmd.Payload.FileName,
+            "filename",
+            sizeof(CmdBuf.WriteLockProfileCmd.Payload.FileName) - 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+
+    /* Failure from CFE_FS_BackgroundFileDumpRequest() should send the pending error event ID */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_PENDING_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 3);
+
     /* Test scan for exceptions in the PSP, should invoke a Processor Reset */
     ES_ResetUnitTest();
     UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_Exception_GetCount), 1);
@@ -2976,6 +3364,17 @@ void TestTask(void)
                     UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_TLM_POOL_STATS_INFO_EID);
 
+    /* Test sending the command statistics, one packet per core service */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.SendCmdStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_CMD_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_CMDSTATS_EID);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, CFE_ES_CmdStatsService_MAX);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+
     /* Test the command pipe message process with an invalid command */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.NoopCmd), UT_TPID_CFE_ES_CMD_INVALID_CC);
@@ -3197,6 +3596,8 @@ void TestPerf(void)
 
     CFE_ES_PerfData_t *Perf;
     void              *TempBuff;
+    size_t             BufSize;
+    uint32             i;
 
     /*
     ** Set the pointer to the data area
@@ -3254,7 +3655,7 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_END + 1);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_STREAM + 1);
     UT_CallTaskPipe(CFE_ES_TaskPipe,
                     CFE_MSG_PTR(CmdBuf),
                     sizeof(CmdBuf.PerfStartCmd),
@@ -3435,6 +3836,7 @@ void TestPerf(void)
     Perf->MetaData.DataCount             = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     Perf->MetaData.TriggerMask[0]        = 0xFFFF;
     CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_START);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
@@ -3446,6 +3848,7 @@ void TestPerf(void)
     Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
     Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
     CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_CENTER);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
@@ -3456,6 +3859,7 @@ void TestPerf(void)
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode  = CFE_ES_PerfTrigger_END;
     CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
@@ -3464,6 +3868,7 @@ void TestPerf(void)
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
     UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3492,6 +3897,7 @@ void TestPerf(void)
     Perf->MetaData.DataCount     = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
 
     /* Test addition of a new entry to the performance log with a marker that
@@ -3501,6 +3907,7 @@ void TestPerf(void)
     Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.TriggerMask[0] = 0x0;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
 
     /* Test addition of a new entry to the performance log with a start
@@ -3512,6 +3919,7 @@ void TestPerf(void)
     Perf->MetaData.Mode           = CFE_ES_PerfTrigger_START;
     Perf->MetaData.TriggerMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
 
     /* Test addition of a new entry to the performance log with a center
@@ -3522,6 +3930,7 @@ void TestPerf(void)
     Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
     /* Test addition of a new entry to the performance log with an invalid
@@ -3532,8 +3941,312 @@ void TestPerf(void)
     Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode         = -1;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_RunPerfLogMerge(0, NULL);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+
+    /* Test that a marker is held in the calling task's ring, without locking, until merged */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.DataStart      = 0;
+    Perf->MetaData.DataEnd        = 0;
+    Perf->MetaData.DataCount      = 0;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_ZERO(Perf->MetaData.DataCount);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogMerge(0, NULL));
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].Data, 0x1);
+
+    /* Test that a full ring falls back to writing the log directly, after merging the ring */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataEnd   = 0;
+    Perf->MetaData.DataCount = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_TASK_RING_SIZE; ++i)
+    {
+        CFE_ES_PerfLogAdd(0x1, 0);
+    }
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    CFE_ES_PerfLogAdd(0x1, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_TASK_RING_SIZE + 1);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_TASK_RING_SIZE].Data,
+                       0x1 | CFE_ES_DBIT(CFE_MISSION_ES_PERF_EXIT_BIT));
+
+    /* Test that a caller which is not an OSAL task writes the log directly */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataEnd   = 0;
+    Perf->MetaData.DataCount = 0;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERROR);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+
+    /* Test that entries from several rings are merged in timestamp order */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataEnd   = 0;
+    Perf->MetaData.DataCount = 0;
+    for (i = 0; i < 3; ++i)
+    {
+        CFE_ES_Global.PerfTaskRing[0].Entries[i].Data         = 10 + i;
+        CFE_ES_Global.PerfTaskRing[0].Entries[i].TimerUpper32 = 1;
+        CFE_ES_Global.PerfTaskRing[0].Entries[i].TimerLower32 = 2 * i;
+        CFE_ES_Global.PerfTaskRing[1].Entries[i].Data         = 20 + i;
+        CFE_ES_Global.PerfTaskRing[1].Entries[i].TimerUpper32 = i / 2;
+        CFE_ES_Global.PerfTaskRing[1].Entries[i].TimerLower32 = 2 * i + 1;
+    }
+    CFE_ES_Global.PerfTaskRing[0].WriteCount = 3;
+    CFE_ES_Global.PerfTaskRing[1].WriteCount = 3;
+    CFE_ES_PerfLogMergeTaskRings();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 6);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].Data, 20);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[1].Data, 21);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[2].Data, 10);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[3].Data, 11);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[4].Data, 12);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[5].Data, 22);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[0].ReadCount, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[1].ReadCount, 3);
+
+    /* Test that the merge job does nothing while the log is idle */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogMerge(0, NULL));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test that starting collection discards stale ring entries */
+    ES_ResetUnitTest();
+    CFE_ES_Global.PerfTaskRing[1].WriteCount = 5;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfTaskRing[1].ReadCount, 5);
+
+    /* Test that stopping collection merges the pending ring entries first */
+    ES_ResetUnitTest();
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode      = CFE_ES_PerfTrigger_START;
+    Perf->MetaData.DataEnd   = 0;
+    Perf->MetaData.DataCount = 0;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+
+    /* Test successful performance data collection start in STREAM mode */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundPerfStreamState.IsActive);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.FileWrite.FileSubType, CFE_FS_SubType_ES_PERFSTREAM);
+
+    /* Test that a new collection cannot be started while still streaming */
+    ES_ResetUnitTest();
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
+
+    /* Test that entries overwritten by a full buffer in STREAM mode are counted */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_STREAM;
+    Perf->MetaData.DataCount      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERROR);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.LostEntries, 1);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
+    /* Test the stream job does nothing when not streaming, or while a file is being written */
+    ES_ResetUnitTest();
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* Test the stream job waits until enough entries are available while collecting */
+    ES_ResetUnitTest();
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    Perf->MetaData.State                             = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.DataCount                         = 1;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* Test the stream job starts the next file in the series */
+    Perf->MetaData.DataCount                             = CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES / 2;
+    CFE_ES_Global.BackgroundPerfStreamState.FileSequence = CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES + 1;
+    CFE_ES_Global.BackgroundPerfStreamState.FileEntries  = 5;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_ZERO(CFE_ES_Global.BackgroundPerfStreamState.FileEntries);
+    UtAssert_StrCmp(CFE_ES_Global.BackgroundPerfStreamState.FileWrite.FileName,
+                    CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME "_001.dat",
+                    "%s",
+                    CFE_ES_Global.BackgroundPerfStreamState.FileWrite.FileName);
+
+    /* A failed request while collecting is retried later without an event */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTNOTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+
+    /* Once stopped, the remaining entries are written regardless of count */
+    ES_ResetUnitTest();
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    Perf->MetaData.State                             = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataCount                         = 1;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+
+    /* A failed request once stopped ends the stream */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundPerfStreamState.IsActive);
+
+    /* The stream ends once stopped and all entries are written */
+    ES_ResetUnitTest();
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    Perf->MetaData.State                             = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataCount                         = 0;
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(0, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundPerfStreamState.IsActive);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* Test the stream file content: header, then encoded records */
+    ES_ResetUnitTest();
+    i                                  = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->MetaData.TimerLow32Rollover  = 0;
+    Perf->MetaData.DataStart           = i;
+    Perf->MetaData.DataCount           = 3;
+    Perf->DataBuffer[i].Data           = 5;
+    Perf->DataBuffer[i].TimerUpper32   = 1;
+    Perf->DataBuffer[i].TimerLower32   = 100;
+    Perf->DataBuffer[0].Data           = 5 | CFE_ES_DBIT(CFE_MISSION_ES_PERF_EXIT_BIT);
+    Perf->DataBuffer[0].TimerUpper32   = 1;
+    Perf->DataBuffer[0].TimerLower32   = 300;
+    Perf->DataBuffer[1].Data           = 70;
+    Perf->DataBuffer[1].TimerUpper32   = 1;
+    Perf->DataBuffer[1].TimerLower32   = 299;
+
+    CFE_ES_Global.BackgroundPerfStreamState.LostEntries = 2;
+    UtAssert_BOOL_FALSE(
+        CFE_ES_PerfStreamDataGetter(&CFE_ES_Global.BackgroundPerfStreamState, 0, &TempBuff, &BufSize));
+    UtAssert_ADDRESS_EQ(TempBuff, &CFE_ES_Global.BackgroundPerfStreamState.Header);
+    UtAssert_UINT32_EQ(BufSize, sizeof(CFE_ES_PerfStreamHeader_t));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Header.Magic, CFE_ES_PERFSTREAM_MAGIC);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Header.LostEntries, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Header.BaseTicksUpper, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Header.BaseTicksLower, 100);
+    UtAssert_BOOL_TRUE(CFE_ES_PerfStreamDataGetter(&CFE_ES_Global.BackgroundPerfStreamState, 1, &TempBuff, &BufSize));
+    UtAssert_ADDRESS_EQ(TempBuff, CFE_ES_Global.BackgroundPerfStreamState.Block);
+    /* marker 5 enter (+0), marker 5 exit (+200, 2 byte delta), marker 70 enter (2 byte marker, -1) */
+    UtAssert_UINT32_EQ(BufSize, 8);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[0], 10);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[1], 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[2], 11);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[3], 0x90);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[4], 0x03);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[5], 0x8C);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[6], 0x01);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Block[7], 0x01);
+    UtAssert_ZERO(Perf->MetaData.DataCount);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.FileEntries, 3);
+
+    /* Test that a file ends after the configured number of entries, with data still waiting */
+    ES_ResetUnitTest();
+    Perf->MetaData.TimerLow32Rollover                   = 1000;
+    Perf->MetaData.DataStart                            = 0;
+    Perf->MetaData.DataCount                            = 2;
+    CFE_ES_Global.BackgroundPerfStreamState.FileEntries = CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES - 1;
+    UtAssert_BOOL_FALSE(
+        CFE_ES_PerfStreamDataGetter(&CFE_ES_Global.BackgroundPerfStreamState, 0, &TempBuff, &BufSize));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.Header.BaseTicksLower, 1300);
+    UtAssert_BOOL_TRUE(CFE_ES_PerfStreamDataGetter(&CFE_ES_Global.BackgroundPerfStreamState, 1, &TempBuff, &BufSize));
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+
+    /* Test a full block is returned without reaching the end of the file */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataStart = 0;
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    UtAssert_BOOL_FALSE(
+        CFE_ES_PerfStreamDataGetter(&CFE_ES_Global.BackgroundPerfStreamState, 1, &TempBuff, &BufSize));
+    UtAssert_NONZERO(BufSize);
+    UtAssert_UINT32_LTEQ(BufSize, CFE_ES_PERF_STREAM_BLOCK_SIZE);
+
+    /* Test the stream file event handler */
+    ES_ResetUnitTest();
+    CFE_ES_PerfStreamEventHandler(&CFE_ES_Global.BackgroundPerfStreamState,
+                                  CFE_FS_FileWriteEvent_COMPLETE,
+                                  CFE_SUCCESS,
+                                  10,
+                                  0,
+                                  1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.FileSequence, 1);
+
+    ES_ResetUnitTest();
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.DataCount = 10;
+    CFE_ES_PerfStreamEventHandler(&CFE_ES_Global.BackgroundPerfStreamState,
+                                  CFE_FS_FileWriteEvent_CREATE_ERROR,
+                                  OS_ERROR,
+                                  0,
+                                  0,
+                                  0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_ZERO(Perf->MetaData.DataCount);
+
+    ES_ResetUnitTest();
+    CFE_ES_PerfStreamEventHandler(&CFE_ES_Global.BackgroundPerfStreamState,
+                                  CFE_FS_FileWriteEvent_UNDEFINED,
+                                  OS_ERROR,
+                                  0,
+                                  0,
+                                  0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Test stopping collection in STREAM mode leaves the rest to the stream job */
+    ES_ResetUnitTest();
+    Perf->MetaData.State                             = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode                              = CFE_ES_PerfTrigger_STREAM;
+    Perf->MetaData.DataCount                         = 4;
+    CFE_ES_Global.BackgroundPerfStreamState.IsActive = true;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe,
+                    CFE_MSG_PTR(CmdBuf),
+                    sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_STUB_COUNT(CFE_FS_ParseInputFileNameEx, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.PendingState, CFE_ES_PerfDumpState_IDLE);
+    Perf->MetaData.DataCount          = 0;
+    Perf->MetaData.TimerLow32Rollover = 0;
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
@@ -4113,11 +4826,13 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_CRC_16), 2688);
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
     ES_ResetUnitTest();
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_CRC_32), 0);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_CRC_32), 1314624383);
+
+    /* Test calculating a CRC on a range of memory using CRC-32C */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_32_ISCSI), 942868152);
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -5264,6 +5979,81 @@ void TestESMempool(void)
     /* Test getting the size of a pool buffer with an invalid memory handle, NULL buffer */
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(CFE_ES_MEMHANDLE_UNDEFINED, addressp1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
+
+    /* Test successfully creating a concurrent memory pool, it only has the pool mutex */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateConcurrent(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL));
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_TRUE(CFE_ES_MemPoolIsConcurrent(PoolPtr));
+
+    /* Creating a new block takes the pool mutex */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UT_ResetState(UT_KEY(OS_MutSemGive));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 256), 256);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Info, put and recycling a block take no mutex */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UT_ResetState(UT_KEY(OS_MutSemGive));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp1), 256);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 256);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 256), 256);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+
+    /* A block that fails validation is counted for the pool */
+    BdPtr             = ((CFE_ES_GenPoolBD_t *)addressp1) - 1;
+    BdPtr->ActualSize = 0;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(PoolPtr->Pool.ValidationErrorCount, 1);
+    BdPtr->ActualSize = 256;
+
+    /* Statistics count the blocks on the free stacks */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 256);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    for (i = 0; i < CFE_MISSION_ES_POOL_MAX_BUCKETS && Stats.BlockStats[i].NumFree == 0; ++i)
+    {
+        /* find the bucket with the free block */
+    }
+    UtAssert_UINT32_LT(i, CFE_MISSION_ES_POOL_MAX_BUCKETS);
+    UtAssert_UINT32_EQ(Stats.BlockStats[i].NumFree, 1);
+
+    /* A corrupted block on a free stack is left there, and a new block is created instead */
+    BdPtr->CheckBits = ~CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 256), 256);
+    UtAssert_BOOL_TRUE(addressp2 != addressp1);
+    BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 256), 256);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+
+    /* Requests that do not fit and blocks that are not in the pool still fail */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 99000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, CFE_ES_MEMPOOLBUF_C((cpuaddr)addressp1 + 400)),
+                      CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Deleting the pool releases the mutex */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID1));
+    UtAssert_STUB_COUNT(OS_MutSemDelete, 1);
+
+    /* Test creating a concurrent memory pool with a mutex error */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    CFE_UtAssert_RESOURCEID_EQ(PoolID1, CFE_ES_MEMHANDLE_UNDEFINED);
+
+    /* Test creating a concurrent memory pool too large for the free stacks */
+    if (sizeof(size_t) > 4)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID1, Buffer1, SIZE_MAX, 0, NULL), CFE_ES_BAD_ARGUMENT);
+    }
+
+    /* Test creating a concurrent memory pool with the pool size too small */
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateConcurrent(&PoolID1, Buffer1, 0, 0, NULL), CFE_ES_BAD_ARGUMENT);
 }
 
 /* Tests to fill gaps in coverage in SysLog */
@@ -5375,6 +6165,7 @@ void TestBackground(void)
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
     UT_SetDefaultReturnValue(UT_KEY(OS_write), -10);
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_Global.ResetDataPtr->Perf.MetaData.State    = CFE_ES_PERF_IDLE;
     UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 2, OS_SEM_TIMEOUT);
     UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
     UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
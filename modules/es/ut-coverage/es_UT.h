@@ -183,6 +183,42 @@ void TestApps(void);
 ******************************************************************************/
 void TestERLog(void);
 
+/*****************************************************************************/
+/**
+** \brief Perform tests of the ES lock contention profiler contained in
+**        cfe_es_lockprof.c
+**
+** \par Description
+**        This function tests recording of lock takes including nested takes,
+**        takes that cannot be recorded, the time histogram limits, and the
+**        lock profile file data getter and event handler.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestLockProfile(void);
+
+/*****************************************************************************/
+/**
+** \brief Perform tests of the ES command execution statistics contained
+**        in cfe_es_cmdstats.c
+**
+** \par Description
+**        This function tests recording the execution time of commands,
+**        commands that cannot be recorded, and copying the statistics of
+**        a service to the telemetry payload.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestCmdStats(void);
+
 /*****************************************************************************/
 /**
 ** \brief Performs tests of the ground command functions contained in
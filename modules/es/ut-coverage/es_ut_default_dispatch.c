@@ -82,6 +82,8 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_CLEAR_ER_LOG_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_CLEAR_ER_LOG_CC, ClearERLogCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_ER_LOG_CC, WriteERLogCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_LOCK_PROFILE_CC, WriteLockProfileCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_START_PERF_DATA_CC, StartPerfDataCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC =
@@ -98,6 +100,8 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DELETE_CDS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DELETE_CDS_CC, DeleteCDSCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_MEM_POOL_STATS_CC, SendMemPoolStatsCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_CMD_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_CMD_STATS_CC, SendCmdStatsCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DUMP_CDS_REGISTRY_CC, DumpCDSRegistryCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK =
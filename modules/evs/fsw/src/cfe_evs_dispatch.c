@@ -24,14 +24,65 @@
 
 /* Include Files */
 #include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "cfe_core_cmddispatch.h"
 
 #include <string.h>
 
+/* local cache of runtime MsgIDs for EVS */
+static CFE_SB_MsgId_t CFE_EVS_CMD_MID_CACHE     = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_EVS_SEND_HK_MID_CACHE = CFE_SB_MSGID_RESERVED;
+
 /*
-** Local function prototypes.
-*/
-void CFE_EVS_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, CFE_SB_MsgId_t MsgId);
-bool CFE_EVS_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
+ * Command dispatch table, indexed by function code
+ */
+static const CFE_CORE_CmdDispatchEntry_t CFE_EVS_CMD_DISPATCH[] = {
+    [CFE_EVS_NOOP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_NoopCmd_t, CFE_EVS_NoopCmd),
+    [CFE_EVS_RESET_COUNTERS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_ResetCountersCmd_t, CFE_EVS_ResetCountersCmd),
+    [CFE_EVS_ENABLE_EVENT_TYPE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_EnableEventTypeCmd_t, CFE_EVS_EnableEventTypeCmd),
+    [CFE_EVS_DISABLE_EVENT_TYPE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_DisableEventTypeCmd_t, CFE_EVS_DisableEventTypeCmd),
+    [CFE_EVS_SET_EVENT_FORMAT_MODE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_SetEventFormatModeCmd_t, CFE_EVS_SetEventFormatModeCmd),
+    [CFE_EVS_ENABLE_APP_EVENT_TYPE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_EnableAppEventTypeCmd_t, CFE_EVS_EnableAppEventTypeCmd),
+    [CFE_EVS_DISABLE_APP_EVENT_TYPE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_DisableAppEventTypeCmd_t, CFE_EVS_DisableAppEventTypeCmd),
+    [CFE_EVS_ENABLE_APP_EVENTS_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_EnableAppEventsCmd_t, CFE_EVS_EnableAppEventsCmd),
+    [CFE_EVS_DISABLE_APP_EVENTS_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_DisableAppEventsCmd_t, CFE_EVS_DisableAppEventsCmd),
+    [CFE_EVS_RESET_APP_COUNTER_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_ResetAppCounterCmd_t, CFE_EVS_ResetAppCounterCmd),
+    [CFE_EVS_SET_FILTER_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_SetFilterCmd_t, CFE_EVS_SetFilterCmd),
+    [CFE_EVS_ENABLE_PORTS_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_EnablePortsCmd_t, CFE_EVS_EnablePortsCmd),
+    [CFE_EVS_DISABLE_PORTS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_DisablePortsCmd_t, CFE_EVS_DisablePortsCmd),
+    [CFE_EVS_RESET_FILTER_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_ResetFilterCmd_t, CFE_EVS_ResetFilterCmd),
+    [CFE_EVS_RESET_ALL_FILTERS_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_ResetAllFiltersCmd_t, CFE_EVS_ResetAllFiltersCmd),
+    [CFE_EVS_ADD_EVENT_FILTER_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_AddEventFilterCmd_t, CFE_EVS_AddEventFilterCmd),
+    [CFE_EVS_DELETE_EVENT_FILTER_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_DeleteEventFilterCmd_t, CFE_EVS_DeleteEventFilterCmd),
+    [CFE_EVS_WRITE_APP_DATA_FILE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_WriteAppDataFileCmd_t, CFE_EVS_WriteAppDataFileCmd),
+    [CFE_EVS_SET_LOG_MODE_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_SetLogModeCmd_t, CFE_EVS_SetLogModeCmd),
+    [CFE_EVS_CLEAR_LOG_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_ClearLogCmd_t, CFE_EVS_ClearLogCmd),
+    [CFE_EVS_WRITE_LOG_DATA_FILE_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_EVS_WriteLogDataFileCmd_t, CFE_EVS_WriteLogDataFileCmd),
+};
+
+/* The housekeeping request has no function codes and no length check */
+static const CFE_CORE_CmdDispatchEntry_t CFE_EVS_SEND_HK_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_EVS_SendHkCmd);
+
+/* Command statistics index of each message, after the one of the housekeeping request */
+static const CFE_CORE_CmdDispatchSlot_t CFE_EVS_DISPATCH_SLOTS[] = {
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_EVS_SEND_HK_MID_CACHE, CFE_EVS_SEND_HK_DISPATCH, 0),
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_EVS_CMD_MID_CACHE, CFE_EVS_CMD_DISPATCH, 1),
+};
+
+static const CFE_CORE_CmdDispatchTable_t CFE_EVS_DISPATCH_TABLE =
+    CFE_CORE_CMDDISPATCH_TABLE(CFE_EVS_DISPATCH_SLOTS, CFE_ES_CmdStatsService_EVS);
 
 /*----------------------------------------------------------------
  *
@@ -41,30 +92,46 @@ bool CFE_EVS_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLen
  *-----------------------------------------------------------------*/
 void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID     = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID = CFE_SB_MSGID_RESERVED;
-
-    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_HeaderView_t               HdrView;
+    const CFE_CORE_CmdDispatchEntry_t *EntryPtr;
+    uint16                             StatsIndex;
+    CFE_SB_MsgId_t                     MessageID;
+    int32                              Status;
 
     /* cache the local MID Values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CMD_MID))
+    if (!CFE_SB_IsValidMsgId(CFE_EVS_CMD_MID_CACHE))
     {
-        CMD_MID     = CFE_SB_ValueToMsgId(CFE_EVS_CMD_MID);
-        SEND_HK_MID = CFE_SB_ValueToMsgId(CFE_EVS_SEND_HK_MID);
+        CFE_EVS_CMD_MID_CACHE     = CFE_SB_ValueToMsgId(CFE_EVS_CMD_MID);
+        CFE_EVS_SEND_HK_MID_CACHE = CFE_SB_ValueToMsgId(CFE_EVS_SEND_HK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    /* Ignore return, buffer from SB is never NULL */
+    CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+    MessageID = CFE_MSG_HeaderView_GetMsgId(&HdrView);
 
-    /* Process all SB messages */
-    if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
+    Status = CFE_CORE_CmdDispatch_Lookup(&CFE_EVS_DISPATCH_TABLE, &HdrView, &EntryPtr, &StatsIndex);
+
+    if (Status == CFE_SUCCESS)
     {
-        /* Housekeeping request */
-        CFE_EVS_SendHkCmd((const CFE_EVS_SendHkCmd_t *)SBBufPtr);
+        Status = CFE_CORE_CmdDispatch_Invoke(&CFE_EVS_DISPATCH_TABLE, EntryPtr, StatsIndex, SBBufPtr, &HdrView);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, CMD_MID))
+    else if (Status == CFE_STATUS_WRONG_MSG_LENGTH)
     {
-        /* EVS task specific command */
-        CFE_EVS_ProcessGroundCommand(SBBufPtr, MessageID);
+        EVS_SendEvent(CFE_EVS_LEN_ERR_EID,
+                      CFE_EVS_EventType_ERROR,
+                      "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
+                      (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                      (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView),
+                      (unsigned int)CFE_MSG_HeaderView_GetSize(&HdrView),
+                      (unsigned int)EntryPtr->ExpectedLength);
+    }
+    else if (Status == CFE_STATUS_BAD_COMMAND_CODE)
+    {
+        EVS_SendEvent(CFE_EVS_ERR_CC_EID,
+                      CFE_EVS_EventType_ERROR,
+                      "Invalid command code -- ID = 0x%08x, CC = %u",
+                      (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                      (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView));
     }
     else
     {
@@ -75,252 +142,17 @@ void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
                       "Invalid command packet, Message ID = 0x%08X",
                       (unsigned int)CFE_SB_MsgIdToValue(MessageID));
     }
-}
-
-/*----------------------------------------------------------------
- *
- * Internal helper routine only, not part of API.
- *
- * This function processes a command, verifying that it is valid and of
- *  proper length.
- *
- *-----------------------------------------------------------------*/
-void CFE_EVS_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, CFE_SB_MsgId_t MsgId)
-{
-    /* status will get reset if it passes length check */
-    int32             Status  = CFE_STATUS_WRONG_MSG_LENGTH;
-    CFE_MSG_FcnCode_t FcnCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
-
-    /* Process "known" EVS task ground commands */
-    switch (FcnCode)
-    {
-        case CFE_EVS_NOOP_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_NoopCmd_t)))
-            {
-                Status = CFE_EVS_NoopCmd((const CFE_EVS_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_COUNTERS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetCountersCmd_t)))
-            {
-                Status = CFE_EVS_ResetCountersCmd((const CFE_EVS_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_EnableEventTypeCmd((const CFE_EVS_EnableEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_DisableEventTypeCmd((const CFE_EVS_DisableEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_EVENT_FORMAT_MODE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetEventFormatModeCmd_t)))
-            {
-                Status = CFE_EVS_SetEventFormatModeCmd((const CFE_EVS_SetEventFormatModeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_APP_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableAppEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_EnableAppEventTypeCmd((const CFE_EVS_EnableAppEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_APP_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableAppEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_DisableAppEventTypeCmd((const CFE_EVS_DisableAppEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_APP_EVENTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableAppEventsCmd_t)))
-            {
-                Status = CFE_EVS_EnableAppEventsCmd((const CFE_EVS_EnableAppEventsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_APP_EVENTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableAppEventsCmd_t)))
-            {
-                Status = CFE_EVS_DisableAppEventsCmd((const CFE_EVS_DisableAppEventsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_APP_COUNTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetAppCounterCmd_t)))
-            {
-                Status = CFE_EVS_ResetAppCounterCmd((const CFE_EVS_ResetAppCounterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetFilterCmd_t)))
-            {
-                Status = CFE_EVS_SetFilterCmd((const CFE_EVS_SetFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_PORTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnablePortsCmd_t)))
-            {
-                Status = CFE_EVS_EnablePortsCmd((const CFE_EVS_EnablePortsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_PORTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisablePortsCmd_t)))
-            {
-                Status = CFE_EVS_DisablePortsCmd((const CFE_EVS_DisablePortsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetFilterCmd_t)))
-            {
-                Status = CFE_EVS_ResetFilterCmd((const CFE_EVS_ResetFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_ALL_FILTERS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetAllFiltersCmd_t)))
-            {
-                Status = CFE_EVS_ResetAllFiltersCmd((const CFE_EVS_ResetAllFiltersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ADD_EVENT_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_AddEventFilterCmd_t)))
-            {
-                Status = CFE_EVS_AddEventFilterCmd((const CFE_EVS_AddEventFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DELETE_EVENT_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DeleteEventFilterCmd_t)))
-            {
-                Status = CFE_EVS_DeleteEventFilterCmd((const CFE_EVS_DeleteEventFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_WRITE_APP_DATA_FILE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_WriteAppDataFileCmd_t)))
-            {
-                Status = CFE_EVS_WriteAppDataFileCmd((const CFE_EVS_WriteAppDataFileCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_LOG_MODE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetLogModeCmd_t)))
-            {
-                Status = CFE_EVS_SetLogModeCmd((const CFE_EVS_SetLogModeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_CLEAR_LOG_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ClearLogCmd_t)))
-            {
-                Status = CFE_EVS_ClearLogCmd((const CFE_EVS_ClearLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_WRITE_LOG_DATA_FILE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_WriteLogDataFileCmd_t)))
-            {
-                Status = CFE_EVS_WriteLogDataFileCmd((const CFE_EVS_WriteLogDataFileCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /* default is a bad command code as it was not found above */
-        default:
-
-            EVS_SendEvent(CFE_EVS_ERR_CC_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Invalid command code -- ID = 0x%08x, CC = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                          (unsigned int)FcnCode);
-            Status = CFE_STATUS_BAD_COMMAND_CODE;
-
-            break;
-    }
-
-    if (Status == CFE_SUCCESS)
-    {
-        CFE_EVS_Global.EVS_TlmPkt.Payload.CommandCounter++;
-    }
-    else if (Status < 0) /* Negative values indicate errors */
-    {
-        CFE_EVS_Global.EVS_TlmPkt.Payload.CommandErrorCounter++;
-    }
-}
-
-/*----------------------------------------------------------------
- *
- * Internal helper routine only, not part of API.
- *
- * This function validates the length of a command structure, and
- * generates an error event if is not the expected length.
- *
- *-----------------------------------------------------------------*/
-bool CFE_EVS_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
-{
-    bool              result       = true;
-    CFE_MSG_Size_t    ActualLength = 0;
-    CFE_MSG_FcnCode_t FcnCode      = 0;
-    CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
-
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
 
-    /*
-    ** Verify the command packet length
-    */
-    if (ExpectedLength != ActualLength)
+    /* Only EVS task specific commands are counted, not the housekeeping request */
+    if (CFE_SB_MsgId_Equal(MessageID, CFE_EVS_CMD_MID_CACHE))
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
-
-        EVS_SendEvent(CFE_EVS_LEN_ERR_EID,
-                      CFE_EVS_EventType_ERROR,
-                      "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                      (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                      (unsigned int)FcnCode,
-                      (unsigned int)ActualLength,
-                      (unsigned int)ExpectedLength);
-        result = false;
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_Global.EVS_TlmPkt.Payload.CommandCounter++;
+        }
+        else if (Status < 0) /* Negative values indicate errors */
+        {
+            CFE_EVS_Global.EVS_TlmPkt.Payload.CommandErrorCounter++;
+        }
     }
-
-    return result;
 }
@@ -72,10 +72,11 @@ static const EdsDispatchTable_EdsComponent_CFE_EVS_Application_CFE_SB_Telecomman
  *-----------------------------------------------------------------*/
 void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    int32             Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_Size_t    MsgSize;
-    CFE_MSG_FcnCode_t MsgFc;
+    int32                Status;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_MSG_Size_t       MsgSize;
+    CFE_MSG_FcnCode_t    MsgFc;
+    CFE_MSG_HeaderView_t HdrView;
 
     Status = EdsDispatch_EdsComponent_CFE_EVS_Application_Telecommand(SBBufPtr, &CFE_EVS_TC_DISPATCH_TABLE);
 
@@ -83,9 +84,10 @@ void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
     if (Status == CFE_STATUS_BAD_COMMAND_CODE || Status == CFE_STATUS_WRONG_MSG_LENGTH
         || Status == CFE_STATUS_UNKNOWN_MSG_ID)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+        CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+        MsgId   = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+        MsgFc   = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
+        MsgSize = CFE_MSG_HeaderView_GetSize(&HdrView);
 
         if (Status == CFE_STATUS_BAD_COMMAND_CODE)
         {
@@ -165,7 +165,38 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services Performance Data Stream File
+     *
+     * Executive Services Performance Analyzer Data Stream File, one of a series
+     * which is generated while data is collected after a
+     * \link #CFE_ES_START_PERF_DATA_CC \ES_STARTLADATA \endlink
+     * command in streaming mode.
+     *
+     */
+    CFE_FS_SubType_ES_PERFSTREAM = 24,
+
+    /**
+     * @brief Software Bus Message Latency Data Dump File
+     *
+     * Software Bus Message Latency Histogram Data Dump File which is generated in response to a
+     * \link #CFE_SB_WRITE_LATENCY_INFO_CC \SB_WRITELATENCY2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_SB_LATENCYDATA = 25,
+
+    /**
+     * @brief Executive Services Lock Profile Data Dump File
+     *
+     * Executive Services Lock Contention Profile Data Dump File which is generated in response to a
+     * \link #CFE_ES_WRITE_LOCK_PROFILE_CC \ES_WRITELOCKPROF2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_LOCKPROFILE = 26
 };
 
 /**
@@ -36,4 +36,9 @@
 #include "cfe_fs_priv.h"
 #include "cfe_fs_core_internal.h"
 
+/*
+ * Additionally FS uses the lock profiler API for the shared data lock
+ */
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_FS_MODULE_ALL_H */
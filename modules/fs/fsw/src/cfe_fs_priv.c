@@ -72,9 +72,17 @@ void CFE_FS_LockSharedData(const char *FunctionName)
 {
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
+    uint64         WaitStartTicks;
+
+    WaitStartTicks = CFE_ES_LockProfileWaitStart();
 
     OsStatus = OS_MutSemTake(CFE_FS_Global.SharedDataMutexId);
-    if (OsStatus != OS_SUCCESS)
+    if (OsStatus == OS_SUCCESS)
+    {
+        /* No line number is passed to this lock, each function is one place */
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_FS_SHARED_DATA, FunctionName, 0, WaitStartTicks);
+    }
+    else
     {
         CFE_ES_GetAppID(&AppId);
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Function=%s\n",
@@ -96,6 +104,8 @@ void CFE_FS_UnlockSharedData(const char *FunctionName)
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
 
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_FS_SHARED_DATA);
+
     OsStatus = OS_MutSemGive(CFE_FS_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
     {
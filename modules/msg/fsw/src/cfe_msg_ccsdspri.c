@@ -26,20 +26,6 @@
 
 #include <assert.h>
 
-/* CCSDS Primary Standard definitions */
-#define CFE_MSG_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
-#define CFE_MSG_CCSDSVER_MASK  0xE000 /**< \brief CCSDS version mask */
-#define CFE_MSG_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
-#define CFE_MSG_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
-#define CFE_MSG_SHDR_MASK      0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
-#define CFE_MSG_APID_MASK      0x07FF /**< \brief CCSDS ApID mask */
-#define CFE_MSG_SEGFLG_MASK    0xC000 /**< \brief CCSDS segmentation flag mask, all set = complete packet */
-#define CFE_MSG_SEGFLG_CNT     0x0000 /**< \brief CCSDS Segment continuation flag */
-#define CFE_MSG_SEGFLG_FIRST   0x4000 /**< \brief CCSDS Segment first flag */
-#define CFE_MSG_SEGFLG_LAST    0x8000 /**< \brief CCSDS Segment last flag */
-#define CFE_MSG_SEGFLG_UNSEG   0xC000 /**< \brief CCSDS Unsegmented flag */
-#define CFE_MSG_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
-
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -246,22 +232,7 @@ CFE_Status_t CFE_MSG_GetSegmentationFlag(const CFE_MSG_Message_t *MsgPtr, CFE_MS
     }
 
     CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.Sequence, &rawval, CFE_MSG_SEGFLG_MASK);
-
-    switch (rawval)
-    {
-        case CFE_MSG_SEGFLG_CNT:
-            *SegFlag = CFE_MSG_SegFlag_Continue;
-            break;
-        case CFE_MSG_SEGFLG_FIRST:
-            *SegFlag = CFE_MSG_SegFlag_First;
-            break;
-        case CFE_MSG_SEGFLG_LAST:
-            *SegFlag = CFE_MSG_SegFlag_Last;
-            break;
-        case CFE_MSG_SEGFLG_UNSEG:
-        default:
-            *SegFlag = CFE_MSG_SegFlag_Unsegmented;
-    }
+    *SegFlag = CFE_MSG_SegFlagFromField(rawval);
 
     return CFE_SUCCESS;
 }
@@ -0,0 +1,85 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+ * Message header view implementation - decodes the CCSDS primary header and
+ * the cFS default secondary headers in a single pass
+ */
+#include "cfe_msg.h"
+#include "cfe_msg_priv.h"
+#include "cfe_msg_defaults.h"
+#include "cfe_error.h"
+
+#include <string.h>
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderView_t *View)
+{
+    const CFE_MSG_CommandHeader_t   *cmd = (const CFE_MSG_CommandHeader_t *)MsgPtr;
+    const CFE_MSG_TelemetryHeader_t *tlm = (const CFE_MSG_TelemetryHeader_t *)MsgPtr;
+    uint16                           streamid;
+    uint16                           sequence;
+
+    if (MsgPtr == NULL || View == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    memset(View, 0, sizeof(*View));
+
+    /* Each primary header word is read once and then split into its fields */
+    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.StreamId, &streamid, 0xFFFF);
+    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.Sequence, &sequence, 0xFFFF);
+
+    View->HeaderVersion      = (streamid & CFE_MSG_CCSDSVER_MASK) >> CFE_MSG_CCSDSVER_SHIFT;
+    View->Type               = (streamid & CFE_MSG_TYPE_MASK) ? CFE_MSG_Type_Cmd : CFE_MSG_Type_Tlm;
+    View->HasSecondaryHeader = (streamid & CFE_MSG_SHDR_MASK) != 0;
+    View->ApId               = streamid & CFE_MSG_APID_MASK;
+    View->SegmentationFlag   = CFE_MSG_SegFlagFromField(sequence & CFE_MSG_SEGFLG_MASK);
+    View->SequenceCount      = sequence & CFE_MSG_SEQCNT_MASK;
+
+    View->Size = (MsgPtr->CCSDS.Pri.Length[0] << 8) + MsgPtr->CCSDS.Pri.Length[1] + CFE_MSG_SIZE_OFFSET;
+
+    /* Message id bits depend on the selected message id version, ignore return, pointers already checked */
+    CFE_MSG_GetMsgId(MsgPtr, &View->MsgId);
+
+    /* Secondary header fields, present under the same conditions as in the individual accessors */
+    if (View->HeaderVersion == CFE_MISSION_CCSDSVER && View->HasSecondaryHeader)
+    {
+        if (View->Type == CFE_MSG_Type_Cmd)
+        {
+            View->HasFcnCode = true;
+            View->FcnCode    = cmd->Sec.FunctionCode & CFE_MSG_FC_MASK;
+        }
+        else
+        {
+            /* Big endian time fields with default 32/16 layout, see cfe_msg_sechdr_time.c */
+            View->HasMsgTime         = true;
+            View->MsgTime.Subseconds = ((uint32)tlm->Sec.Time[4] << 24) + ((uint32)tlm->Sec.Time[5] << 16);
+            View->MsgTime.Seconds    = ((uint32)tlm->Sec.Time[0] << 24) + ((uint32)tlm->Sec.Time[1] << 16)
+                                    + ((uint32)tlm->Sec.Time[2] << 8) + (uint32)tlm->Sec.Time[3];
+        }
+    }
+
+    return CFE_SUCCESS;
+}
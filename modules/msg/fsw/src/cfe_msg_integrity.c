@@ -29,22 +29,33 @@
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_OriginationAction(CFE_MSG_Message_t *MsgPtr, size_t BufferSize, bool *IsAcceptable)
 {
+    CFE_MSG_HeaderView_t view;
+
     if (MsgPtr == NULL || IsAcceptable == NULL)
     {
         return CFE_MSG_BAD_ARGUMENT;
     }
 
+    /* Ignore return, pointer already checked */
+    CFE_MSG_DecodeHeader(MsgPtr, &view);
+
     /*
      * TLM packets have a timestamp in the secondary header.
-     * This may fail if this is not a TLM packet (that is OK)
+     * Only set it if the decoded header has the field.
      */
-    CFE_MSG_SetMsgTime(MsgPtr, CFE_TIME_GetTime());
+    if (CFE_MSG_HeaderView_HasMsgTime(&view))
+    {
+        CFE_MSG_SetMsgTime(MsgPtr, CFE_TIME_GetTime());
+    }
 
     /*
-     * CMD packets have a checksum in the secondary header.
-     * This may fail if this is not a CMD packet (that is OK)
+     * CMD packets have a checksum in the secondary header, which
+     * has a function code exactly when it has a checksum.
      */
-    CFE_MSG_GenerateChecksum(MsgPtr);
+    if (CFE_MSG_HeaderView_HasFcnCode(&view))
+    {
+        CFE_MSG_GenerateChecksum(MsgPtr);
+    }
 
     /* This implementation permits all outgoing messages */
     *IsAcceptable = true;
@@ -32,6 +32,26 @@
 #include "common_types.h"
 #include "cfe_msg_hdr.h"
 
+/*
+ * Defines
+ */
+/* CCSDS Primary Standard definitions */
+#define CFE_MSG_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
+#define CFE_MSG_CCSDSVER_MASK  0xE000 /**< \brief CCSDS version mask */
+#define CFE_MSG_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
+#define CFE_MSG_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
+#define CFE_MSG_SHDR_MASK      0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
+#define CFE_MSG_APID_MASK      0x07FF /**< \brief CCSDS ApID mask */
+#define CFE_MSG_SEGFLG_MASK    0xC000 /**< \brief CCSDS segmentation flag mask, all set = complete packet */
+#define CFE_MSG_SEGFLG_CNT     0x0000 /**< \brief CCSDS Segment continuation flag */
+#define CFE_MSG_SEGFLG_FIRST   0x4000 /**< \brief CCSDS Segment first flag */
+#define CFE_MSG_SEGFLG_LAST    0x8000 /**< \brief CCSDS Segment last flag */
+#define CFE_MSG_SEGFLG_UNSEG   0xC000 /**< \brief CCSDS Unsegmented flag */
+#define CFE_MSG_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
+
+/* Secondary header definitions */
+#define CFE_MSG_FC_MASK 0x7F /**< \brief Function code mask */
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief get generic header field (uint8 array[2])
@@ -67,6 +87,37 @@ static inline void CFE_MSG_SetHeaderField(uint8 *Word, uint16 Val, uint16 Mask)
     Word[1] = ((Word[1] & ~Mask) | (Val & Mask)) & 0xFF;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Convert segmentation flag header bits to the API value
+ *
+ * \param[in]      RawVal Sequence header field masked with #CFE_MSG_SEGFLG_MASK
+ *
+ * \return Segmentation flag
+ */
+static inline CFE_MSG_SegmentationFlag_t CFE_MSG_SegFlagFromField(uint16 RawVal)
+{
+    CFE_MSG_SegmentationFlag_t SegFlag;
+
+    switch (RawVal)
+    {
+        case CFE_MSG_SEGFLG_CNT:
+            SegFlag = CFE_MSG_SegFlag_Continue;
+            break;
+        case CFE_MSG_SEGFLG_FIRST:
+            SegFlag = CFE_MSG_SegFlag_First;
+            break;
+        case CFE_MSG_SEGFLG_LAST:
+            SegFlag = CFE_MSG_SegFlag_Last;
+            break;
+        case CFE_MSG_SEGFLG_UNSEG:
+        default:
+            SegFlag = CFE_MSG_SegFlag_Unsegmented;
+    }
+
+    return SegFlag;
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Initialize default header - implemented based on selected header format
@@ -23,23 +23,51 @@
 #include "cfe_msg_priv.h"
 #include "cfe_msg_defaults.h"
 
+#include <string.h>
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
  *
  * Computes checksum -
  * MsgPtr is Message pointer to checksum
+ * PktLen is the total message size, from the decoded header
  * Return Value is Calculated checksum
  *
  *-----------------------------------------------------------------*/
-CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr)
+CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t PktLen)
 {
-    CFE_MSG_Size_t     PktLen  = 0;
     const uint8       *BytePtr = (const uint8 *)MsgPtr;
+    uint64             Word;
+    uint64             WordSum = 0;
     CFE_MSG_Checksum_t chksum  = 0xFF;
 
-    /* Message already checked, no error case reachable */
-    CFE_MSG_GetSize(MsgPtr, &PktLen);
+    /*
+     * The checksum is the XOR of all bytes, which does not depend on byte order
+     * or position, so the bulk of the message can be XOR'd a 64 bit word at a time
+     * and the word folded down to a byte at the end.  Leading bytes are done one
+     * at a time until the pointer is word aligned, so the word reads are aligned
+     * on all targets.  Each word is read with memcpy, which the compiler turns
+     * into a single load, as the message is not an array of uint64.
+     */
+    while (PktLen > 0 && ((cpuaddr)BytePtr & (sizeof(Word) - 1)) != 0)
+    {
+        chksum ^= *(BytePtr++);
+        PktLen--;
+    }
+
+    while (PktLen >= sizeof(Word))
+    {
+        memcpy(&Word, BytePtr, sizeof(Word));
+        WordSum ^= Word;
+        BytePtr += sizeof(Word);
+        PktLen -= sizeof(Word);
+    }
+
+    WordSum ^= WordSum >> 32;
+    WordSum ^= WordSum >> 16;
+    WordSum ^= WordSum >> 8;
+    chksum ^= (uint8)WordSum;
 
     while (PktLen--)
     {
@@ -57,10 +85,8 @@ CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GenerateChecksum(CFE_MSG_Message_t *MsgPtr)
 {
-    CFE_MSG_Type_t           type;
-    CFE_MSG_HeaderVersion_t  version;
-    bool                     hassechdr = false;
-    CFE_MSG_CommandHeader_t *cmd       = (CFE_MSG_CommandHeader_t *)MsgPtr;
+    CFE_MSG_HeaderView_t     view;
+    CFE_MSG_CommandHeader_t *cmd = (CFE_MSG_CommandHeader_t *)MsgPtr;
 
     if (MsgPtr == NULL)
     {
@@ -68,13 +94,12 @@ CFE_Status_t CFE_MSG_GenerateChecksum(CFE_MSG_Message_t *MsgPtr)
     }
 
     /* Ignore return, pointer already checked */
-    CFE_MSG_GetHasSecondaryHeader(MsgPtr, &hassechdr);
-    CFE_MSG_GetHeaderVersion(MsgPtr, &version);
-    CFE_MSG_GetType(MsgPtr, &type);
+    CFE_MSG_DecodeHeader(MsgPtr, &view);
     /* According to CCSDS standards, must use Version 1 CCSDS header which
      * is represented by bit pattern '000' so Version should be just 0
      * see https://public.ccsds.org/Pubs/133x0b2e2.pdf section 4.1.3.2*/
-    if (version != CFE_MISSION_CCSDSVER || type != CFE_MSG_Type_Cmd || !hassechdr)
+    if (CFE_MSG_HeaderView_GetHeaderVersion(&view) != CFE_MISSION_CCSDSVER ||
+        CFE_MSG_HeaderView_GetType(&view) != CFE_MSG_Type_Cmd || !CFE_MSG_HeaderView_GetHasSecondaryHeader(&view))
     {
         return CFE_MSG_WRONG_MSG_TYPE;
     }
@@ -84,7 +109,7 @@ CFE_Status_t CFE_MSG_GenerateChecksum(CFE_MSG_Message_t *MsgPtr)
 
     /* Compute using aligned MsgPtr and set, suppress false style warning */
     /* cppcheck-suppress redundantAssignment */
-    cmd->Sec.Checksum = CFE_MSG_ComputeCheckSum(MsgPtr);
+    cmd->Sec.Checksum = CFE_MSG_ComputeCheckSum(MsgPtr, CFE_MSG_HeaderView_GetSize(&view));
 
     return CFE_SUCCESS;
 }
@@ -97,9 +122,7 @@ CFE_Status_t CFE_MSG_GenerateChecksum(CFE_MSG_Message_t *MsgPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_ValidateChecksum(const CFE_MSG_Message_t *MsgPtr, bool *IsValid)
 {
-    CFE_MSG_Type_t          type;
-    CFE_MSG_HeaderVersion_t version;
-    bool                    hassechdr = false;
+    CFE_MSG_HeaderView_t view;
 
     if (MsgPtr == NULL || IsValid == NULL)
     {
@@ -107,19 +130,18 @@ CFE_Status_t CFE_MSG_ValidateChecksum(const CFE_MSG_Message_t *MsgPtr, bool *IsV
     }
 
     /* Ignore return, pointer already checked */
-    CFE_MSG_GetHasSecondaryHeader(MsgPtr, &hassechdr);
-    CFE_MSG_GetHeaderVersion(MsgPtr, &version);
-    CFE_MSG_GetType(MsgPtr, &type);
+    CFE_MSG_DecodeHeader(MsgPtr, &view);
     /* According to CCSDS standards, must use Version 1 CCSDS header which
      * is represented by bit pattern '000' so Version should be just 0
      * see https://public.ccsds.org/Pubs/133x0b2e2.pdf section 4.1.3.2*/
-    if (version != CFE_MISSION_CCSDSVER || type != CFE_MSG_Type_Cmd || !hassechdr)
+    if (CFE_MSG_HeaderView_GetHeaderVersion(&view) != CFE_MISSION_CCSDSVER ||
+        CFE_MSG_HeaderView_GetType(&view) != CFE_MSG_Type_Cmd || !CFE_MSG_HeaderView_GetHasSecondaryHeader(&view))
     {
         return CFE_MSG_WRONG_MSG_TYPE;
     }
 
     /* Compute, valid if == 0 */
-    *IsValid = (CFE_MSG_ComputeCheckSum(MsgPtr) == 0);
+    *IsValid = (CFE_MSG_ComputeCheckSum(MsgPtr, CFE_MSG_HeaderView_GetSize(&view)) == 0);
 
     return CFE_SUCCESS;
 }
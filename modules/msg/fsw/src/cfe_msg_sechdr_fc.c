@@ -23,8 +23,6 @@
 #include "cfe_msg_priv.h"
 #include "cfe_msg_defaults.h"
 
-#define CFE_MSG_FC_MASK 0x7F /**< \brief Function code mask */
-
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -34,6 +34,7 @@
 #include "test_cfe_msg_fc.h"
 #include "test_cfe_msg_checksum.h"
 #include "test_cfe_msg_time.h"
+#include "test_cfe_msg_headerview.h"
 
 /*
  * Functions
@@ -51,6 +52,8 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_MSG_VerificationAction);
     UT_ADD_TEST(Test_MSG_MsgId);
     UT_ADD_TEST(Test_MSG_Checksum);
+    UT_ADD_TEST(Test_MSG_Checksum_Random);
     UT_ADD_TEST(Test_MSG_FcnCode);
     UT_ADD_TEST(Test_MSG_Time);
+    UT_ADD_TEST(Test_MSG_HeaderView);
 }
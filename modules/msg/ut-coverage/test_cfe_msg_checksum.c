@@ -32,6 +32,7 @@
 #include "cfe_error.h"
 #include "cfe_msg_defaults.h"
 #include <string.h>
+#include <stdlib.h>
 
 void Test_MSG_Checksum(void)
 {
@@ -103,3 +104,56 @@ void Test_MSG_Checksum(void)
     /* Still complete packet even though version is incorrect + version in header */
     UtAssert_INT32_EQ(Test_MSG_NotZero(msgptr), MSG_LENGTH_FLAG | MSG_HASSEC_FLAG | MSG_TYPE_FLAG | MSG_HDRVER_FLAG);
 }
+
+void Test_MSG_Checksum_Random(void)
+{
+    /* Room for the largest message plus a full word of misalignment */
+    static uint8 buf[512 + sizeof(uint64)];
+
+    CFE_MSG_Message_t       *msgptr;
+    CFE_MSG_CommandHeader_t *cmdptr;
+    size_t                   offset;
+    size_t                   size;
+    size_t                   i;
+    uint32                   loop;
+    uint8                    expected;
+    uint32                   failures = 0;
+    bool                     actual;
+
+    UtPrintf("Random lengths and alignments, compare to byte at a time reference");
+    for (loop = 0; loop < 1000; loop++)
+    {
+        offset = rand() % sizeof(uint64);
+        size   = sizeof(CFE_MSG_CommandHeader_t) + (rand() % (512 - sizeof(CFE_MSG_CommandHeader_t) + 1));
+        msgptr = (CFE_MSG_Message_t *)&buf[offset];
+        cmdptr = (CFE_MSG_CommandHeader_t *)msgptr;
+
+        for (i = 0; i < size; i++)
+        {
+            buf[offset + i] = rand() & 0xFF;
+        }
+
+        CFE_MSG_SetSize(msgptr, size);
+        CFE_MSG_SetType(msgptr, CFE_MSG_Type_Cmd);
+        CFE_MSG_SetHeaderVersion(msgptr, CFE_MISSION_CCSDSVER);
+        CFE_MSG_SetHasSecondaryHeader(msgptr, true);
+        cmdptr->Sec.Checksum = 0;
+
+        expected = 0xFF;
+        for (i = 0; i < size; i++)
+        {
+            expected ^= buf[offset + i];
+        }
+
+        actual = false;
+        if (CFE_MSG_GenerateChecksum(msgptr) != CFE_SUCCESS || cmdptr->Sec.Checksum != expected ||
+            CFE_MSG_ValidateChecksum(msgptr, &actual) != CFE_SUCCESS || !actual)
+        {
+            UtPrintf("Mismatch, offset %u size %u expected 0x%02x actual 0x%02x", (unsigned int)offset,
+                     (unsigned int)size, (unsigned int)expected, (unsigned int)cmdptr->Sec.Checksum);
+            failures++;
+        }
+    }
+
+    UtAssert_UINT32_EQ(failures, 0);
+}
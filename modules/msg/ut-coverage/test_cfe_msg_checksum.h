@@ -30,4 +30,7 @@
 /* Test checksum accessor functions */
 void Test_MSG_Checksum(void);
 
+/* Test checksum against a byte at a time reference over random lengths and alignments */
+void Test_MSG_Checksum_Random(void);
+
 #endif /* TEST_CFE_MSG_CHECKSUM_H */
@@ -0,0 +1,133 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Test header view decode
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "test_msg_not.h"
+#include "test_msg_utils.h"
+#include "cfe_msg.h"
+#include "test_cfe_msg_headerview.h"
+#include "cfe_error.h"
+#include "cfe_msg_defaults.h"
+#include <string.h>
+
+/*
+ * Verify the decoded view matches the individual accessors
+ */
+static void Test_MSG_HeaderView_Check(const CFE_MSG_Message_t *msgptr, const CFE_MSG_HeaderView_t *view)
+{
+    CFE_SB_MsgId_t             msgid;
+    CFE_MSG_Size_t             size;
+    CFE_MSG_Type_t             type;
+    CFE_MSG_HeaderVersion_t    hdrver;
+    bool                       hassec;
+    CFE_MSG_ApId_t             apid;
+    CFE_MSG_SegmentationFlag_t segflag;
+    CFE_MSG_SequenceCount_t    seqcnt;
+    CFE_MSG_FcnCode_t          fc;
+    CFE_TIME_SysTime_t         msgtime;
+
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetMsgId(msgptr, &msgid));
+    CFE_UtAssert_MSGID_EQ(CFE_MSG_HeaderView_GetMsgId(view), msgid);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSize(msgptr, &size));
+    UtAssert_UINT32_EQ(CFE_MSG_HeaderView_GetSize(view), size);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetType(msgptr, &type));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetType(view), type);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetHeaderVersion(msgptr, &hdrver));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetHeaderVersion(view), hdrver);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetHasSecondaryHeader(msgptr, &hassec));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetHasSecondaryHeader(view), hassec);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetApId(msgptr, &apid));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetApId(view), apid);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSegmentationFlag(msgptr, &segflag));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetSegmentationFlag(view), segflag);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSequenceCount(msgptr, &seqcnt));
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetSequenceCount(view), seqcnt);
+
+    /* Present exactly when the individual accessor succeeds, zero otherwise */
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_HasFcnCode(view), CFE_MSG_GetFcnCode(msgptr, &fc) == CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetFcnCode(view), fc);
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_HasMsgTime(view), CFE_MSG_GetMsgTime(msgptr, &msgtime) == CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CFE_MSG_HeaderView_GetMsgTime(view).Seconds, msgtime.Seconds);
+    UtAssert_UINT32_EQ(CFE_MSG_HeaderView_GetMsgTime(view).Subseconds, msgtime.Subseconds);
+}
+
+void Test_MSG_HeaderView(void)
+{
+    union
+    {
+        CFE_MSG_Message_t         msg;
+        CFE_MSG_CommandHeader_t   cmd;
+        CFE_MSG_TelemetryHeader_t tlm;
+    } LocalBuf;
+    CFE_MSG_Message_t   *msgptr = &LocalBuf.msg;
+    CFE_MSG_HeaderView_t view;
+    CFE_TIME_SysTime_t   msgtime;
+
+    UtPrintf("Bad parameter tests, Null pointers");
+    memset(&LocalBuf, 0, sizeof(LocalBuf));
+    UtAssert_INT32_EQ(CFE_MSG_DecodeHeader(NULL, &view), CFE_MSG_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_MSG_DecodeHeader(msgptr, NULL), CFE_MSG_BAD_ARGUMENT);
+
+    UtPrintf("Set to all 0");
+    memset(&view, 0xFF, sizeof(view));
+    CFE_UtAssert_SUCCESS(CFE_MSG_DecodeHeader(msgptr, &view));
+    Test_MSG_HeaderView_Check(msgptr, &view);
+    UtAssert_BOOL_FALSE(CFE_MSG_HeaderView_HasFcnCode(&view));
+    UtAssert_BOOL_FALSE(CFE_MSG_HeaderView_HasMsgTime(&view));
+
+    UtPrintf("Set to all F's, command with secondary header");
+    memset(&LocalBuf, 0xFF, sizeof(LocalBuf));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetHeaderVersion(msgptr, CFE_MISSION_CCSDSVER));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetSize(msgptr, sizeof(LocalBuf.cmd)));
+    CFE_UtAssert_SUCCESS(CFE_MSG_DecodeHeader(msgptr, &view));
+    Test_MSG_HeaderView_Check(msgptr, &view);
+    UtAssert_BOOL_TRUE(CFE_MSG_HeaderView_HasFcnCode(&view));
+    UtAssert_BOOL_FALSE(CFE_MSG_HeaderView_HasMsgTime(&view));
+
+    UtPrintf("Set to all F's, command with wrong header version");
+    memset(&LocalBuf, 0xFF, sizeof(LocalBuf));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetHeaderVersion(msgptr, CFE_MISSION_CCSDSVER + 1));
+    CFE_UtAssert_SUCCESS(CFE_MSG_DecodeHeader(msgptr, &view));
+    Test_MSG_HeaderView_Check(msgptr, &view);
+    UtAssert_BOOL_FALSE(CFE_MSG_HeaderView_HasFcnCode(&view));
+
+    UtPrintf("Telemetry with secondary header and time");
+    memset(&LocalBuf, 0, sizeof(LocalBuf));
+    msgtime.Seconds    = 0x12345678;
+    msgtime.Subseconds = 0x9ABC0000;
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetHasSecondaryHeader(msgptr, true));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetSegmentationFlag(msgptr, CFE_MSG_SegFlag_First));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetSequenceCount(msgptr, 0x1234));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetMsgTime(msgptr, msgtime));
+    CFE_UtAssert_SUCCESS(CFE_MSG_DecodeHeader(msgptr, &view));
+    Test_MSG_HeaderView_Check(msgptr, &view);
+    UtAssert_BOOL_FALSE(CFE_MSG_HeaderView_HasFcnCode(&view));
+    UtAssert_BOOL_TRUE(CFE_MSG_HeaderView_HasMsgTime(&view));
+    UtAssert_UINT32_EQ(CFE_MSG_HeaderView_GetMsgTime(&view).Seconds, msgtime.Seconds);
+    UtAssert_UINT32_EQ(CFE_MSG_HeaderView_GetMsgTime(&view).Subseconds, msgtime.Subseconds);
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetSegmentationFlag(&view), CFE_MSG_SegFlag_First);
+    UtAssert_INT32_EQ(CFE_MSG_HeaderView_GetSequenceCount(&view), 0x1234);
+}
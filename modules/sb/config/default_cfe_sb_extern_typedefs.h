@@ -113,12 +113,13 @@ typedef CFE_RESOURCEID_BASE_TYPE CFE_SB_PipeId_t;
 
 /** \brief Quality Of Service Type Definition
 **
-** Currently an unused parameter in #CFE_SB_SubscribeEx
-** Intended to be used for interprocessor communication only
+** Passed to #CFE_SB_SubscribeEx.  The priority selects the lane of the pipe the
+** subscribed messages are written to, the reliability is intended to be used for
+** interprocessor communication only.
 **/
 typedef struct
 {
-    uint8 Priority; /**< \brief  Specify high(1) or low(0) message priority for off-board routing, currently unused */
+    uint8 Priority; /**< \brief  Specify high(1) or low(0) message priority, selects the lane within the pipe */
     uint8 Reliability; /**< \brief  Specify high(1) or low(0) message transfer reliability for off-board routing,
                           currently unused */
 } CFE_SB_Qos_t;
@@ -47,6 +47,7 @@ enum CFE_SB_FunctionCode_
     CFE_SB_FunctionCode_ENABLE_SUB_REPORTING  = 9,
     CFE_SB_FunctionCode_DISABLE_SUB_REPORTING = 10,
     CFE_SB_FunctionCode_SEND_PREV_SUBS        = 11,
+    CFE_SB_FunctionCode_WRITE_LATENCY_INFO    = 12,
 };
 
 #endif
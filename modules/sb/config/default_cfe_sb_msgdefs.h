@@ -125,6 +125,24 @@ typedef struct CFE_SB_PipeDepthStats
                                             \brief Spare word to ensure alignment */
 } CFE_SB_PipeDepthStats_t;
 
+/**
+** \brief Number of priority lanes in a pipe, one for each #CFE_SB_QosPriority value
+*/
+#define CFE_SB_PIPE_LANE_COUNT (CFE_SB_QosPriority_HIGH + 1)
+
+/**
+** \brief SB Pipe Lane Statistics
+**
+** Depth and overflow statistics of one priority lane of a pipe, see #CFE_SB_PipeInfoEntry_t
+*/
+typedef struct CFE_SB_PipeLaneStats
+{
+    uint16 CurrentQueueDepth; /**< Number of messages currently in the lane */
+    uint16 PeakQueueDepth;    /**< Peak number of messages that have been in the lane */
+    uint16 OverflowErrors;    /**< Number of messages dropped because the lane was full */
+    uint16 Spare;             /**< Spare word to ensure alignment */
+} CFE_SB_PipeLaneStats_t;
+
 /**
 ** \brief SB Pipe Information File Entry
 **
@@ -142,16 +160,17 @@ typedef struct CFE_SB_PipeDepthStats
 */
 typedef struct CFE_SB_PipeInfoEntry
 {
-    CFE_SB_PipeId_t PipeId;                            /**< The runtime ID of the pipe */
-    CFE_ES_AppId_t  AppId;                             /**< The runtime ID of the application that owns the pipe */
-    char            PipeName[CFE_MISSION_MAX_API_LEN]; /**< The Name of the pipe */
-    char            AppName[CFE_MISSION_MAX_API_LEN];  /**< The Name of the application that owns the pipe */
-    uint16          MaxQueueDepth;                     /**< The allocated depth of the pipe (max capacity) */
-    uint16          CurrentQueueDepth;                 /**< The current depth of the pipe */
-    uint16          PeakQueueDepth;                    /**< The peak depth of the pipe (high watermark) */
-    uint16          SendErrors;                        /**< Number of errors when writing to this pipe */
-    uint8           Opts;                              /**< Pipe options set (bitmask) */
-    uint8           Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
+    CFE_SB_PipeId_t        PipeId;                            /**< The runtime ID of the pipe */
+    CFE_ES_AppId_t         AppId;                             /**< The runtime ID of the application that owns the pipe */
+    char                   PipeName[CFE_MISSION_MAX_API_LEN]; /**< The Name of the pipe */
+    char                   AppName[CFE_MISSION_MAX_API_LEN];  /**< The Name of the application that owns the pipe */
+    uint16                 MaxQueueDepth;                     /**< The allocated depth of the pipe (max capacity) */
+    uint16                 CurrentQueueDepth;                 /**< The current depth of the pipe */
+    uint16                 PeakQueueDepth;                    /**< The peak depth of the pipe (high watermark) */
+    uint16                 SendErrors;                        /**< Number of errors when writing to this pipe */
+    uint8                  Opts;                              /**< Pipe options set (bitmask) */
+    uint8                  Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
+    CFE_SB_PipeLaneStats_t Lane[CFE_SB_PIPE_LANE_COUNT];      /**< Statistics of each lane, indexed by priority */
 } CFE_SB_PipeInfoEntry_t;
 
 /**
@@ -200,6 +219,15 @@ typedef struct CFE_SB_StatsTlm_Payload
     CFE_SB_PipeDepthStats_t
         PipeDepthStats[CFE_MISSION_SB_MAX_PIPES]; /**< \cfetlmmnemonic \SB_SMPDS
                                                \brief Pipe Depth Statistics #CFE_SB_PipeDepthStats_t*/
+
+    uint32 BufCacheHits;   /**< \cfetlmmnemonic \SB_SMBCHIT
+                                \brief Number of SB message buffers allocated from the buffer cache */
+    uint32 BufCacheMisses; /**< \cfetlmmnemonic \SB_SMBCMISS
+                                \brief Number of SB message buffers allocated from the memory pool */
+
+    uint32 RouteProbeHistogram[CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS]; /**< \cfetlmmnemonic \SB_SMRPHIST
+                                     \brief Number of routes found after 0, 1, 2 ... extra probes of the
+                                     message map, the last entry counts all longer probe sequences */
 } CFE_SB_StatsTlm_Payload_t;
 
 /**
@@ -228,6 +256,62 @@ typedef struct CFE_SB_MsgMapFileEntry
     CFE_SB_RouteId_Atom_t Index; /**< \brief Routing raw index value (0 based, not Route ID) */
 } CFE_SB_MsgMapFileEntry_t;
 
+/**
+** \brief SB Message Latency Histogram
+**
+** Counts messages by the time they spent in a pipe, from transmit to receive.
+** Entry 0 of Bin counts times below 1 microsecond, entry N counts times from
+** 2^(N-1) up to 2^N microseconds, and the last entry counts all longer times.
+*/
+typedef struct CFE_SB_LatencyHistogram
+{
+    uint32 MsgCount;                              /**< \brief Number of messages counted */
+    uint32 MaxLatency;                            /**< \brief Longest time in a pipe, in microseconds */
+    uint32 Bin[CFE_MISSION_SB_LATENCY_HIST_BINS]; /**< \brief Number of messages in each time range */
+} CFE_SB_LatencyHistogram_t;
+
+/**
+** \brief SB Latency File Entry
+**
+** Structure of one element of the latency information in response to #CFE_SB_WRITE_LATENCY_INFO_CC
+**
+** The file holds one entry for each pipe, with MsgId set to #CFE_SB_INVALID_MSG_ID,
+** followed by one entry for each route, with PipeId set to #CFE_SB_INVALID_PIPE.
+*/
+typedef struct CFE_SB_LatencyFileEntry
+{
+    CFE_SB_MsgId_t            MsgId;   /**< \brief Message Id of a route entry */
+    CFE_SB_PipeId_t           PipeId;  /**< \brief Pipe Id of a pipe entry */
+    CFE_SB_LatencyHistogram_t Latency; /**< \brief Latency of all messages received from the pipe or route */
+} CFE_SB_LatencyFileEntry_t;
+
+/**
+** \brief SB Pipe Latency Summary
+**
+** Used in SB Latency Telemetry Packet #CFE_SB_LatencyTlm_t
+*/
+typedef struct CFE_SB_PipeLatencyStats
+{
+    CFE_SB_PipeId_t PipeId;     /**< \brief Pipe Id associated with the stats below */
+    uint32          MsgCount;   /**< \brief Number of messages received from the pipe */
+    uint32          MaxLatency; /**< \brief Longest time a message spent in the pipe, in microseconds */
+} CFE_SB_PipeLatencyStats_t;
+
+/**
+** \cfesbtlm SB Latency Telemetry Packet
+**
+** SB message latency summary sent along with #CFE_SB_StatsTlm_t in response to
+** #CFE_SB_SEND_SB_STATS_CC, only if latency statistics are enabled.  The full
+** histograms of each pipe and route can be written to a file with
+** #CFE_SB_WRITE_LATENCY_INFO_CC.
+*/
+typedef struct CFE_SB_LatencyTlm_Payload
+{
+    CFE_SB_LatencyHistogram_t Total; /**< \brief Combined histogram of all pipes in use */
+    CFE_SB_PipeLatencyStats_t
+        PipeLatencyStats[CFE_MISSION_SB_MAX_PIPES]; /**< \brief Latency summary of each pipe in use */
+} CFE_SB_LatencyTlm_Payload_t;
+
 /**
 ** \cfesbtlm SB Subscription Report Packet
 **
@@ -39,5 +39,6 @@
 #define CFE_SB_STATS_TLM_MID   CFE_PLATFORM_SB_TLM_MIDVAL(STATS_TLM)   /* Default=0x080A */
 #define CFE_SB_ALLSUBS_TLM_MID CFE_PLATFORM_SB_TLM_MIDVAL(ALLSUBS_TLM) /* Default=0x080D */
 #define CFE_SB_ONESUB_TLM_MID  CFE_PLATFORM_SB_TLM_MIDVAL(ONESUB_TLM)  /* Default=0x080E */
+#define CFE_SB_LATENCY_TLM_MID CFE_PLATFORM_SB_TLM_MIDVAL(LATENCY_TLM) /* Default=0x080F */
 
 #endif
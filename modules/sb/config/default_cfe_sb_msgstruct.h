@@ -98,6 +98,12 @@ typedef struct CFE_SB_WriteMapInfoCmd
     CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_SB_WriteMapInfoCmd_t;
 
+typedef struct CFE_SB_WriteLatencyInfoCmd
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_WriteLatencyInfoCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -129,6 +135,12 @@ typedef struct CFE_SB_StatsTlm
     CFE_SB_StatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_SB_StatsTlm_t;
 
+typedef struct CFE_SB_LatencyTlm
+{
+    CFE_MSG_TelemetryHeader_t   TelemetryHeader; /**< \brief Telemetry header */
+    CFE_SB_LatencyTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_SB_LatencyTlm_t;
+
 typedef struct CFE_SB_SingleSubscriptionTlm
 {
     CFE_MSG_TelemetryHeader_t              TelemetryHeader; /**< \brief Telemetry header */
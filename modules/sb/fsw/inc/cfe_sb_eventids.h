@@ -784,6 +784,18 @@
  */
 #define CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID 72
 
+/**
+ * \brief SB Mask Subscribe API Mask Subscriptions Exhausted Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_SubscribeMask API failure due to all #CFE_PLATFORM_SB_MAX_MASK_SUBS
+ *  mask subscriptions being in use.
+ */
+#define CFE_SB_MAX_MASK_SUBS_MET_EID 73
+
 /**\}*/
 
 #endif /* CFE_SB_EVENTS_H */
@@ -120,7 +120,8 @@
 **       This command will cause the SB task to send a statistics packet
 **       containing current utilization figures and high water marks which
 **       may be useful for checking the margin of the SB platform configuration
-**       settings.
+**       settings.  If latency statistics are enabled, a summary of the message
+**       latency of each pipe is sent along with it.
 **
 **  \cfecmdmnemonic \SB_DUMPSTATS
 **
@@ -132,6 +133,8 @@
 **       following telemetry:
 **       - \b \c \SB_CMDPC - command execution counter will increment
 **       - Receipt of statistics packet with MsgId #CFE_SB_STATS_TLM_MID
+**       - Receipt of latency summary packet with MsgId #CFE_SB_LATENCY_TLM_MID,
+**         if latency statistics are enabled
 **       - The #CFE_SB_SND_STATS_EID debug event message will be generated
 **
 **  \par Error Conditions
@@ -461,4 +464,53 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC CFE_SB_CCVAL(SEND_PREV_SUBS)
 
+/** \cfesbcmd Write Message Latency Info to a File
+**
+**  \par Description
+**       This command will create a file containing the message latency
+**       histograms of each pipe and of each route, which count the time that
+**       messages spent in a pipe between transmit and receive.  The histograms
+**       are only updated if latency statistics are enabled by the
+**       #CFE_PLATFORM_SB_LATENCY_STATS_ENABLE configuration parameter.
+**       An absolute path and filename may be specified in the command.
+**       If this command field contains an empty string (NULL terminator as
+**       the first character) the default file path and name is used.
+**       The default file path and name is defined in the platform
+**       configuration file as #CFE_PLATFORM_SB_DEFAULT_LATENCY_FILENAME.
+**
+**  \cfecmdmnemonic \SB_WRITELATENCY2FILE
+**
+**  \par Command Structure
+**       #CFE_SB_WriteLatencyInfoCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment.
+**         NOTE: the command counter is incremented when the request is accepted,
+**         before writing the file, which is performed as a background task.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_SB_DEFAULT_LATENCY_FILENAME configuration parameter) will be
+**         updated with the latest information.
+**       - The #CFE_SB_SND_RTG_EID debug event message will be generated
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write a software bus information file has not yet completed
+**       - The specified FileName cannot be parsed
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system and could, if performed repeatedly without
+**       sufficient file management by the operator, fill the file system.
+**
+**  \sa #CFE_SB_LatencyFileEntry_t, #CFE_SB_SEND_SB_STATS_CC
+*/
+#define CFE_SB_WRITE_LATENCY_INFO_CC CFE_SB_CCVAL(WRITE_LATENCY_INFO)
+
 #endif
@@ -82,4 +82,42 @@
 #define CFE_MISSION_SB_SUB_ENTRIES_PER_PKT         CFE_MISSION_SB_CFGVAL(SUB_ENTRIES_PER_PKT)
 #define DEFAULT_CFE_MISSION_SB_SUB_ENTRIES_PER_PKT 20
 
+/**
+**  \cfesbcfg Number of entries in the route probe length histogram
+**
+**  \par Description:
+**       The SB statistics telemetry reports how many message map probes are
+**       needed to find each route, as a histogram of this many entries.  The
+**       last entry counts all routes needing this many probes or more.
+**
+**       This affects the layout of command/telemetry messages but does not affect run
+**       time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be at least 1.
+*/
+#define CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS         CFE_MISSION_SB_CFGVAL(ROUTE_PROBE_HIST_BINS)
+#define DEFAULT_CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS 8
+
+/**
+**  \cfesbcfg Number of entries in the message latency histograms
+**
+**  \par Description:
+**       When latency statistics are enabled, SB counts the time each message
+**       spent in a pipe, from transmit to receive, in histograms of this many
+**       entries.  Entry 0 counts times below 1 microsecond, entry N counts times
+**       from 2^(N-1) up to 2^N microseconds, and the last entry counts all
+**       longer times.
+**
+**       This affects the layout of command/telemetry messages but does not affect run
+**       time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be at least 1.
+*/
+#define CFE_MISSION_SB_LATENCY_HIST_BINS         CFE_MISSION_SB_CFGVAL(LATENCY_HIST_BINS)
+#define DEFAULT_CFE_MISSION_SB_LATENCY_HIST_BINS 20
+
 #endif
@@ -90,6 +90,44 @@
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT         CFE_PLATFORM_SB_CFGVAL(MAX_DEST_PER_PKT)
 #define DEFAULT_CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Maximum Number of Mask Subscriptions
+**
+**  \par Description:
+**       Dictates the maximum number of mask subscriptions (see #CFE_SB_SubscribeMask)
+**       that can be in use at one time, for all pipes.  Each mask subscription is
+**       turned into a regular destination the first time a matching message ID is
+**       sent, so these destinations also count against #CFE_PLATFORM_SB_MAX_MSG_IDS
+**       and #CFE_PLATFORM_SB_MAX_DEST_PER_PKT.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.  Every
+**       message ID without a route is checked against all mask subscriptions in use
+**       when it is sent, so this should be kept small.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_MASK_SUBS         CFE_PLATFORM_SB_CFGVAL(MAX_MASK_SUBS)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_MASK_SUBS 32
+
+/**
+**  \cfesbcfg Maximum Number of Message IDs a Mask Subscription May Match
+**
+**  \par Description:
+**       Dictates the largest number of message IDs, up to
+**       #CFE_PLATFORM_SB_HIGHEST_VALID_MSGID, that a single mask subscription may
+**       match.  Each matching message ID that is sent takes a routing table entry
+**       that stays in use until the mask subscription is removed, so a wider mask
+**       is rejected by #CFE_SB_SubscribeMask rather than allowed to use up the
+**       routing table.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and should be well below
+**       #CFE_PLATFORM_SB_MAX_MSG_IDS, which it can not be greater than.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS         CFE_PLATFORM_SB_CFGVAL(MAX_MASK_MATCH_IDS)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS 64
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -106,6 +144,63 @@
 #define CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT         CFE_PLATFORM_SB_CFGVAL(DEFAULT_MSG_LIMIT)
 #define DEFAULT_CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT 4
 
+/**
+**  \cfesbcfg Maximum Number of Buffers per Batch Transmit
+**
+**  \par Description:
+**       Dictates the number of buffers that are routed under a single acquisition of
+**       the SB lock by #CFE_SB_TransmitBufferBatch.  Larger requests are processed in
+**       chunks of this size.  The transaction states for a chunk are allocated from
+**       the SB memory pool for the duration of the call, which takes
+**       sizeof(CFE_SB_TransmitTxn_State_t) bytes per unit of this value.  Most of this
+**       is the transaction's per-destination set, which holds
+**       CFE_PLATFORM_SB_MAX_DEST_PER_PKT entries of sizeof(CFE_SB_PipeSetEntry_t).
+**       If the pool cannot supply the block, the buffers are sent one at a time.
+**       The stack of the calling task only grows by sizeof(CFE_SB_BufferD_t *)
+**       bytes per unit of this value.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  There is no hard upper limit but
+**       the block must fit within the largest SB memory pool block size for
+**       batching to take effect.
+**
+*/
+#define CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE         CFE_PLATFORM_SB_CFGVAL(TRANSMIT_BATCH_SIZE)
+#define DEFAULT_CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE 8
+
+/**
+**  \cfesbcfg Maximum Number of Buffers per Batch Receive
+**
+**  \par Description:
+**       Dictates the maximum number of buffers that can be returned by a single call
+**       to #CFE_SB_ReceiveBufferMulti.  Every pipe descriptor reserves space to retain
+**       this many buffer references between calls, so the SB global data grows by
+**       (CFE_PLATFORM_SB_MAX_PIPES * this value) pointers.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE         CFE_PLATFORM_SB_CFGVAL(RECEIVE_BATCH_SIZE)
+#define DEFAULT_CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE 16
+
+/**
+**  \cfesbcfg Maximum Number of Pipes per Receive From Any Pipe
+**
+**  \par Description:
+**       Dictates the maximum number of pipes that can be passed to a single call
+**       to #CFE_SB_ReceiveBufferAny.  The transaction state of the call is held on
+**       the stack of the calling task, with two entries of sizeof(CFE_SB_PipeSetEntry_t)
+**       (one for each lane of a pipe) per unit of this value.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and can not be greater than
+**       #CFE_PLATFORM_SB_MAX_PIPES.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES         CFE_PLATFORM_SB_CFGVAL(MAX_RECEIVE_ANY_PIPES)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES 8
+
 /**
 **  \cfesbcfg Size of the SB buffer memory pool
 **
@@ -203,6 +298,39 @@
 #define CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME         CFE_PLATFORM_SB_CFGVAL(DEFAULT_MAP_FILENAME)
 #define DEFAULT_CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME "/ram/cfe_sb_msgmap.dat"
 
+/**
+**  \cfesbcfg Default Message Latency Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the software
+**       bus message latency histograms. This filename is used only when no filename
+**       is specified in the command.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_SB_DEFAULT_LATENCY_FILENAME         CFE_PLATFORM_SB_CFGVAL(DEFAULT_LATENCY_FILENAME)
+#define DEFAULT_CFE_PLATFORM_SB_DEFAULT_LATENCY_FILENAME "/ram/cfe_sb_latency.dat"
+
+/**
+**  \cfesbcfg Enable Message Latency Statistics
+**
+**  \par Description:
+**       If true, every message is stamped with the PSP timebase when it is sent,
+**       and the time it spent in the pipe is added to the latency histograms of
+**       the pipe and of the route when it is received.  This costs a timebase
+**       read on every send and receive.  If false, the histograms stay empty.
+**
+**       Latency statistics are also disabled if the PSP does not report a
+**       timebase rate.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_SB_LATENCY_STATS_ENABLE         CFE_PLATFORM_SB_CFGVAL(LATENCY_STATS_ENABLE)
+#define DEFAULT_CFE_PLATFORM_SB_LATENCY_STATS_ENABLE false
+
 /**
 **  \cfesbcfg SB Event Filtering
 **
@@ -282,6 +410,26 @@
 #define CFE_PLATFORM_SB_POOL_MAX_BUCKETS         CFE_PLATFORM_SB_CFGVAL(POOL_MAX_BUCKETS)
 #define DEFAULT_CFE_PLATFORM_SB_POOL_MAX_BUCKETS 17
 
+/**
+**  \cfesbcfg Depth of the SB buffer cache per block size
+**
+**  \par Description:
+**       Buffers released by the software bus are kept in a cache, one per
+**       block size of the SB memory pool, rather than being returned to the
+**       pool immediately.  Subsequent allocations of the same block size are
+**       satisfied from the cache without calling into the ES memory pool.
+**       This value sets the maximum number of buffers retained for each block
+**       size.  Buffers held in the cache are not counted in the SB memory in use
+**       statistics, but are still allocated from the perspective of the pool.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**       The worst case amount of pool memory held by the cache is this value
+**       multiplied by the sum of all the SB block sizes.
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_DEPTH         CFE_PLATFORM_SB_CFGVAL(BUF_CACHE_DEPTH)
+#define DEFAULT_CFE_PLATFORM_SB_BUF_CACHE_DEPTH 4
+
 /**
 **  \cfeescfg Define SB Memory Pool Block Sizes
 **
@@ -58,5 +58,7 @@
 #define DEFAULT_CFE_MISSION_SB_ALLSUBS_TLM_TOPICID 13
 #define CFE_MISSION_SB_ONESUB_TLM_TOPICID          CFE_MISSION_SB_TIDVAL(ONESUB_TLM)
 #define DEFAULT_CFE_MISSION_SB_ONESUB_TLM_TOPICID  14
+#define CFE_MISSION_SB_LATENCY_TLM_TOPICID         CFE_MISSION_SB_TIDVAL(LATENCY_TLM)
+#define DEFAULT_CFE_MISSION_SB_LATENCY_TLM_TOPICID 15
 
 #endif
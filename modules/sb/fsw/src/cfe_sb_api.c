@@ -187,9 +187,10 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
     if (Status == CFE_SUCCESS)
     {
         /* fill in the pipe table fields */
-        PipeDscPtr->SysQueueId    = SysQueueId;
-        PipeDscPtr->MaxQueueDepth = Depth;
-        PipeDscPtr->AppId         = AppId;
+        PipeDscPtr->SysQueueId      = SysQueueId;
+        PipeDscPtr->PriorityQueueId = OS_OBJECT_ID_UNDEFINED;
+        PipeDscPtr->MaxQueueDepth   = Depth;
+        PipeDscPtr->AppId           = AppId;
 
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
 
@@ -343,6 +344,111 @@ void CFE_SB_RemovePipeFromRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Callback for adding the destination of a new mask subscription to a route
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_AddMaskSubToRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    const CFE_SB_MaskSub_t *MaskSubPtr = ArgPtr;
+
+    if (CFE_SB_MaskSubMatches(MaskSubPtr, CFE_SBR_GetMsgId(RouteId)))
+    {
+        CFE_SB_AddMaskDest(RouteId, MaskSubPtr);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Callback for removing the destination of a removed mask subscription from a route
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RemoveMaskSubFromRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    const CFE_SB_MaskSub_t *MaskSubPtr = ArgPtr;
+    CFE_SB_DestinationD_t  *DestPtr;
+    CFE_SB_MsgId_t          MsgId;
+
+    MsgId = CFE_SBR_GetMsgId(RouteId);
+    if (!CFE_SB_MaskSubMatches(MaskSubPtr, MsgId))
+    {
+        return;
+    }
+
+    /* Keep the destination if it is explicit, or another mask subscription of the pipe also matches */
+    DestPtr = CFE_SB_GetDestPtr(RouteId, MaskSubPtr->PipeId);
+    if (DestPtr != NULL && DestPtr->MaskSub && CFE_SB_FindMaskSub(MaskSubPtr->PipeId, MsgId) == NULL)
+    {
+        CFE_SB_RemoveDest(RouteId, DestPtr);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes all mask subscriptions of a pipe, not their destinations
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RemoveMaskSubs(CFE_SB_PipeId_t PipeId)
+{
+    CFE_SB_MaskSub_t *MaskSubPtr;
+    uint32            Idx;
+
+    MaskSubPtr = CFE_SB_Global.MaskSub;
+    for (Idx = 0; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(MaskSubPtr->PipeId, PipeId))
+        {
+            memset(MaskSubPtr, 0, sizeof(*MaskSubPtr));
+            --CFE_SB_Global.MaskSubsInUse;
+        }
+
+        ++MaskSubPtr;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes any messages that might be on a pipe queue, then deletes the queue
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DeletePipeQueue(osal_id_t SysQueueId)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+    size_t            BufDscSize;
+
+    BufDscPtr = NULL;
+
+    while (true)
+    {
+        /* decrement refcount of any previous buffer */
+        if (BufDscPtr != NULL)
+        {
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+            BufDscPtr = NULL;
+        }
+
+        if (OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK) != OS_SUCCESS)
+        {
+            /* no more messages */
+            break;
+        }
+    }
+
+    /* Delete the underlying OS queue */
+    OS_QueueDelete(SysQueueId);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -354,17 +460,18 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     CFE_SB_PipeD_t             *PipeDscPtr;
     int32                       Status;
     CFE_ES_TaskId_t             TskId;
-    CFE_SB_BufferD_t           *BufDscPtr;
     osal_id_t                   SysQueueId;
+    osal_id_t                   PriorityQueueId;
+    uint32                      WaiterMask;
     char                        FullName[(OS_MAX_API_NAME * 2)];
-    size_t                      BufDscSize;
     CFE_SB_RemovePipeCallback_t Args;
     uint16                      PendingEventID;
 
-    Status         = CFE_SUCCESS;
-    PendingEventID = 0;
-    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
-    BufDscPtr      = NULL;
+    Status          = CFE_SUCCESS;
+    PendingEventID  = 0;
+    SysQueueId      = OS_OBJECT_ID_UNDEFINED;
+    PriorityQueueId = OS_OBJECT_ID_UNDEFINED;
+    WaiterMask      = 0;
 
     /* take semaphore to prevent a task switch during this call */
     CFE_SB_LockSharedData(__func__, __LINE__);
@@ -384,6 +491,9 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     }
     else
     {
+        /* Remove the mask subscriptions of the pipe, so they do not add it to any new route */
+        CFE_SB_RemoveMaskSubs(PipeId);
+
         /* Remove the pipe from all routes */
         Args.PipeId   = PipeId;
         Args.FullName = FullName;
@@ -397,8 +507,12 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          *
          * However we must first save certain state data for later deletion.
          */
-        SysQueueId = PipeDscPtr->SysQueueId;
-        BufDscPtr  = PipeDscPtr->LastBuffer;
+        SysQueueId      = PipeDscPtr->SysQueueId;
+        PriorityQueueId = PipeDscPtr->PriorityQueueId;
+        WaiterMask      = PipeDscPtr->WaiterMask;
+
+        /* release any buffers still referenced from previous receive calls */
+        CFE_SB_PipeDescReleaseBuffers(PipeDscPtr);
 
         /*
          * Mark entry as "reserved" so other resources can be deleted
@@ -411,29 +525,21 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-    /* remove any messages that might be on the pipe */
+    /* remove any messages that might be on the pipe, and delete the queue of each lane */
     if (Status == CFE_SUCCESS)
     {
-        while (true)
+        if (OS_ObjectIdDefined(PriorityQueueId))
         {
-            /* decrement refcount of any previous buffer */
-            if (BufDscPtr != NULL)
-            {
-                CFE_SB_LockSharedData(__func__, __LINE__);
-                CFE_SB_DecrBufUseCnt(BufDscPtr);
-                CFE_SB_UnlockSharedData(__func__, __LINE__);
-                BufDscPtr = NULL;
-            }
-
-            if (OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK) != OS_SUCCESS)
-            {
-                /* no more messages */
-                break;
-            }
+            CFE_SB_DeletePipeQueue(PriorityQueueId);
         }
 
-        /* Delete the underlying OS queue */
-        OS_QueueDelete(SysQueueId);
+        CFE_SB_DeletePipeQueue(SysQueueId);
+
+        /* Wake any task waiting on this pipe in CFE_SB_ReceiveBufferAny(), so it sees the pipe is gone */
+        if (WaiterMask != 0)
+        {
+            CFE_SB_PipeWaiter_Wake(WaiterMask);
+        }
     }
 
     /*
@@ -704,6 +810,91 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_SetPipeReadyHandler(CFE_SB_PipeId_t PipeId, CFE_SB_PipeReadyHandler_t Handler, void *Arg)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    CFE_ES_AppId_t  AppID;
+    int32           Status;
+
+    Status = CFE_ES_GetAppID(&AppID);
+    if (Status != CFE_SUCCESS)
+    {
+        /* shouldn't happen... */
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check input parameter, only the owner of the pipe can set the handler */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) || !CFE_RESOURCEID_TEST_EQUAL(AppID, PipeDscPtr->AppId))
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter++;
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        PipeDscPtr->ReadyHandler = Handler;
+        PipeDscPtr->ReadyArg     = Arg;
+        PipeDscPtr->ReadyArmed   = false;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Same as finding the pipe empty, this also notifies right away if it is not */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_PipeReady_Arm(PipeId);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_SetPipeTransport(CFE_SB_PipeId_t PipeId, CFE_SB_PipeTransportFunc_t TransportFunc, void *Arg)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    CFE_ES_AppId_t  AppID;
+    int32           Status;
+
+    Status = CFE_ES_GetAppID(&AppID);
+    if (Status != CFE_SUCCESS)
+    {
+        /* shouldn't happen... */
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check input parameter, only the owner of the pipe can set the transport */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) || !CFE_RESOURCEID_TEST_EQUAL(AppID, PipeDscPtr->AppId))
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter++;
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        PipeDscPtr->TransportFunc = TransportFunc;
+        PipeDscPtr->TransportArg  = Arg;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -928,6 +1119,69 @@ CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
                                 (uint8)CFE_SB_MSG_GLOBAL);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CreatePriorityLane(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    osal_id_t       SysQueueId;
+    int32           OsStatus;
+    uint32          PipeIdx;
+    uint16          Depth;
+    char            QueueName[OS_MAX_API_NAME];
+
+    Depth = 0;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) && CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId)
+        && !OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId))
+    {
+        Depth = PipeDscPtr->MaxQueueDepth;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Nothing to do if the lane exists already, an invalid pipe is reported by the caller */
+    if (Depth == 0 || CFE_SB_PipeId_ToIndex(PipeId, &PipeIdx) != CFE_SUCCESS)
+    {
+        return;
+    }
+
+    /* create the queue while unlocked, same as CFE_SB_CreatePipe() */
+    snprintf(QueueName, sizeof(QueueName), "SB_LANE%lu", (unsigned long)PipeIdx);
+    OsStatus = OS_QueueCreate(&SysQueueId, QueueName, Depth, sizeof(CFE_SB_BufferD_t *), 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Priority lane not created for pipe %lu, RC=%ld\n",
+                             __func__,
+                             CFE_RESOURCEID_TO_ULONG(PipeId),
+                             (long)OsStatus);
+        return;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* The pipe may have been deleted, or given a lane by another subscription, in the meantime */
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) && !OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId))
+    {
+        PipeDscPtr->PriorityQueueId = SysQueueId;
+        SysQueueId                  = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (OS_ObjectIdDefined(SysQueueId))
+    {
+        OS_QueueDelete(SysQueueId);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -963,6 +1217,12 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
     /* get TaskId of caller for events */
     CFE_ES_GetTaskID(&TskId);
 
+    /* A high priority subscription needs the high priority lane, which can not be created while locked */
+    if (Quality.Priority != CFE_SB_QosPriority_LOW)
+    {
+        CFE_SB_CreatePriorityLane(PipeId, AppId);
+    }
+
     /* take semaphore to prevent a task switch during this call */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
@@ -992,7 +1252,7 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
         if (!CFE_SBR_IsValidRouteId(RouteId))
         {
             /* Add the route */
-            RouteId = CFE_SBR_AddRoute(MsgId, &Collisions);
+            RouteId = CFE_SB_AddRouteEntry(MsgId, &Collisions);
 
             /* if all routing table elements are used, send event */
             if (!CFE_SBR_IsValidRouteId(RouteId))
@@ -1002,13 +1262,8 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
             }
             else
             {
-                /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
-                /* adjust the high water mark */
-                CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
-                if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
-                {
-                    CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
-                }
+                /* The new route also goes to the pipes of any matching mask subscriptions */
+                CFE_SB_ApplyMaskSubs(RouteId);
             }
         }
     }
@@ -1024,7 +1279,25 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
             /* Check if duplicate (status stays as CFE_SUCCESS) */
             if (CFE_RESOURCEID_TEST_EQUAL(DestPtr->PipeId, PipeId))
             {
-                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                /*
+                 * A destination of a mask subscription becomes an explicit one, so
+                 * it is kept if the mask subscription is removed.
+                 */
+                if (DestPtr->MaskSub)
+                {
+                    DestPtr->MaskSub       = false;
+                    DestPtr->Scope         = Scope;
+                    DestPtr->MsgId2PipeLim = MsgLim;
+                    DestPtr->Priority      = CFE_SB_QosPriority_LOW;
+                    if (Quality.Priority != CFE_SB_QosPriority_LOW)
+                    {
+                        DestPtr->Priority = CFE_SB_QosPriority_HIGH;
+                    }
+                }
+                else
+                {
+                    PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                }
                 break;
             }
 
@@ -1055,9 +1328,17 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
                 DestPtr->BuffCount     = 0;
                 DestPtr->DestCnt       = 0;
                 DestPtr->Scope         = Scope;
+                DestPtr->Priority      = CFE_SB_QosPriority_LOW;
+                DestPtr->MaskSub       = false;
                 DestPtr->Prev          = NULL;
                 DestPtr->Next          = NULL;
 
+                /* Any priority above normal uses the high priority lane */
+                if (Quality.Priority != CFE_SB_QosPriority_LOW)
+                {
+                    DestPtr->Priority = CFE_SB_QosPriority_HIGH;
+                }
+
                 /* add destination node */
                 CFE_SB_AddDestNode(RouteId, DestPtr);
 
@@ -1247,43 +1528,58 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
-{
-    int32 Status = 0;
-
-    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_MSG_LOCAL, AppId);
-
-    return Status;
-}
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
+ * Implemented per public API
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8 Scope, CFE_ES_AppId_t AppId)
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  CFE_SB_Qos_t Quality, uint16 MsgLim)
 {
-    int32                  Status;
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
-    CFE_SB_PipeD_t        *PipeDscPtr;
-    uint16                 PendingEventID;
+    CFE_SB_PipeD_t     *PipeDscPtr;
+    CFE_SB_MaskSub_t   *MaskSubPtr;
+    CFE_SB_MaskSub_t   *FreeMaskSubPtr;
+    CFE_SB_MsgId_Atom_t MsgIdValue;
+    CFE_SB_MsgId_Atom_t Bit;
+    CFE_ES_TaskId_t     TskId;
+    CFE_ES_AppId_t      AppId;
+    int32               Status;
+    uint32              Idx;
+    uint32              MatchCount;
+    char                FullName[(OS_MAX_API_NAME * 2)];
+    uint16              PendingEventID;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
-    DestPtr        = NULL;
+    MsgIdValue     = CFE_SB_MsgIdToValue(MsgId) & Mask;
+
+    /*
+     * Every matching ID that is sent keeps a route while the subscription exists, so
+     * count the valid IDs the mask can match (each clear bit doubles it), stopping
+     * once over the limit
+     */
+    MatchCount = 1;
+    for (Bit = 1; Bit != 0 && Bit <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID
+                  && MatchCount <= CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS;
+         Bit <<= 1)
+    {
+        if ((Mask & Bit) == 0)
+        {
+            MatchCount *= 2;
+        }
+    }
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
 
     /* get TaskId of caller for events */
     CFE_ES_GetTaskID(&TskId);
 
+    /* Same as CFE_SB_SubscribeFull(), the lane can not be created while locked */
+    if (Quality.Priority != CFE_SB_QosPriority_LOW)
+    {
+        CFE_SB_CreatePriorityLane(PipeId, AppId);
+    }
+
     /* take semaphore to prevent a task switch during this call */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
@@ -1291,27 +1587,404 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
     PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
     if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
     {
-        PendingEventID = CFE_SB_UNSUB_INV_PIPE_EID;
+        PendingEventID = CFE_SB_SUB_INV_PIPE_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
     }
-    /* if given 'AppId' is not the owner of the pipe, send error event and return */
     else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
     {
-        PendingEventID = CFE_SB_UNSUB_INV_CALLER_EID;
+        PendingEventID = CFE_SB_SUB_INV_CALLER_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
     }
-    /* check input parameters */
-    else if (!CFE_SB_IsValidMsgId(MsgId) || (Scope > 1))
+    else if (MatchCount > CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS)
     {
-        PendingEventID = CFE_SB_UNSUB_ARG_ERR_EID;
+        PendingEventID = CFE_SB_SUB_ARG_ERR_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
     }
     else
     {
-        /* get routing id */
-        RouteId = CFE_SBR_GetRouteId(MsgId);
-
-        /* Status remains CFE_SUCCESS if route is valid or not */
+        /* Check for a duplicate, and find a free entry at the same time */
+        FreeMaskSubPtr = NULL;
+        MaskSubPtr     = CFE_SB_Global.MaskSub;
+        for (Idx = 0; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(MaskSubPtr->PipeId))
+            {
+                if (FreeMaskSubPtr == NULL)
+                {
+                    FreeMaskSubPtr = MaskSubPtr;
+                }
+            }
+            else if (CFE_RESOURCEID_TEST_EQUAL(MaskSubPtr->PipeId, PipeId) && MaskSubPtr->Mask == Mask
+                     && MaskSubPtr->MsgIdValue == MsgIdValue)
+            {
+                /* status stays as CFE_SUCCESS */
+                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                break;
+            }
+
+            ++MaskSubPtr;
+        }
+
+        if (PendingEventID != 0)
+        {
+            /* duplicate, nothing to do */
+        }
+        else if (FreeMaskSubPtr == NULL)
+        {
+            PendingEventID = CFE_SB_MAX_MASK_SUBS_MET_EID;
+            Status         = CFE_SB_MAX_MSGS_MET;
+        }
+        else
+        {
+            FreeMaskSubPtr->PipeId     = PipeId;
+            FreeMaskSubPtr->MsgIdValue = MsgIdValue;
+            FreeMaskSubPtr->Mask       = Mask;
+            FreeMaskSubPtr->MsgLim     = MsgLim;
+            FreeMaskSubPtr->Priority   = CFE_SB_QosPriority_LOW;
+
+            /* Any priority above normal uses the high priority lane */
+            if (Quality.Priority != CFE_SB_QosPriority_LOW)
+            {
+                FreeMaskSubPtr->Priority = CFE_SB_QosPriority_HIGH;
+            }
+
+            ++CFE_SB_Global.MaskSubsInUse;
+
+            /* Message IDs without a route may now have one when looked up */
+            ++CFE_SB_Global.RouteGeneration;
+
+            /* Routes that already exist get the destination now, others when they are first looked up */
+            CFE_SBR_ForEachRouteId(CFE_SB_AddMaskSubToRoute, FreeMaskSubPtr, NULL);
+        }
+    }
+
+    /* Increment counter before unlock */
+    if (PendingEventID == CFE_SB_DUP_SUBSCRIP_EID)
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.DuplicateSubscriptionsCounter++;
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    switch (PendingEventID)
+    {
+        case CFE_SB_DUP_SUBSCRIP_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_DUP_SUBSCRIP_EID,
+                                       CFE_EVS_EventType_INFORMATION,
+                                       CFE_SB_Global.AppId,
+                                       "Duplicate Mask Subscription,MsgId 0x%x/0x%x on pipe %lu,app %s",
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_SUB_INV_CALLER_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_CALLER_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Subscribe Err:Caller(%s) is not the owner of pipe %lu,Msg=0x%x/0x%x",
+                                       CFE_SB_GetAppTskName(TskId, FullName),
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask);
+            break;
+
+        case CFE_SB_SUB_INV_PIPE_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_PIPE_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Subscribe Err:Invalid Pipe Id,Msg=0x%x/0x%x,PipeId=%lu,App %s",
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_SUB_ARG_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_ARG_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Subscribe Err:Mask matches over %d IDs,MsgId 0x%x/0x%x,PipeId %lu,app %s",
+                                       CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS,
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_MAX_MASK_SUBS_MET_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MASK_SUBS_MET_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Subscribe Err:Max Mask Subs(%d)In Use,MsgId 0x%x/0x%x,PipeId %lu,app %s",
+                                       CFE_PLATFORM_SB_MAX_MASK_SUBS,
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        default:
+            break;
+    }
+
+    /* If no other event pending, send a debug event indicating success */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_RCVD_EID,
+                                   CFE_EVS_EventType_DEBUG,
+                                   CFE_SB_Global.AppId,
+                                   "Mask Subscription Rcvd:MsgId 0x%x/0x%x on PipeId %lu,app %s",
+                                   (unsigned int)MsgIdValue,
+                                   (unsigned int)Mask,
+                                   CFE_RESOURCEID_TO_ULONG(PipeId),
+                                   CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId)
+{
+    CFE_SB_PipeD_t     *PipeDscPtr;
+    CFE_SB_MaskSub_t   *MaskSubPtr;
+    CFE_SB_MaskSub_t    RemovedMaskSub;
+    CFE_SB_MsgId_Atom_t MsgIdValue;
+    CFE_ES_TaskId_t     TskId;
+    CFE_ES_AppId_t      AppId;
+    int32               Status;
+    uint32              Idx;
+    char                FullName[(OS_MAX_API_NAME * 2)];
+    uint16              PendingEventID;
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    MsgIdValue     = CFE_SB_MsgIdToValue(MsgId) & Mask;
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check that the pipe has been created */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_PIPE_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_CALLER_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* Status remains CFE_SUCCESS if the mask subscription does not exist */
+        PendingEventID = CFE_SB_UNSUB_NO_SUBS_EID;
+
+        MaskSubPtr = CFE_SB_Global.MaskSub;
+        for (Idx = 0; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(MaskSubPtr->PipeId, PipeId) && MaskSubPtr->Mask == Mask
+                && MaskSubPtr->MsgIdValue == MsgIdValue)
+            {
+                /* Free the entry first, so it is not found when checking for other matching entries */
+                RemovedMaskSub = *MaskSubPtr;
+                memset(MaskSubPtr, 0, sizeof(*MaskSubPtr));
+                --CFE_SB_Global.MaskSubsInUse;
+                ++CFE_SB_Global.RouteGeneration;
+
+                CFE_SBR_ForEachRouteId(CFE_SB_RemoveMaskSubFromRoute, &RemovedMaskSub, NULL);
+
+                PendingEventID = 0;
+                break;
+            }
+
+            ++MaskSubPtr;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    switch (PendingEventID)
+    {
+        case CFE_SB_UNSUB_NO_SUBS_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_NO_SUBS_EID,
+                                       CFE_EVS_EventType_INFORMATION,
+                                       CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:No mask subs for Msg 0x%x/0x%x on pipe %lu,app %s",
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_UNSUB_INV_PIPE_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_PIPE_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Invalid Pipe Id Msg=0x%x/0x%x,Pipe=%lu,app=%s",
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_UNSUB_INV_CALLER_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_CALLER_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Caller(%s) is not the owner of pipe %lu,Msg=0x%x/0x%x",
+                                       CFE_SB_GetAppTskName(TskId, FullName),
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       (unsigned int)MsgIdValue,
+                                       (unsigned int)Mask);
+            break;
+
+        default:
+            break;
+    }
+
+    /* if no other event pending, send a debug event for successful unsubscribe */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_REMOVED_EID,
+                                   CFE_EVS_EventType_DEBUG,
+                                   CFE_SB_Global.AppId,
+                                   "Mask Subscription Removed:Msg 0x%x/0x%x on pipe %lu,app %s",
+                                   (unsigned int)MsgIdValue,
+                                   (unsigned int)Mask,
+                                   CFE_RESOURCEID_TO_ULONG(PipeId),
+                                   CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_HasSubscribers(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+    bool                   Result;
+
+    Result = false;
+
+    /* Skip the lock entirely for most message IDs without subscribers */
+    if (CFE_SB_IsValidMsgId(MsgId) && CFE_SB_IsRoutePresent(MsgId))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /* Only looks, a matching mask subscription does not get a route added here */
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+        if (CFE_SBR_IsValidRouteId(RouteId))
+        {
+            /* Destinations may have been disabled by command */
+            for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL && !Result; DestPtr = DestPtr->Next)
+            {
+                Result = (DestPtr->Active == CFE_SB_ACTIVE);
+            }
+        }
+        else if (CFE_SB_Global.MaskSubsInUse != 0)
+        {
+            /* Gets a route with the mask destinations when first sent */
+            Result = (CFE_SB_FindMaskSub(CFE_SB_INVALID_PIPE, MsgId) != NULL);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
+{
+    int32 Status = 0;
+
+    Status = CFE_SB_UnsubscribeFull(MsgId, PipeId, (uint8)CFE_SB_MSG_LOCAL, AppId);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8 Scope, CFE_ES_AppId_t AppId)
+{
+    int32                  Status;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_ES_TaskId_t        TskId;
+    CFE_SB_DestinationD_t *DestPtr;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
+    char                   PipeName[OS_MAX_API_NAME];
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    uint16                 PendingEventID;
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    DestPtr        = NULL;
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check that the pipe has been created */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_PIPE_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    /* if given 'AppId' is not the owner of the pipe, send error event and return */
+    else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_CALLER_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    /* check input parameters */
+    else if (!CFE_SB_IsValidMsgId(MsgId) || (Scope > 1))
+    {
+        PendingEventID = CFE_SB_UNSUB_ARG_ERR_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* get routing id */
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+
+        /* Status remains CFE_SUCCESS if route is valid or not */
         if (!CFE_SBR_IsValidRouteId(RouteId))
         {
             /* If there are no subscriptions, simply report via event */
@@ -1322,7 +1995,8 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
             /* Get the destination pointer */
             DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
 
-            if (DestPtr != NULL)
+            /* A destination of a mask subscription is only removed with CFE_SB_UnsubscribeMask() */
+            if (DestPtr != NULL && !DestPtr->MaskSub)
             {
                 /* match found, remove destination */
                 CFE_SB_RemoveDest(RouteId, DestPtr);
@@ -1369,31 +2043,141 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
                                        (unsigned int)CFE_SB_MsgIdToValue(MsgId));
             break;
 
-        case CFE_SB_UNSUB_ARG_ERR_EID:
-            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_ARG_ERR_EID,
-                                       CFE_EVS_EventType_ERROR,
-                                       CFE_SB_Global.AppId,
-                                       "Unsubscribe Err:Bad Arg,MsgId 0x%x,PipeId %lu,app %s,scope %d",
-                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                                       CFE_RESOURCEID_TO_ULONG(PipeId),
-                                       CFE_SB_GetAppTskName(TskId, FullName),
-                                       (int)Scope);
-            break;
+        case CFE_SB_UNSUB_ARG_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_ARG_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Bad Arg,MsgId 0x%x,PipeId %lu,app %s,scope %d",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                       CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName),
+                                       (int)Scope);
+            break;
+
+        default:
+            break;
+    }
+
+    /* if no other event pending, send a debug event for successful unsubscribe */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_REMOVED_EID,
+                                   CFE_EVS_EventType_DEBUG,
+                                   CFE_SB_Global.AppId,
+                                   "Subscription Removed:Msg 0x%x on pipe %lu,app %s",
+                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                   CFE_RESOURCEID_TO_ULONG(PipeId),
+                                   CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_Status_t               Status;
+
+    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtr);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+
+        /*
+         * Set the verify flag true by default -
+         * in the default impl verify is a no-op that always succeeds.
+         * If an actual implementation is provided, it will be used here.
+         */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    }
+
+    if (BufPtr != NULL)
+    {
+        /*
+         * Note - the API should qualify the parameter as "const", but this is
+         * kept non-const for backward compatibility.  Callers should never write to
+         * the returned buffer, it is const in practice.
+         */
+        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveTxn_Execute(Txn);
+    }
+
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    Status = CFE_SB_MessageTxn_GetStatus(Txn);
+
+    /* The pipe was found empty, see CFE_SB_SetPipeReadyHandler() */
+    if (Status == CFE_SB_NO_MESSAGE || Status == CFE_SB_TIME_OUT)
+    {
+        CFE_SB_PipeReady_Arm(PipeId);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBufferMulti(CFE_SB_Buffer_t *BufPtrs[], uint32 MaxBuffers, uint32 *NumReceived,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_Status_t               Status;
+    uint32                     Count;
+
+    Count = 0;
+    Txn   = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtrs);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn) && (NumReceived == NULL || MaxBuffers == 0))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* This also releases all buffers from the previous call in one pass */
+        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+
+        /* Set the verify flag true by default, same as CFE_SB_ReceiveBuffer() */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+
+        Count = CFE_SB_ReceiveTxn_ExecuteMulti(Txn, BufPtrs, MaxBuffers);
+    }
 
-        default:
-            break;
+    if (NumReceived != NULL)
+    {
+        *NumReceived = Count;
     }
 
-    /* if no other event pending, send a debug event for successful unsubscribe */
-    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    Status = CFE_SB_MessageTxn_GetStatus(Txn);
+
+    /* The pipe was found empty, see CFE_SB_SetPipeReadyHandler() */
+    if (Status == CFE_SB_NO_MESSAGE || Status == CFE_SB_TIME_OUT)
     {
-        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_REMOVED_EID,
-                                   CFE_EVS_EventType_DEBUG,
-                                   CFE_SB_Global.AppId,
-                                   "Subscription Removed:Msg 0x%x on pipe %lu,app %s",
-                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                                   CFE_RESOURCEID_TO_ULONG(PipeId),
-                                   CFE_SB_GetAppTskName(TskId, FullName));
+        CFE_SB_PipeReady_Arm(PipeId);
     }
 
     return Status;
@@ -1405,38 +2189,42 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+CFE_Status_t CFE_SB_ReceiveBufferAny(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t *PipeIdPtr,
+                                     const CFE_SB_PipeId_t PipeIds[], uint32 NumPipes, int32 TimeOut)
 {
-    CFE_SB_ReceiveTxn_State_t  TxnBuf;
-    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_SB_ReceiveAnyTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t   *Txn;
+    uint32                       i;
 
-    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtr);
+    Txn = CFE_SB_ReceiveAnyTxn_Init(&TxnBuf, BufPtr);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn)
+        && (PipeIdPtr == NULL || PipeIds == NULL || NumPipes == 0 || NumPipes > CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
 
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
         CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
     }
 
-    if (CFE_SB_MessageTxn_IsOK(Txn))
+    /* This also releases the buffers from the previous call on each pipe */
+    for (i = 0; i < NumPipes && CFE_SB_MessageTxn_IsOK(Txn); ++i)
     {
-        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+        CFE_SB_ReceiveTxn_AddPipeId(Txn, PipeIds[i]);
+    }
 
-        /*
-         * Set the verify flag true by default -
-         * in the default impl verify is a no-op that always succeeds.
-         * If an actual implementation is provided, it will be used here.
-         */
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* Set the verify flag true by default, same as CFE_SB_ReceiveBuffer() */
         CFE_SB_MessageTxn_SetEndpoint(Txn, true);
     }
 
     if (BufPtr != NULL)
     {
-        /*
-         * Note - the API should qualify the parameter as "const", but this is
-         * kept non-const for backward compatibility.  Callers should never write to
-         * the returned buffer, it is const in practice.
-         */
-        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveTxn_Execute(Txn);
+        /* Same as CFE_SB_ReceiveBuffer(), the returned buffer is const in practice */
+        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveAnyTxn_Execute(Txn, PipeIdPtr);
     }
 
     CFE_SB_MessageTxn_ReportEvents(Txn);
@@ -1584,59 +2372,328 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+CFE_Status_t CFE_SB_GetRouteHandle(CFE_SB_MsgId_t MsgId, CFE_SB_RouteHandle_t *HandlePtr)
+{
+    CFE_SBR_RouteId_t RouteId;
+
+    if (HandlePtr == NULL || !CFE_SB_IsValidMsgId(MsgId))
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* A message ID without subscribers is also resolved, so it can be skipped until that changes */
+    RouteId = CFE_SB_LookupRoute(MsgId);
+    CFE_SB_SetRouteHandle(HandlePtr, MsgId, RouteId);
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitBufferToRoute(CFE_SB_Buffer_t *BufPtr, CFE_SB_RouteHandle_t *HandlePtr, bool IsOrigination)
 {
     CFE_SB_TransmitTxn_State_t TxnBuf;
     CFE_SB_MessageTxn_State_t *Txn;
-    CFE_SB_Buffer_t           *BufPtr;
 
-    BufPtr = NULL;
-    Txn    = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, BufPtr);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn) && HandlePtr == NULL)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
 
     /* In this context, the user should have set the the size and MsgId in the content */
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
-        CFE_SB_TransmitTxn_SetupFromMsg(Txn, MsgPtr);
+        CFE_SB_TransmitTxn_SetupFromMsg(Txn, &BufPtr->Msg);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+        CFE_SB_TransmitTxn_SetRouteHandle(Txn, HandlePtr);
+
+        CFE_SB_TransmitTxn_Execute(Txn, BufPtr);
+    }
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const BufPtrs[], CFE_Status_t StatusArray[], uint32 NumBuffers,
+                                        bool IsOrigination)
+{
+    CFE_SB_TransmitTxn_State_t  SingleTxn;
+    CFE_SB_TransmitTxn_State_t *TxnBuf;
+    CFE_SB_MessageTxn_State_t  *Txn;
+    CFE_Status_t                Status;
+    uint32                      MaxChunkSize;
+    uint32                      ChunkSize;
+    uint32                      i;
+
+    if (BufPtrs == NULL || StatusArray == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    if (NumBuffers == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    /*
+     * The transaction states for a full chunk are too large for the stack of the
+     * calling task, so they come from the SB pool.  If the pool is exhausted the
+     * buffers are still sent, one at a time through a single transaction state.
+     */
+    TxnBuf       = NULL;
+    MaxChunkSize = 1;
+    if (NumBuffers > 1)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        TxnBuf = CFE_SB_GetTransmitBatchBlk();
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    if (TxnBuf != NULL)
+    {
+        MaxChunkSize = CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE;
+    }
+    else
+    {
+        TxnBuf = &SingleTxn;
+    }
+
+    Status = CFE_SUCCESS;
+
+    while (NumBuffers > 0)
+    {
+        ChunkSize = NumBuffers;
+        if (ChunkSize > MaxChunkSize)
+        {
+            ChunkSize = MaxChunkSize;
+        }
+
+        for (i = 0; i < ChunkSize; ++i)
+        {
+            Txn = CFE_SB_TransmitTxn_Init(&TxnBuf[i], BufPtrs[i]);
+
+            /* In this context, the user should have set the the size and MsgId in the content */
+            if (CFE_SB_MessageTxn_IsOK(Txn))
+            {
+                CFE_SB_TransmitTxn_SetupFromMsg(Txn, &BufPtrs[i]->Msg);
+            }
+
+            if (CFE_SB_MessageTxn_IsOK(Txn))
+            {
+                CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+            }
+        }
+
+        CFE_SB_TransmitTxn_ExecuteBatch(TxnBuf, BufPtrs, ChunkSize);
+
+        for (i = 0; i < ChunkSize; ++i)
+        {
+            Txn = &TxnBuf[i].MessageTxn_State;
+
+            /* send an event for each pipe write error that may have occurred */
+            CFE_SB_MessageTxn_ReportEvents(Txn);
+
+            StatusArray[i] = CFE_SB_MessageTxn_GetStatus(Txn);
+            if (Status == CFE_SUCCESS)
+            {
+                Status = StatusArray[i];
+            }
+        }
+
+        BufPtrs += ChunkSize;
+        StatusArray += ChunkSize;
+        NumBuffers -= ChunkSize;
+    }
+
+    if (TxnBuf != &SingleTxn)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_PutTransmitBatchBlk(TxnBuf);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitSegments(CFE_SB_Buffer_t *BufPtr, const CFE_SB_SegmentList_t *SegListPtr,
+                                     bool IsOrigination)
+{
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_MSG_Type_t             MsgType;
+    uint32                     i;
+
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, BufPtr);
+
+    /* In this context, the user should have set the the total size and MsgId in the content */
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_TransmitTxn_SetupFromMsg(Txn, &BufPtr->Msg);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /*
+         * Only telemetry can be segmented, as a command checksum covers the
+         * whole message but is only computed over the content in the buffer.
+         */
+        MsgType = CFE_MSG_Type_Invalid;
+        CFE_MSG_GetType(&BufPtr->Msg, &MsgType);
+
+        if (SegListPtr == NULL || MsgType != CFE_MSG_Type_Tlm
+            || (SegListPtr->Segments == NULL && SegListPtr->NumSegments > 0))
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        }
+        else
+        {
+            for (i = 0; i < SegListPtr->NumSegments; ++i)
+            {
+                if (SegListPtr->Segments[i].DataPtr == NULL && SegListPtr->Segments[i].Size > 0)
+                {
+                    CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+                    break;
+                }
+            }
+        }
     }
 
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
-        /* Get buffer - note this pre-initializes the returned buffer with
-         * a use count of 1, which refers to this task as it fills the buffer. */
-        BufPtr = CFE_SB_AllocateMessageBuffer(CFE_SB_MessageTxn_GetContentSize(Txn));
-        if (BufPtr == NULL)
+        CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+
+        CFE_SB_TransmitTxn_ExecuteSegments(Txn, BufPtr, SegListPtr);
+    }
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_GetSegment(const CFE_SB_Buffer_t *BufPtr, uint32 Index, const void **DataPtr, size_t *SizePtr)
+{
+    const CFE_SB_BufferD_t *BufDscPtr;
+    uint32                  NumSegments;
+    int32                   Status;
+
+    if (BufPtr == NULL || DataPtr == NULL || SizePtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    Status = CFE_SB_ReceivedBufferValidate(BufPtr, &BufDscPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        if (BufDscPtr->SegmentList != NULL)
         {
-            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
+            NumSegments = BufDscPtr->SegmentList->NumSegments;
         }
+        else
+        {
+            NumSegments = 0;
+        }
+
+        if (Index > NumSegments)
+        {
+            Status = CFE_SB_BAD_ARGUMENT;
+        }
+        else if (Index == 0)
+        {
+            /* Index 0 is the part of the message in the buffer itself */
+            *DataPtr = BufPtr;
+            *SizePtr = BufDscPtr->ContentSize;
+        }
+        else
+        {
+            *DataPtr = BufDscPtr->SegmentList->Segments[Index - 1].DataPtr;
+            *SizePtr = BufDscPtr->SegmentList->Segments[Index - 1].Size;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+{
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
+
+    /* In this context, the user should have set the the size and MsgId in the content */
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_TransmitTxn_SetupFromMsg(Txn, MsgPtr);
     }
 
     /*
-     * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
-     *
-     * Note - if there is no route / no subscribers, the "Status" will
-     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
-     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
-     * false.
-     *
-     * But if the descriptor is non-null it means the message is valid and
-     * there is a route to send it to.
+     * Most messages without subscribers can be identified without the lock, in
+     * which case there is no need to get a buffer and copy the content into it,
+     * as it would just be dropped.
      */
-    if (CFE_SB_MessageTxn_IsOK(Txn))
+    if (CFE_SB_MessageTxn_IsOK(Txn) && !CFE_SB_IsRoutePresent(CFE_SB_MessageTxn_GetRoutingMsgId(Txn)))
     {
-        /* Copy actual message content into buffer */
-        memcpy(&BufPtr->Msg, MsgPtr, CFE_SB_MessageTxn_GetContentSize(Txn));
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_TransmitTxn_SetNoSubscribers(Txn);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
 
+    /*
+     * Get a buffer, copy the content into it and broadcast it to all subscribers
+     * in the route.  A route may still turn out to have no subscribers when
+     * resolved, as the check above can not rule out all such messages.
+     */
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
         /* Save passed-in parameters */
         CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
 
-        CFE_SB_TransmitTxn_Execute(Txn, BufPtr);
-
-        /*
-         * The broadcast function consumes the buffer, so it should not be
-         * accessed in this function anymore
-         */
-        BufPtr = NULL;
+        CFE_SB_TransmitTxn_ExecuteCopy(Txn, MsgPtr);
     }
 
     /* send an event for each pipe write error that may have occurred */
@@ -86,6 +86,63 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
     Node->Next->Prev = Node;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BufCacheInit(size_t NumBlockSizes, const size_t *BlockSizeList)
+{
+    CFE_SB_BufCacheClass_t *ClassPtr;
+    size_t                  i;
+    uint16                  j;
+
+    memset(CFE_SB_Global.Mem.Cache, 0, sizeof(CFE_SB_Global.Mem.Cache));
+    CFE_SB_Global.Mem.NumCacheClasses = 0;
+
+    if (BlockSizeList == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < NumBlockSizes && CFE_SB_Global.Mem.NumCacheClasses < CFE_PLATFORM_SB_POOL_MAX_BUCKETS; ++i)
+    {
+        /* insert in increasing order, same as the pool buckets */
+        j = CFE_SB_Global.Mem.NumCacheClasses;
+        while (j > 0 && CFE_SB_Global.Mem.Cache[j - 1].BlockSize > BlockSizeList[i])
+        {
+            CFE_SB_Global.Mem.Cache[j].BlockSize = CFE_SB_Global.Mem.Cache[j - 1].BlockSize;
+            --j;
+        }
+
+        ClassPtr            = &CFE_SB_Global.Mem.Cache[j];
+        ClassPtr->BlockSize = BlockSizeList[i];
+        ++CFE_SB_Global.Mem.NumCacheClasses;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufCacheClass_t *CFE_SB_BufCacheFindClass(size_t AllocSize)
+{
+    uint16 i;
+
+    for (i = 0; i < CFE_SB_Global.Mem.NumCacheClasses; ++i)
+    {
+        if (AllocSize <= CFE_SB_Global.Mem.Cache[i].BlockSize)
+        {
+            return &CFE_SB_Global.Mem.Cache[i];
+        }
+    }
+
+    return NULL;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -94,19 +151,33 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  *-----------------------------------------------------------------*/
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 {
-    int32               stat1;
-    size_t              AllocSize;
-    CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t   *bd;
+    int32                   stat1;
+    size_t                  AllocSize;
+    CFE_ES_MemPoolBuf_t     addr = NULL;
+    CFE_SB_BufferD_t       *bd;
+    CFE_SB_BufCacheClass_t *ClassPtr;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    /* Use a previously released buffer of the same block size if one is available */
+    ClassPtr = CFE_SB_BufCacheFindClass(AllocSize);
+    if (ClassPtr != NULL && ClassPtr->Count > 0)
     {
-        return NULL;
+        --ClassPtr->Count;
+        addr = ClassPtr->Entries[ClassPtr->Count];
+        CFE_SB_Global.StatTlmMsg.Payload.BufCacheHits++;
+    }
+    else
+    {
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
+
+        CFE_SB_Global.StatTlmMsg.Payload.BufCacheMisses++;
     }
 
     /* increment the number of buffers in use and adjust the high water mark if needed */
@@ -144,14 +215,77 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
  *-----------------------------------------------------------------*/
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    CFE_SB_BufCacheClass_t *ClassPtr;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
+    /*
+     * No pipe refers to the segments any more, so they go back to the sender.  The
+     * release function must not be called with the SB lock held, so the buffer is
+     * kept until the lock is given, see CFE_SB_UnlockSharedData().
+     */
+    if (bd->SegmentList != NULL && bd->SegmentList->ReleaseFunc != NULL)
+    {
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.SegmentReleaseList, &bd->Link);
+        return;
+    }
+
     --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
 
-    /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    /* keep the buffer in the cache for re-use, if there is room for it */
+    ClassPtr = CFE_SB_BufCacheFindClass(bd->AllocatedSize);
+    if (ClassPtr != NULL && ClassPtr->Count < CFE_PLATFORM_SB_BUF_CACHE_DEPTH)
+    {
+        ClassPtr->Entries[ClassPtr->Count] = bd;
+        ++ClassPtr->Count;
+    }
+    else
+    {
+        /* finally give the buf descriptor back to the buf descriptor pool */
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseSegmentLists(CFE_SB_BufferLink_t *List)
+{
+    CFE_SB_BufferLink_t *NextLink;
+    CFE_SB_BufferD_t    *DscPtr;
+
+    /* Not locked, nothing else can reach the buffers in this list */
+    NextLink = CFE_SB_TrackingListGetNext(List);
+    while (!CFE_SB_TrackingListIsEnd(List, NextLink))
+    {
+        /* NOTE: casting via void* avoids a false alignment warning, same as CFE_SB_ZeroCopyReleaseAppId() */
+        DscPtr = (void *)NextLink;
+        DscPtr->SegmentList->ReleaseFunc(DscPtr->SegmentList);
+
+        NextLink = CFE_SB_TrackingListGetNext(NextLink);
+    }
+
+    /* The segments are released, now the buffers themselves can go back to the pool */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    NextLink = CFE_SB_TrackingListGetNext(List);
+    while (!CFE_SB_TrackingListIsEnd(List, NextLink))
+    {
+        DscPtr = (void *)NextLink;
+        CFE_SB_TrackingListRemove(NextLink);
+
+        DscPtr->SegmentList = NULL;
+        CFE_SB_ReturnBufferToPool(DscPtr);
+
+        NextLink = CFE_SB_TrackingListGetNext(List);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
 /*----------------------------------------------------------------
@@ -243,3 +377,48 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 
     return CFE_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_TransmitTxn_State_t *CFE_SB_GetTransmitBatchBlk(void)
+{
+    int32               Stat;
+    CFE_ES_MemPoolBuf_t addr = NULL;
+
+    /* Allocate the transaction states for one chunk of a batch transmit from the SB memory pool */
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl,
+                             CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE * sizeof(CFE_SB_TransmitTxn_State_t));
+    if (Stat < 0)
+    {
+        return NULL;
+    }
+
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
+    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+    }
+
+    return (CFE_SB_TransmitTxn_State_t *)addr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PutTransmitBatchBlk(CFE_SB_TransmitTxn_State_t *TxnSet)
+{
+    int32 Stat;
+
+    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, TxnSet);
+    if (Stat > 0)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
+    }
+}
@@ -30,168 +30,66 @@
 
 #include "cfe_sb_module_all.h"
 
-#include <string.h>
-
-/*----------------------------------------------------------------
- *
- * Internal helper routine only, not part of API.
- *
- * Verifies the length of incoming SB command packets, returns true if acceptable
- *
- *-----------------------------------------------------------------*/
-bool CFE_SB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
-{
-    bool              result       = true;
-    CFE_MSG_Size_t    ActualLength = 0;
-    CFE_MSG_FcnCode_t FcnCode      = 0;
-    CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
-
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
-
-    /*
-    ** Verify the command packet length
-    */
-    if (ExpectedLength != ActualLength)
-    {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+#include "cfe_core_cmddispatch.h"
 
-        CFE_EVS_SendEvent(CFE_SB_LEN_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                          (unsigned int)FcnCode,
-                          (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
-        result = false;
-        ++CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter;
-    }
+#include <string.h>
 
-    return result;
-}
+/* local cache of runtime MsgIDs for SB */
+static CFE_SB_MsgId_t CFE_SB_CMD_MID_CACHE          = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_SB_SEND_HK_MID_CACHE      = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_SB_SUB_RPT_CTRL_MID_CACHE = CFE_SB_MSGID_RESERVED;
 
-/*----------------------------------------------------------------
+/*
+ * Ground command dispatch table, indexed by function code
  *
- * Local Helper function
- *
- *-----------------------------------------------------------------*/
-void CFE_SB_ProcessSubReportCmd(const CFE_SB_Buffer_t *SBBufPtr)
-{
-    CFE_MSG_FcnCode_t FcnCode = 0;
-
-    /* Note: Command counter not incremented for this command */
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
-    switch (FcnCode)
-    {
-        case CFE_SB_SEND_PREV_SUBS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendPrevSubsCmd_t)))
-            {
-                CFE_SB_SendPrevSubsCmd((const CFE_SB_SendPrevSubsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_ENABLE_SUB_REPORTING_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_EnableSubReportingCmd_t)))
-            {
-                CFE_SB_EnableSubReportingCmd((const CFE_SB_EnableSubReportingCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_DISABLE_SUB_REPORTING_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_DisableSubReportingCmd_t)))
-            {
-                CFE_SB_DisableSubReportingCmd((const CFE_SB_DisableSubReportingCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Invalid Cmd, Unexpected Command Code %u",
-                              (unsigned int)FcnCode);
-            CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
-            break;
-    }
-}
-
-/*----------------------------------------------------------------
+ * Note: Command counter not incremented for the reset counters command
+ */
+static const CFE_CORE_CmdDispatchEntry_t CFE_SB_CMD_DISPATCH[] = {
+    [CFE_SB_NOOP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_NoopCmd_t, CFE_SB_NoopCmd),
+    [CFE_SB_RESET_COUNTERS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_ResetCountersCmd_t, CFE_SB_ResetCountersCmd),
+    [CFE_SB_SEND_SB_STATS_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_SendSbStatsCmd_t, CFE_SB_SendStatsCmd),
+    [CFE_SB_WRITE_ROUTING_INFO_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_WriteRoutingInfoCmd_t, CFE_SB_WriteRoutingInfoCmd),
+    [CFE_SB_ENABLE_ROUTE_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_EnableRouteCmd_t, CFE_SB_EnableRouteCmd),
+    [CFE_SB_DISABLE_ROUTE_CC]   = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_DisableRouteCmd_t, CFE_SB_DisableRouteCmd),
+    [CFE_SB_WRITE_PIPE_INFO_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_WritePipeInfoCmd_t, CFE_SB_WritePipeInfoCmd),
+    [CFE_SB_WRITE_MAP_INFO_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_WriteMapInfoCmd_t, CFE_SB_WriteMapInfoCmd),
+    [CFE_SB_WRITE_LATENCY_INFO_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_WriteLatencyInfoCmd_t, CFE_SB_WriteLatencyInfoCmd),
+};
+
+/*
+ * Internal subscription sync request dispatch table, indexed by function code
  *
- * Local Helper function
+ * Note: Command counter not incremented for these commands
+ */
+static const CFE_CORE_CmdDispatchEntry_t CFE_SB_SUB_RPT_CTRL_DISPATCH[] = {
+    [CFE_SB_SEND_PREV_SUBS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_SendPrevSubsCmd_t, CFE_SB_SendPrevSubsCmd),
+    [CFE_SB_ENABLE_SUB_REPORTING_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_EnableSubReportingCmd_t, CFE_SB_EnableSubReportingCmd),
+    [CFE_SB_DISABLE_SUB_REPORTING_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_SB_DisableSubReportingCmd_t, CFE_SB_DisableSubReportingCmd),
+};
+
+/*
+ * The housekeeping request has no function codes and no length check
  *
- *-----------------------------------------------------------------*/
-void CFE_SB_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
-{
-    CFE_MSG_FcnCode_t FcnCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
-    switch (FcnCode)
-    {
-        case CFE_SB_NOOP_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_NoopCmd_t)))
-            {
-                CFE_SB_NoopCmd((const CFE_SB_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_RESET_COUNTERS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_ResetCountersCmd_t)))
-            {
-                /* Note: Command counter not incremented for this command */
-                CFE_SB_ResetCountersCmd((const CFE_SB_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_SEND_SB_STATS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendSbStatsCmd_t)))
-            {
-                CFE_SB_SendStatsCmd((const CFE_SB_SendSbStatsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_ROUTING_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteRoutingInfoCmd_t)))
-            {
-                CFE_SB_WriteRoutingInfoCmd((const CFE_SB_WriteRoutingInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_ENABLE_ROUTE_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_EnableRouteCmd_t)))
-            {
-                CFE_SB_EnableRouteCmd((const CFE_SB_EnableRouteCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_DISABLE_ROUTE_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_DisableRouteCmd_t)))
-            {
-                CFE_SB_DisableRouteCmd((const CFE_SB_DisableRouteCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_PIPE_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WritePipeInfoCmd_t)))
-            {
-                CFE_SB_WritePipeInfoCmd((const CFE_SB_WritePipeInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_MAP_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteMapInfoCmd_t)))
-            {
-                CFE_SB_WriteMapInfoCmd((const CFE_SB_WriteMapInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Invalid Cmd, Unexpected Command Code %u",
-                              FcnCode);
-            CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
-            break;
-    }
-}
+ * Note: Command counter not incremented for this command
+ */
+static const CFE_CORE_CmdDispatchEntry_t CFE_SB_SEND_HK_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_SB_SendHKTlmCmd);
+
+/* Command statistics index of each message, after those of the previous messages */
+static const CFE_CORE_CmdDispatchSlot_t CFE_SB_DISPATCH_SLOTS[] = {
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_SB_SEND_HK_MID_CACHE, CFE_SB_SEND_HK_DISPATCH, 0),
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_SB_CMD_MID_CACHE, CFE_SB_CMD_DISPATCH, 1),
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_SB_SUB_RPT_CTRL_MID_CACHE,
+                                  CFE_SB_SUB_RPT_CTRL_DISPATCH,
+                                  1 + (sizeof(CFE_SB_CMD_DISPATCH) / sizeof(CFE_SB_CMD_DISPATCH[0]))),
+};
+
+static const CFE_CORE_CmdDispatchTable_t CFE_SB_DISPATCH_TABLE =
+    CFE_CORE_CMDDISPATCH_TABLE(CFE_SB_DISPATCH_SLOTS, CFE_ES_CmdStatsService_SB);
 
 /*----------------------------------------------------------------
  *
@@ -201,38 +99,49 @@ void CFE_SB_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
  *-----------------------------------------------------------------*/
 void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID          = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID      = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SUB_RPT_CTRL_MID = CFE_SB_MSGID_RESERVED;
-
-    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_HeaderView_t               HdrView;
+    const CFE_CORE_CmdDispatchEntry_t *EntryPtr;
+    uint16                             StatsIndex;
+    CFE_SB_MsgId_t                     MessageID;
+    CFE_Status_t                       Status;
 
     /* cache the local MID Values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CMD_MID))
+    if (!CFE_SB_IsValidMsgId(CFE_SB_CMD_MID_CACHE))
     {
-        CMD_MID          = CFE_SB_ValueToMsgId(CFE_SB_CMD_MID);
-        SEND_HK_MID      = CFE_SB_ValueToMsgId(CFE_SB_SEND_HK_MID);
-        SUB_RPT_CTRL_MID = CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID);
+        CFE_SB_CMD_MID_CACHE          = CFE_SB_ValueToMsgId(CFE_SB_CMD_MID);
+        CFE_SB_SEND_HK_MID_CACHE      = CFE_SB_ValueToMsgId(CFE_SB_SEND_HK_MID);
+        CFE_SB_SUB_RPT_CTRL_MID_CACHE = CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    /* Ignore return, buffer from SB is never NULL */
+    CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+    MessageID = CFE_MSG_HeaderView_GetMsgId(&HdrView);
 
-    /* Process all SB messages */
-    if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
+    Status = CFE_CORE_CmdDispatch_Lookup(&CFE_SB_DISPATCH_TABLE, &HdrView, &EntryPtr, &StatsIndex);
+
+    if (Status == CFE_SUCCESS)
     {
-        /* Housekeeping request */
-        /* Note: Command counter not incremented for this command */
-        CFE_SB_SendHKTlmCmd((const CFE_SB_SendHkCmd_t *)SBBufPtr);
+        /* Command handlers update the command counters themselves */
+        CFE_CORE_CmdDispatch_Invoke(&CFE_SB_DISPATCH_TABLE, EntryPtr, StatsIndex, SBBufPtr, &HdrView);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, CMD_MID))
+    else if (Status == CFE_STATUS_WRONG_MSG_LENGTH)
     {
-        /* Normal ground command */
-        CFE_SB_ProcessGroundCmd(SBBufPtr);
+        CFE_EVS_SendEvent(CFE_SB_LEN_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
+                          (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                          (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView),
+                          (unsigned int)CFE_MSG_HeaderView_GetSize(&HdrView),
+                          (unsigned int)EntryPtr->ExpectedLength);
+        ++CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter;
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, SUB_RPT_CTRL_MID))
+    else if (Status == CFE_STATUS_BAD_COMMAND_CODE)
     {
-        /* Internal subscription sync request */
-        CFE_SB_ProcessSubReportCmd(SBBufPtr);
+        CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid Cmd, Unexpected Command Code %u",
+                          (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView));
+        CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
     }
     else
     {
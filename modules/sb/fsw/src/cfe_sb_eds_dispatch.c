@@ -36,6 +36,7 @@ const EdsDispatchTable_EdsComponent_CFE_SB_Application_CFE_SB_Telecommand_t CFE_
         .WriteMapInfoCmd_indication     = CFE_SB_WriteMapInfoCmd,
         .WritePipeInfoCmd_indication    = CFE_SB_WritePipeInfoCmd,
         .WriteRoutingInfoCmd_indication = CFE_SB_WriteRoutingInfoCmd,
+        .WriteLatencyInfoCmd_indication = CFE_SB_WriteLatencyInfoCmd,
         .SendSbStatsCmd_indication      = CFE_SB_SendStatsCmd
     },
     .SUB_RPT_CTRL =
@@ -59,9 +60,10 @@ const EdsDispatchTable_EdsComponent_CFE_SB_Application_CFE_SB_Telecommand_t CFE_
  *-----------------------------------------------------------------*/
 void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    int32             Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_FcnCode_t MsgFc;
+    int32                Status;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_MSG_FcnCode_t    MsgFc;
+    CFE_MSG_HeaderView_t HdrView;
 
     Status = EdsDispatch_EdsComponent_CFE_SB_Application_Telecommand(SBBufPtr, &CFE_SB_TC_DISPATCH_TABLE);
 
@@ -69,8 +71,9 @@ void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
     if (Status == CFE_STATUS_BAD_COMMAND_CODE || Status == CFE_STATUS_WRONG_MSG_LENGTH
         || Status == CFE_STATUS_UNKNOWN_MSG_ID)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
+        CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+        MsgId = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+        MsgFc = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
 
         CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
 
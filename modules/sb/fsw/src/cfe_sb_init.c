@@ -59,6 +59,9 @@ int32 CFE_SB_EarlyInit(void)
     /* Initialize the state of subscription reporting */
     CFE_SB_Global.SubscriptionReporting = CFE_SB_DISABLE;
 
+    /* A cleared route handle is never current */
+    CFE_SB_Global.RouteGeneration = 1;
+
     /* Initialize memory partition. */
     Stat = CFE_SB_InitBuffers();
     if (Stat != CFE_SUCCESS)
@@ -78,6 +81,16 @@ int32 CFE_SB_EarlyInit(void)
                  CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID),
                  sizeof(CFE_SB_Global.StatTlmMsg));
 
+    /* Initialize the SB Latency Pkt, and latency statistics if the PSP has a usable timebase */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID),
+                 sizeof(CFE_SB_Global.LatencyTlmMsg));
+
+    CFE_SB_Global.TimebaseTicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+    CFE_SB_Global.TimebaseLow32Rollover  = CFE_PSP_GetTimerLow32Rollover();
+    CFE_SB_Global.LatencyStatsEnabled =
+        (CFE_PLATFORM_SB_LATENCY_STATS_ENABLE && CFE_SB_Global.TimebaseTicksPerSecond != 0);
+
     return Stat;
 }
 
@@ -116,6 +129,10 @@ int32 CFE_SB_InitBuffers(void)
      */
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
+    CFE_SB_TrackingListReset(&CFE_SB_Global.SegmentReleaseList);
+
+    /* The buffer cache uses the same block sizes as the pool */
+    CFE_SB_BufCacheInit(MemPoolDefSize.NumElements, MemPoolDefSize.ElementPtr);
 
     return CFE_SUCCESS;
 }
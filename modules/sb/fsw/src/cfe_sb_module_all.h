@@ -47,4 +47,9 @@
 #include "cfe_sbr.h"
 #include "cfe_core_resourceid_basevalues.h"
 
+/*
+ * Additionally SB uses the lock profiler API for the shared data lock
+ */
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_SB_MODULE_ALL_H */
@@ -133,9 +133,16 @@ void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber)
 {
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
+    uint64         WaitStartTicks;
+
+    WaitStartTicks = CFE_ES_LockProfileWaitStart();
 
     OsStatus = OS_MutSemTake(CFE_SB_Global.SharedDataMutexId);
-    if (OsStatus != OS_SUCCESS)
+    if (OsStatus == OS_SUCCESS)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_SB_SHARED_DATA, FuncName, LineNumber, WaitStartTicks);
+    }
+    else
     {
         CFE_ES_GetAppID(&AppId);
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Func=%s,Line=%d\n",
@@ -155,8 +162,24 @@ void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber)
  *-----------------------------------------------------------------*/
 void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
 {
-    int32          OsStatus;
-    CFE_ES_AppId_t AppId;
+    int32               OsStatus;
+    CFE_ES_AppId_t      AppId;
+    CFE_SB_BufferLink_t ReleaseList;
+
+    /*
+     * Take over the buffers whose segments were released while locked, by putting
+     * the local head into the list and taking the global head out of it.  Their
+     * release functions are called after the lock is given.
+     */
+    CFE_SB_TrackingListReset(&ReleaseList);
+    if (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.SegmentReleaseList,
+                                  CFE_SB_TrackingListGetNext(&CFE_SB_Global.SegmentReleaseList)))
+    {
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.SegmentReleaseList, &ReleaseList);
+        CFE_SB_TrackingListRemove(&CFE_SB_Global.SegmentReleaseList);
+    }
+
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_SB_SHARED_DATA);
 
     OsStatus = OS_MutSemGive(CFE_SB_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
@@ -169,6 +192,11 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
                              FuncName,
                              (int)LineNumber);
     }
+
+    if (!CFE_SB_TrackingListIsEnd(&ReleaseList, CFE_SB_TrackingListGetNext(&ReleaseList)))
+    {
+        CFE_SB_ReleaseSegmentLists(&ReleaseList);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -196,6 +224,26 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeI
     return destptr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_DestinationD_t *CFE_SB_GetBufferDestPtr(const CFE_SB_BufferD_t *BufDscPtr, CFE_SB_PipeId_t PipeId)
+{
+    /*
+     * Route IDs are reused once a route is removed, so the route a queued
+     * buffer was sent on may now belong to a different message ID
+     */
+    if (!CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(BufDscPtr->DestRouteId), BufDscPtr->MsgId))
+    {
+        return NULL;
+    }
+
+    return CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, PipeId);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -239,6 +287,32 @@ CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId)
     return PipeDscPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeDescReleaseBuffers(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint32 i;
+
+    /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+
+    for (i = 0; i < PipeDscPtr->LastBatchCount; ++i)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBatch[i]);
+        PipeDscPtr->LastBatch[i] = NULL;
+    }
+
+    PipeDscPtr->LastBatchCount = 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -401,6 +475,12 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
     CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
+
+    /* Release the route once the last destination is gone, so the routing table entry can be reused */
+    if (CFE_SBR_GetDestListHeadPtr(RouteId) == NULL)
+    {
+        CFE_SB_RemoveRouteEntry(RouteId);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -409,41 +489,50 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
+void CFE_SB_SetRoutePresence(CFE_SB_MsgId_t MsgId, bool IsPresent)
 {
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
+    uint16 *CountPtr;
 
-    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
+    CountPtr = &CFE_SB_Global.RoutePresence[CFE_SB_MsgIdToValue(MsgId) % CFE_SB_ROUTE_PRESENCE_SIZE];
+
+    if (IsPresent)
     {
-        /* Clear destinations if this is the only node in the list */
-        CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
+        ++(*CountPtr);
     }
-    else if (NodeToRemove->Prev == NULL)
+    else if (*CountPtr > 0)
     {
-        /* First in the list, set the next node to list head */
-        NextNode       = NodeToRemove->Next;
-        NextNode->Prev = NULL;
-        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
+        --(*CountPtr);
     }
-    else if (NodeToRemove->Next == NULL)
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_IsRoutePresent(CFE_SB_MsgId_t MsgId)
+{
+    bool IsPresent;
+
+    /* Intentionally not locked, this is a single aligned read */
+    if (CFE_SB_Global.RoutePresence[CFE_SB_MsgIdToValue(MsgId) % CFE_SB_ROUTE_PRESENCE_SIZE] != 0)
     {
-        /* Last in the list, remove previous pointer */
-        PrevNode       = NodeToRemove->Prev;
-        PrevNode->Next = NULL;
+        return true;
     }
-    else
+
+    /* Also a single read, a mask subscription being added concurrently may not be seen */
+    if (CFE_SB_Global.MaskSubsInUse == 0)
     {
-        /* Middle of list, remove */
-        PrevNode       = NodeToRemove->Prev;
-        NextNode       = NodeToRemove->Next;
-        PrevNode->Next = NextNode;
-        NextNode->Prev = PrevNode;
+        return false;
     }
 
-    /* initialize the node before returning it to the heap */
-    NodeToRemove->Next = NULL;
-    NodeToRemove->Prev = NULL;
+    /* A matching mask subscription adds the route on lookup, the table is walked under the lock */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    IsPresent = (CFE_SB_FindMaskSub(CFE_SB_INVALID_PIPE, MsgId) != NULL);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return IsPresent;
 }
 
 /*----------------------------------------------------------------
@@ -452,44 +541,79 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
+CFE_SBR_RouteId_t CFE_SB_AddRouteEntry(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 {
-    CFE_SB_BufferLink_t *NextLink;
-    CFE_SB_BufferD_t    *DscPtr;
+    CFE_SBR_RouteId_t RouteId;
 
-    /*
-     * First go through the "ZeroCopy" tracking list and find all nodes
-     * with a matching AppID.  This needs to be done while locked to
-     * prevent other tasks from changing the list at the same time.
-     */
-    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    RouteId = CFE_SBR_AddRoute(MsgId, CollisionsPtr);
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        CFE_SB_LockSharedData(__func__, __LINE__);
+        ++CFE_SB_Global.RouteGeneration;
 
-        /* Get start of list */
-        NextLink = CFE_SB_TrackingListGetNext(&CFE_SB_Global.ZeroCopyList);
-        while (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.ZeroCopyList, NextLink))
+        /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
+        /* adjust the high water mark */
+        CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
+        if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
         {
-            /* Get buffer descriptor pointer */
-            /* NOTE: casting via void* here rather than CFE_SB_BufferD_t* avoids a false
-             * alignment warning on platforms with strict alignment requirements */
-            DscPtr = (void *)NextLink;
+            CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
+        }
 
-            /* Read the next link now in case this node gets moved */
-            NextLink = CFE_SB_TrackingListGetNext(NextLink);
+        CFE_SB_SetRoutePresence(MsgId, true);
 
-            /* Check if it is a zero-copy buffer owned by this app */
-            if (CFE_RESOURCEID_TEST_EQUAL(DscPtr->AppId, AppId))
+        /* Route IDs are reused, do not carry over the latency of a previous message ID */
+        memset(&CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)], 0, sizeof(CFE_SB_Global.RouteLatency[0]));
+    }
+
+    return RouteId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RemoveRouteEntry(CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SB_SetRoutePresence(CFE_SBR_GetMsgId(RouteId), false);
+    CFE_SBR_RemoveRoute(RouteId);
+    CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse--;
+    ++CFE_SB_Global.RouteGeneration;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SB_LookupRoute(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_RouteId_t RouteId;
+
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+
+    /* On a miss, turn matching mask subscriptions into a route so the next lookup finds it directly */
+    if (!CFE_SBR_IsValidRouteId(RouteId) && CFE_SB_Global.MaskSubsInUse != 0
+        && CFE_SB_FindMaskSub(CFE_SB_INVALID_PIPE, MsgId) != NULL)
+    {
+        RouteId = CFE_SB_AddRouteEntry(MsgId, NULL);
+
+        if (CFE_SBR_IsValidRouteId(RouteId))
+        {
+            CFE_SB_ApplyMaskSubs(RouteId);
+
+            /* Do not keep the route if no destination could be added */
+            if (CFE_SBR_GetDestListHeadPtr(RouteId) == NULL)
             {
-                /* If so, decrement the use count as the app has now gone away */
-                CFE_SB_DecrBufUseCnt(DscPtr);
+                CFE_SB_RemoveRouteEntry(RouteId);
+                RouteId = CFE_SBR_INVALID_ROUTE_ID;
             }
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
-    return CFE_SUCCESS;
+    return RouteId;
 }
 
 /*----------------------------------------------------------------
@@ -498,34 +622,32 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+void CFE_SB_SetRouteHandle(CFE_SB_RouteHandle_t *HandlePtr, CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
 {
-    cpuaddr BufDscAddr;
-
-    /*
-     * Calculate descriptor pointer from buffer pointer -
-     * The buffer is just a member (offset) in the descriptor
-     */
-    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
-    *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
+    HandlePtr->MsgId      = MsgId;
+    HandlePtr->Generation = CFE_SB_Global.RouteGeneration;
 
-    /*
-     * Check that the descriptor is actually a "zero copy" type,
-     */
-    if (!CFE_RESOURCEID_TEST_DEFINED((*BufDscPtr)->AppId))
+    if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        return CFE_SB_BUFFER_INVALID;
+        HandlePtr->RouteIdValue = CFE_SBR_RouteIdToValue(RouteId);
+    }
+    else
+    {
+        /* Converts back to an invalid route ID */
+        HandlePtr->RouteIdValue = CFE_PLATFORM_SB_MAX_MSG_IDS;
     }
-
-    /* Basic sanity check passed */
-    return CFE_SUCCESS;
 }
 
-/******************************************************************
+/*----------------------------------------------------------------
  *
- * MESSAGE TRANSACTION IMPLEMENTATION FUNCTIONS
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
- ******************************************************************/
+ *-----------------------------------------------------------------*/
+bool CFE_SB_MaskSubMatches(const CFE_SB_MaskSub_t *MaskSubPtr, CFE_SB_MsgId_t MsgId)
+{
+    return ((CFE_SB_MsgIdToValue(MsgId) & MaskSubPtr->Mask) == MaskSubPtr->MsgIdValue);
+}
 
 /*----------------------------------------------------------------
  *
@@ -533,264 +655,1683 @@ int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_Init(CFE_SB_MessageTxn_State_t *TxnPtr,
-                            CFE_SB_PipeSetEntry_t     *PipeSet,
-                            uint16                     MaxPipes,
-                            const void                *RefMemPtr)
+CFE_SB_MaskSub_t *CFE_SB_FindMaskSub(CFE_SB_PipeId_t PipeId, CFE_SB_MsgId_t MsgId)
 {
-    memset(TxnPtr, 0, offsetof(CFE_SB_TransmitTxn_State_t, DestSet));
-    TxnPtr->PipeSet  = PipeSet;
-    TxnPtr->MaxPipes = MaxPipes;
+    CFE_SB_MaskSub_t *MaskSubPtr;
+    uint32            Idx;
 
-    /* The reference pointer is kept just for (potential) reporting in events, etc.
-     * It is not dereferenced from here. */
-    TxnPtr->RefMemPtr = RefMemPtr;
+    MaskSubPtr = CFE_SB_Global.MaskSub;
+    for (Idx = 0; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(MaskSubPtr->PipeId)
+            && (!CFE_RESOURCEID_TEST_DEFINED(PipeId) || CFE_RESOURCEID_TEST_EQUAL(MaskSubPtr->PipeId, PipeId))
+            && CFE_SB_MaskSubMatches(MaskSubPtr, MsgId))
+        {
+            return MaskSubPtr;
+        }
+
+        ++MaskSubPtr;
+    }
+
+    return NULL;
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeout)
+bool CFE_SB_AddMaskDest(CFE_SBR_RouteId_t RouteId, const CFE_SB_MaskSub_t *MaskSubPtr)
 {
-    TxnPtr->UserTimeoutParam = Timeout;
-    if (Timeout > 0)
+    CFE_SB_DestinationD_t *DestPtr;
+    uint32                 DestCount;
+
+    DestCount = 0;
+    for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
     {
-        /* Convert to an absolute timeout */
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_TIMED;
-        CFE_PSP_GetTime(&TxnPtr->AbsTimeout);
-        TxnPtr->AbsTimeout = OS_TimeAdd(TxnPtr->AbsTimeout, OS_TimeFromTotalMilliseconds(Timeout));
+        /* Already subscribed, by another mask or explicitly */
+        if (CFE_RESOURCEID_TEST_EQUAL(DestPtr->PipeId, MaskSubPtr->PipeId))
+        {
+            return false;
+        }
+
+        ++DestCount;
     }
-    else if (Timeout == CFE_SB_POLL)
+
+    if (DestCount >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
     {
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_POLL;
+        CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        return false;
     }
-    else if (Timeout == CFE_SB_PEND_FOREVER)
+
+    DestPtr = CFE_SB_GetDestinationBlk();
+    if (DestPtr == NULL)
     {
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_PEND;
+        CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+        return false;
     }
-    else
+
+    /* Mask subscriptions are never reported to other instances, so the scope is local */
+    DestPtr->PipeId        = MaskSubPtr->PipeId;
+    DestPtr->MsgId2PipeLim = MaskSubPtr->MsgLim;
+    DestPtr->Active        = CFE_SB_ACTIVE;
+    DestPtr->BuffCount     = 0;
+    DestPtr->DestCnt       = 0;
+    DestPtr->Scope         = CFE_SB_MSG_LOCAL;
+    DestPtr->Priority      = MaskSubPtr->Priority;
+    DestPtr->MaskSub       = true;
+    DestPtr->Prev          = NULL;
+    DestPtr->Next          = NULL;
+
+    CFE_SB_AddDestNode(RouteId, DestPtr);
+
+    CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
+    if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse)
     {
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse = CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse;
     }
+
+    return true;
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_GetEventDetails(const CFE_SB_MessageTxn_State_t *TxnPtr,
-                                       const CFE_SB_PipeSetEntry_t     *ContextPtr,
-                                       uint16                           EventId,
-                                       CFE_ES_TaskId_t                  TskId,
-                                       char                            *EvtMsg,
-                                       size_t                           EvtMsgSize,
-                                       CFE_EVS_EventType_Enum_t        *EventType,
-                                       int32                           *ReqBit)
+void CFE_SB_ApplyMaskSubs(CFE_SBR_RouteId_t RouteId)
 {
-    char  FullName[(OS_MAX_API_NAME * 2)];
-    char  PipeName[OS_MAX_API_NAME];
-    int32 LocalOsStatus;
+    CFE_SB_MsgId_t    MsgId;
+    CFE_SB_MaskSub_t *MaskSubPtr;
+    uint32            Idx;
 
-    if (ContextPtr == NULL)
-    {
-        LocalOsStatus = INT32_MIN; /* should not be used; do not alias any actual OS status */
-        snprintf(PipeName, sizeof(PipeName), "[n/a]");
-    }
-    else
+    MsgId = CFE_SBR_GetMsgId(RouteId);
+
+    MaskSubPtr = CFE_SB_Global.MaskSub;
+    for (Idx = 0; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
     {
-        LocalOsStatus = ContextPtr->OsStatus;
-        if (ContextPtr->PendingEventId == CFE_SB_BAD_PIPEID_EID)
-        {
-            /* do not attempt to map to a pipe name if reporting a bad pipeID event - use its ID */
-            snprintf(PipeName, sizeof(PipeName), "%lu", CFE_RESOURCEID_TO_ULONG(ContextPtr->PipeId));
-        }
-        else
+        if (CFE_RESOURCEID_TEST_DEFINED(MaskSubPtr->PipeId) && CFE_SB_MaskSubMatches(MaskSubPtr, MsgId))
         {
-            CFE_SB_GetPipeNamePriv(ContextPtr->PipeId, PipeName, sizeof(PipeName));
+            CFE_SB_AddMaskDest(RouteId, MaskSubPtr);
         }
-    }
 
-    switch (EventId)
-    {
-        case CFE_SB_SEND_BAD_ARG_EID:
-            *ReqBit    = CFE_SB_SEND_BAD_ARG_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+        ++MaskSubPtr;
+    }
+}
 
-            snprintf(EvtMsg,
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 CFE_SB_GetTimebaseTicks(void)
+{
+    return CFE_ES_GetTimebaseTicks(CFE_SB_Global.TimebaseLow32Rollover);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_LatencyHistogram_Add(CFE_SB_LatencyHistogram_t *HistPtr, uint32 Latency)
+{
+    uint32 BinIdx;
+    uint32 Remaining;
+
+    /* The bin is the number of significant bits, so bin N holds [2^(N-1), 2^N) */
+    BinIdx    = 0;
+    Remaining = Latency;
+    while (Remaining != 0 && BinIdx < (CFE_MISSION_SB_LATENCY_HIST_BINS - 1))
+    {
+        Remaining >>= 1;
+        ++BinIdx;
+    }
+
+    ++HistPtr->Bin[BinIdx];
+    ++HistPtr->MsgCount;
+
+    if (Latency > HistPtr->MaxLatency)
+    {
+        HistPtr->MaxLatency = Latency;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RecordLatency(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr, uint64 NowTicks)
+{
+    uint32 Latency;
+
+    if (CFE_SB_Global.TimebaseTicksPerSecond == 0)
+    {
+        return;
+    }
+
+    Latency = CFE_ES_TimebaseElapsedUsec(BufDscPtr->TransmitTicks, NowTicks, CFE_SB_Global.TimebaseTicksPerSecond);
+
+    CFE_SB_LatencyHistogram_Add(&PipeDscPtr->Latency, Latency);
+
+    /* Same as CFE_SB_GetBufferDestPtr(), the route may have been reused for another message ID */
+    if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId) &&
+        CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(BufDscPtr->DestRouteId), BufDscPtr->MsgId))
+    {
+        CFE_SB_LatencyHistogram_Add(&CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(BufDscPtr->DestRouteId)],
+                                    Latency);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
+{
+    CFE_SB_DestinationD_t *PrevNode;
+    CFE_SB_DestinationD_t *NextNode;
+
+    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
+    {
+        /* Clear destinations if this is the only node in the list */
+        CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
+    }
+    else if (NodeToRemove->Prev == NULL)
+    {
+        /* First in the list, set the next node to list head */
+        NextNode       = NodeToRemove->Next;
+        NextNode->Prev = NULL;
+        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
+    }
+    else if (NodeToRemove->Next == NULL)
+    {
+        /* Last in the list, remove previous pointer */
+        PrevNode       = NodeToRemove->Prev;
+        PrevNode->Next = NULL;
+    }
+    else
+    {
+        /* Middle of list, remove */
+        PrevNode       = NodeToRemove->Prev;
+        NextNode       = NodeToRemove->Next;
+        PrevNode->Next = NextNode;
+        NextNode->Prev = PrevNode;
+    }
+
+    /* initialize the node before returning it to the heap */
+    NodeToRemove->Next = NULL;
+    NodeToRemove->Prev = NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
+{
+    CFE_SB_BufferLink_t *NextLink;
+    CFE_SB_BufferD_t    *DscPtr;
+
+    /*
+     * First go through the "ZeroCopy" tracking list and find all nodes
+     * with a matching AppID.  This needs to be done while locked to
+     * prevent other tasks from changing the list at the same time.
+     */
+    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /* Get start of list */
+        NextLink = CFE_SB_TrackingListGetNext(&CFE_SB_Global.ZeroCopyList);
+        while (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.ZeroCopyList, NextLink))
+        {
+            /* Get buffer descriptor pointer */
+            /* NOTE: casting via void* here rather than CFE_SB_BufferD_t* avoids a false
+             * alignment warning on platforms with strict alignment requirements */
+            DscPtr = (void *)NextLink;
+
+            /* Read the next link now in case this node gets moved */
+            NextLink = CFE_SB_TrackingListGetNext(NextLink);
+
+            /* Check if it is a zero-copy buffer owned by this app */
+            if (CFE_RESOURCEID_TEST_EQUAL(DscPtr->AppId, AppId))
+            {
+                /* If so, decrement the use count as the app has now gone away */
+                CFE_SB_DecrBufUseCnt(DscPtr);
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+{
+    cpuaddr BufDscAddr;
+
+    /*
+     * Calculate descriptor pointer from buffer pointer -
+     * The buffer is just a member (offset) in the descriptor
+     */
+    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
+    *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
+
+    /*
+     * Check that the descriptor is actually a "zero copy" type,
+     */
+    if (!CFE_RESOURCEID_TEST_DEFINED((*BufDscPtr)->AppId))
+    {
+        return CFE_SB_BUFFER_INVALID;
+    }
+
+    /* Basic sanity check passed */
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ReceivedBufferValidate(const CFE_SB_Buffer_t *BufPtr, const CFE_SB_BufferD_t **BufDscPtr)
+{
+    cpuaddr BufDscAddr;
+
+    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
+
+    /*
+     * The pool checks the block without reading outside of the pool memory,
+     * so this is done before anything in the descriptor is read
+     */
+    if (CFE_ES_GetPoolBufInfo(CFE_SB_Global.Mem.PoolHdl, CFE_ES_MEMPOOLBUF_C(BufDscAddr)) < 0)
+    {
+        return CFE_SB_BUFFER_INVALID;
+    }
+
+    *BufDscPtr = (const CFE_SB_BufferD_t *)BufDscAddr;
+
+    /* Buffers that were released may still be allocated from the pool, see CFE_SB_ReturnBufferToPool() */
+    if ((*BufDscPtr)->UseCount == 0)
+    {
+        return CFE_SB_BUFFER_INVALID;
+    }
+
+    /* Basic sanity check passed */
+    return CFE_SUCCESS;
+}
+
+/******************************************************************
+ *
+ * MESSAGE TRANSACTION IMPLEMENTATION FUNCTIONS
+ *
+ ******************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_Init(CFE_SB_MessageTxn_State_t *TxnPtr,
+                            CFE_SB_PipeSetEntry_t     *PipeSet,
+                            uint16                     MaxPipes,
+                            const void                *RefMemPtr)
+{
+    memset(TxnPtr, 0, offsetof(CFE_SB_TransmitTxn_State_t, DestSet));
+    TxnPtr->PipeSet  = PipeSet;
+    TxnPtr->MaxPipes = MaxPipes;
+
+    /* The reference pointer is kept just for (potential) reporting in events, etc.
+     * It is not dereferenced from here. */
+    TxnPtr->RefMemPtr = RefMemPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeout)
+{
+    TxnPtr->UserTimeoutParam = Timeout;
+    if (Timeout > 0)
+    {
+        /* Convert to an absolute timeout */
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_TIMED;
+        CFE_PSP_GetTime(&TxnPtr->AbsTimeout);
+        TxnPtr->AbsTimeout = OS_TimeAdd(TxnPtr->AbsTimeout, OS_TimeFromTotalMilliseconds(Timeout));
+    }
+    else if (Timeout == CFE_SB_POLL)
+    {
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_POLL;
+    }
+    else if (Timeout == CFE_SB_PEND_FOREVER)
+    {
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_PEND;
+    }
+    else
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_GetEventDetails(const CFE_SB_MessageTxn_State_t *TxnPtr,
+                                       const CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                       uint16                           EventId,
+                                       CFE_ES_TaskId_t                  TskId,
+                                       char                            *EvtMsg,
+                                       size_t                           EvtMsgSize,
+                                       CFE_EVS_EventType_Enum_t        *EventType,
+                                       int32                           *ReqBit)
+{
+    char  FullName[(OS_MAX_API_NAME * 2)];
+    char  PipeName[OS_MAX_API_NAME];
+    int32 LocalOsStatus;
+
+    if (ContextPtr == NULL)
+    {
+        LocalOsStatus = INT32_MIN; /* should not be used; do not alias any actual OS status */
+        snprintf(PipeName, sizeof(PipeName), "[n/a]");
+    }
+    else
+    {
+        LocalOsStatus = ContextPtr->OsStatus;
+        if (ContextPtr->PendingEventId == CFE_SB_BAD_PIPEID_EID)
+        {
+            /* do not attempt to map to a pipe name if reporting a bad pipeID event - use its ID */
+            snprintf(PipeName, sizeof(PipeName), "%lu", CFE_RESOURCEID_TO_ULONG(ContextPtr->PipeId));
+        }
+        else
+        {
+            CFE_SB_GetPipeNamePriv(ContextPtr->PipeId, PipeName, sizeof(PipeName));
+        }
+    }
+
+    switch (EventId)
+    {
+        case CFE_SB_SEND_BAD_ARG_EID:
+            *ReqBit    = CFE_SB_SEND_BAD_ARG_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
                      EvtMsgSize,
                      "Send Err:Bad input argument,Arg 0x%lx,App %s",
                      (unsigned long)TxnPtr->RefMemPtr,
                      CFE_SB_GetAppTskName(TskId, FullName));
             break;
 
-        case CFE_SB_SEND_INV_MSGID_EID:
-            *ReqBit    = CFE_SB_SEND_INV_MSGID_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+        case CFE_SB_SEND_INV_MSGID_EID:
+            *ReqBit    = CFE_SB_SEND_INV_MSGID_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Send Err:Invalid MsgId(0x%x)in msg,App %s",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_MSG_TOO_BIG_EID:
+            *ReqBit    = CFE_SB_MSG_TOO_BIG_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     CFE_SB_GetAppTskName(TskId, FullName),
+                     (int)TxnPtr->ContentSize,
+                     CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+            break;
+
+        case CFE_SB_SEND_NO_SUBS_EID:
+            *ReqBit    = CFE_SB_SEND_NO_SUBS_EID_BIT;
+            *EventType = CFE_EVS_EventType_INFORMATION;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "No subscribers for MsgId 0x%x,sender %s",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_GET_BUF_ERR_EID:
+            *ReqBit    = CFE_SB_GET_BUF_ERR_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     CFE_SB_GetAppTskName(TskId, FullName),
+                     (int)TxnPtr->ContentSize);
+            break;
+
+        case CFE_SB_MSGID_LIM_ERR_EID:
+            *ReqBit    = CFE_SB_MSGID_LIM_ERR_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_Q_FULL_ERR_EID:
+            *ReqBit    = CFE_SB_Q_FULL_ERR_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_Q_WR_ERR_EID:
+            *ReqBit    = CFE_SB_Q_WR_ERR_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
+                     PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName),
+                     (long)LocalOsStatus);
+            break;
+
+        case CFE_SB_Q_RD_ERR_EID:
+            *ReqBit    = -1;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Pipe Read Err,pipe %s,app %s,stat %ld",
+                     PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName),
+                     (long)LocalOsStatus);
+            break;
+        case CFE_SB_RCV_BAD_ARG_EID:
+            *ReqBit    = -1;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %s,t/o %d,app %s",
+                     (unsigned long)TxnPtr->RefMemPtr,
+                     PipeName,
+                     (int)TxnPtr->UserTimeoutParam,
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+        case CFE_SB_BAD_PIPEID_EID:
+            *ReqBit    = -1;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg,
+                     EvtMsgSize,
+                     "Rcv Err:PipeId %s does not exist,app %s",
+                     PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        default:
+            EvtMsg[0]  = 0;
+            *ReqBit    = 0;
+            *EventType = 0;
+            break;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_MessageTxn_ReportSingleEvent(const CFE_SB_MessageTxn_State_t *TxnPtr,
+                                         const CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                         uint16                           EventId)
+{
+    CFE_ES_TaskId_t          TskId;
+    CFE_EVS_EventType_Enum_t EventType;
+    char                     Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    int32                    ReqBit;
+
+    /* get task id for events and Sender Info*/
+    CFE_ES_GetTaskID(&TskId);
+
+    CFE_SB_MessageTxn_GetEventDetails(TxnPtr,
+                                      ContextPtr,
+                                      EventId,
+                                      TskId,
+                                      Message,
+                                      sizeof(Message),
+                                      &EventType,
+                                      &ReqBit);
+
+    if (EventType > 0 && CFE_SB_RequestToSendEvent(TskId, ReqBit) == CFE_SB_GRANTED)
+    {
+        CFE_EVS_SendEventWithAppID(EventId, EventType, CFE_SB_Global.AppId, "%s", Message);
+
+        /* clear the bit so the task may send this event again */
+        CFE_SB_FinishSendEvent(TskId, ReqBit);
+    }
+
+    /* If the event type was an error, this should increment the general error counter */
+    return (EventType >= CFE_EVS_EventType_ERROR);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_ReportEvents(const CFE_SB_MessageTxn_State_t *TxnPtr)
+{
+    uint32 i;
+    uint32 NumErrors;
+    bool   IsError;
+
+    NumErrors = 0;
+
+    if (TxnPtr->TransactionEventId != 0)
+    {
+        IsError = CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, NULL, TxnPtr->TransactionEventId);
+        if (IsError)
+        {
+            ++NumErrors;
+        }
+    }
+
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        if (TxnPtr->PipeSet[i].PendingEventId != 0)
+        {
+            IsError =
+                CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, &TxnPtr->PipeSet[i], TxnPtr->PipeSet[i].PendingEventId);
+            if (IsError)
+            {
+                ++NumErrors;
+            }
+        }
+    }
+
+    if (NumErrors > 0)
+    {
+        /*
+         * Increment the error only if there was a real error,
+         * such as a validation issue or failure to allocate a buffer.
+         *
+         * Note that transmit side just has one error counter, whereas
+         * receive side has two - these differeniate between a bad passed-in
+         * arg vs some other internal error such as queue access.
+         */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        if (TxnPtr->IsTransmit)
+        {
+            CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        }
+        else if (TxnPtr->Status == CFE_SB_BAD_ARGUMENT)
+        {
+            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+        }
+        else
+        {
+            /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
+            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetEventAndStatus(CFE_SB_MessageTxn_State_t *TxnPtr, uint16 EventId, CFE_Status_t Status)
+{
+    if (TxnPtr->TransactionEventId == 0)
+    {
+        TxnPtr->TransactionEventId = EventId;
+    }
+    if (TxnPtr->Status == CFE_SUCCESS)
+    {
+        TxnPtr->Status = Status;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetRoutingMsgId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_MsgId_t RoutingMsgId)
+{
+    /* validate the msgid in the message */
+    if (!CFE_SB_IsValidMsgId(RoutingMsgId))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_INV_MSGID_EID, CFE_SB_BAD_ARGUMENT);
+    }
+    else
+    {
+        TxnPtr->RoutingMsgId = RoutingMsgId;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetContentSize(CFE_SB_MessageTxn_State_t *TxnPtr, size_t ContentSize)
+{
+    if (ContentSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_MSG_TOO_BIG_EID, CFE_SB_MSG_TOO_BIG);
+    }
+    else
+    {
+        TxnPtr->ContentSize = ContentSize;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_Status_t         Status;
+    CFE_MSG_HeaderView_t HdrView;
+
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        /* In this context, the user should have set the the size and MsgId in the content */
+        Status = CFE_MSG_DecodeHeader(MsgPtr, &HdrView);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_SB_MessageTxn_SetRoutingMsgId(TxnPtr, CFE_MSG_HeaderView_GetMsgId(&HdrView));
+        }
+        else
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_BAD_ARG_EID, Status);
+        }
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        CFE_SB_MessageTxn_SetContentSize(TxnPtr, CFE_MSG_HeaderView_GetSize(&HdrView));
+    }
+}
+
+/******************************************************************
+ *
+ * TRANSMIT TRANSACTION IMPLEMENTATION FUNCTIONS
+ *
+ ******************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MessageTxn_State_t *CFE_SB_TransmitTxn_Init(CFE_SB_TransmitTxn_State_t *TxnPtr, const void *RefMemPtr)
+{
+    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, TxnPtr->DestSet, CFE_PLATFORM_SB_MAX_DEST_PER_PKT, RefMemPtr);
+    TxnPtr->MessageTxn_State.IsTransmit = true;
+
+    /* No matter what, the mem pointer from the caller should not be NULL */
+    if (RefMemPtr == NULL)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    return &TxnPtr->MessageTxn_State;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_SetNoSubscribers(CFE_SB_MessageTxn_State_t *TxnPtr)
+{
+    /* if there have been no subscriptions for this pkt, */
+    /* increment the dropped pkt cnt, send event and return success */
+    CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+    CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_NO_SUBS_EID, CFE_SUCCESS);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ResolveRoute(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                     CFE_SB_BufferD_t          *BufDscPtr,
+                                     CFE_ES_AppId_t             AppId)
+{
+    CFE_SB_PipeD_t         *PipeDscPtr;
+    CFE_SB_DestinationD_t  *DestPtr;
+    CFE_SB_PipeSetEntry_t  *ContextPtr;
+    CFE_SB_PipeLaneStats_t *LanePtr;
+
+    /* Get the routing id, the route handle of the caller can be used if nothing changed since it was resolved */
+    if (TxnPtr->RouteHandlePtr != NULL && TxnPtr->RouteHandlePtr->Generation == CFE_SB_Global.RouteGeneration
+        && CFE_SB_MsgId_Equal(TxnPtr->RouteHandlePtr->MsgId, TxnPtr->RoutingMsgId))
+    {
+        BufDscPtr->DestRouteId = CFE_SBR_ValueToRouteId(TxnPtr->RouteHandlePtr->RouteIdValue);
+    }
+    else
+    {
+        BufDscPtr->DestRouteId = CFE_SB_LookupRoute(TxnPtr->RoutingMsgId);
+
+        if (TxnPtr->RouteHandlePtr != NULL)
+        {
+            CFE_SB_SetRouteHandle(TxnPtr->RouteHandlePtr, TxnPtr->RoutingMsgId, BufDscPtr->DestRouteId);
+        }
+    }
+
+    /* For an invalid route / no subscribers this whole logic can be skipped */
+    if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
+    {
+        /*
+         * If this is the origination, then take the next sequence count of the route (while locked).
+         * It is written into the message content by CFE_SB_TransmitTxn_Originate(), the buffer is
+         * not visible to any other task until it is written to the pipes.
+         */
+        if (TxnPtr->IsEndpoint)
+        {
+            CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId);
+            TxnPtr->SequenceCount = CFE_SBR_GetSequenceCounter(BufDscPtr->DestRouteId);
+        }
+
+        /* Stamp the buffer so the time spent in the pipes can be found when it is received */
+        if (CFE_SB_Global.LatencyStatsEnabled)
+        {
+            BufDscPtr->TransmitTicks = CFE_SB_GetTimebaseTicks();
+        }
+
+        /* Send the packet to all destinations  */
+        DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
+        while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
+        {
+            ContextPtr = NULL;
+
+            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
+            {
+                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+            }
+            else
+            {
+                PipeDscPtr = NULL;
+            }
+
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+            {
+                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) == 0
+                    || !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+                {
+                    ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
+                    ++TxnPtr->NumPipes;
+                }
+            }
+
+            if (ContextPtr != NULL)
+            {
+                memset(ContextPtr, 0, sizeof(*ContextPtr));
+
+                ContextPtr->PipeId = DestPtr->PipeId;
+
+                /* A high priority subscription uses the normal lane if the lane could not be created */
+                if (DestPtr->Priority != CFE_SB_QosPriority_LOW && OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId))
+                {
+                    ContextPtr->SysQueueId = PipeDscPtr->PriorityQueueId;
+                    ContextPtr->Lane       = CFE_SB_QosPriority_HIGH;
+                }
+                else
+                {
+                    ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
+                    ContextPtr->Lane       = CFE_SB_QosPriority_LOW;
+                }
+
+                /* if Msg limit exceeded, log event, increment counter */
+                /* and go to next destination */
+                if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+                {
+                    ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
+                    ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
+                    ++PipeDscPtr->SendErrors;
+                    ++TxnPtr->NumPipeErrs;
+                }
+                else
+                {
+                    CFE_SB_IncrBufUseCnt(BufDscPtr);
+                    ++DestPtr->BuffCount;
+
+                    ++PipeDscPtr->CurrentQueueDepth;
+                    if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
+                    {
+                        PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
+                    }
+
+                    LanePtr = &PipeDscPtr->Lane[ContextPtr->Lane];
+                    ++LanePtr->CurrentQueueDepth;
+                    if (LanePtr->CurrentQueueDepth > LanePtr->PeakQueueDepth)
+                    {
+                        LanePtr->PeakQueueDepth = LanePtr->CurrentQueueDepth;
+                    }
+
+                    /* The message is passed on to another cFE instance, see CFE_SB_SetPipeTransport() */
+                    ContextPtr->TransportFunc = PipeDscPtr->TransportFunc;
+                    ContextPtr->TransportArg  = PipeDscPtr->TransportArg;
+
+                    /* Segments are only passed on to local pipes that asked for them */
+                    if (BufDscPtr->SegmentList != NULL
+                        && ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_SEGMENTS) == 0 || ContextPtr->TransportFunc != NULL))
+                    {
+                        ContextPtr->UseContiguous = true;
+                    }
+
+                    /* First message since the owner found the pipe empty, see CFE_SB_PipeReady_Arm() */
+                    if (PipeDscPtr->ReadyArmed)
+                    {
+                        PipeDscPtr->ReadyArmed   = false;
+                        ContextPtr->ReadyHandler = PipeDscPtr->ReadyHandler;
+                        ContextPtr->ReadyArg     = PipeDscPtr->ReadyArg;
+                    }
+                }
+            }
+
+            DestPtr = DestPtr->Next;
+        }
+    }
+    else
+    {
+        CFE_SB_TransmitTxn_SetNoSubscribers(TxnPtr);
+    }
+
+    /*
+     * Remove this from whatever list it was in
+     *
+     * If it was a singleton/new buffer this has no effect.
+     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
+     */
+    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+
+    /* clear the AppID field in case it was a zero copy buffer,
+     * as it is no longer owned by that app after broadcasting */
+    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+    /* track the buffer as an in-transit message */
+    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_Originate(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    bool         IsAcceptable;
+    CFE_Status_t Status;
+
+    /*
+     * If this is the origination point, now that all headers should
+     * have known values (including sequence) - invoke the mission-specific
+     * message origination action.  This may update timestamps and/or compute
+     * any required error control fields.
+     */
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr) && TxnPtr->IsEndpoint)
+    {
+        /* Set the sequence count from the route */
+        CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, TxnPtr->SequenceCount);
+
+        /* Update any other system-specific MSG headers based on the current sequence */
+        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+        if (Status != CFE_SUCCESS || !IsAcceptable)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_MESSAGE_INTEGRITY_FAIL_EID, Status);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_ES_AppId_t AppId;
+
+    /*
+     * get app id for loopback testing  -
+     * This is only used if one or more of the destinations has its "IGNOREMINE" option set,
+     * but it should NOT be gotten while locked.  So since we do not know (yet) if we need it,
+     * it is better to get it and not need it than need it and not have it.
+     */
+    CFE_ES_GetAppID(&AppId);
+
+    /* take semaphore to prevent a task switch during processing */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    CFE_SB_TransmitTxn_ResolveRoute(TxnPtr, BufDscPtr, AppId);
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Lastly, apply any origination actions (outside the lock) */
+    CFE_SB_TransmitTxn_Originate(TxnPtr, BufDscPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_MessageTxn_GetOsTimeout(const CFE_SB_MessageTxn_State_t *TxnPtr)
+{
+    int32     OsTimeout;
+    OS_time_t TimeNow;
+
+    switch (TxnPtr->TimeoutMode)
+    {
+        case CFE_SB_MessageTxn_TimeoutMode_PEND:
+            OsTimeout = OS_PEND;
+            break;
+        case CFE_SB_MessageTxn_TimeoutMode_TIMED:
+            CFE_PSP_GetTime(&TimeNow);
+            OsTimeout = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(TxnPtr->AbsTimeout, TimeNow));
+            if (OsTimeout < 0)
+            {
+                /* timeout has already expired, so all remaining pipes should be CHECK only */
+                OsTimeout = OS_CHECK;
+            }
+            break;
+        case CFE_SB_MessageTxn_TimeoutMode_POLL:
+        default:
+            OsTimeout = OS_CHECK;
+            break;
+    }
+
+    return OsTimeout;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
+{
+    CFE_SB_DestinationD_t  *DestPtr;
+    CFE_SB_PipeD_t         *PipeDscPtr;
+    CFE_SB_PipeLaneStats_t *LanePtr;
+    CFE_SB_BufferD_t       *BufDscPtr;
+
+    BufDscPtr = Arg;
+
+    /* The buffer references of these pipes were moved to the copy, see CFE_SB_TransmitTxn_MakeContiguous() */
+    if (ContextPtr->UseContiguous && TxnPtr->ContiguousBufDscPtr != NULL)
+    {
+        BufDscPtr = TxnPtr->ContiguousBufDscPtr;
+    }
+
+    /*
+     * Write the buffer descriptor to the queue of the pipe, or pass the message
+     * to the transport of the pipe.  Note that accounting for depth and buffer
+     * limits was already done as part of "FindDestinations" assuming this write
+     * will be successful - which is the expected/typical result here.
+     */
+    if (ContextPtr->UseContiguous && TxnPtr->ContiguousBufDscPtr == NULL)
+    {
+        /* The copy could not be allocated, the error is counted below */
+        ContextPtr->OsStatus = OS_ERROR;
+    }
+    else if (ContextPtr->TransportFunc != NULL)
+    {
+        ContextPtr->OsStatus = ContextPtr->TransportFunc(
+            ContextPtr->PipeId, &BufDscPtr->Content, BufDscPtr->ContentSize, ContextPtr->TransportArg);
+    }
+    else
+    {
+        ContextPtr->OsStatus = OS_QueuePut(
+            ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    }
+
+    /*
+     * If it was queued, only need to wake any task waiting for this pipe in
+     * CFE_SB_ReceiveBufferAny().  But if it failed, or the transport already
+     * took the message, then we must undo the optimistic depth accounting done earlier.
+     */
+    if (ContextPtr->OsStatus == OS_SUCCESS && ContextPtr->TransportFunc == NULL)
+    {
+        /*
+         * The mask is read without the lock.  A waiter sets its bit before it
+         * checks the queue, so either it sees the message or the bit is seen here.
+         */
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+        if (PipeDscPtr != NULL && PipeDscPtr->WaiterMask != 0)
+        {
+            CFE_SB_PipeWaiter_Wake(PipeDscPtr->WaiterMask);
+        }
+    }
+    else
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        if (ContextPtr->OsStatus == OS_SUCCESS)
+        {
+            /* nominal, delivered by the transport */
+        }
+        else if (ContextPtr->UseContiguous && TxnPtr->ContiguousBufDscPtr == NULL)
+        {
+            ++TxnPtr->NumPipeErrs;
+            ContextPtr->PendingEventId = CFE_SB_GET_BUF_ERR_EID;
+        }
+        else if (ContextPtr->OsStatus == OS_QUEUE_FULL)
+        {
+            ++TxnPtr->NumPipeErrs;
+            ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
+            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
+        }
+        else
+        {
+            /* Unexpected error while writing to queue (or from the transport). */
+            ++TxnPtr->NumPipeErrs;
+            ContextPtr->PendingEventId = CFE_SB_Q_WR_ERR_EID;
+            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
+        }
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
+        {
+            if (PipeDscPtr->CurrentQueueDepth > 0)
+            {
+                --PipeDscPtr->CurrentQueueDepth;
+            }
+
+            LanePtr = &PipeDscPtr->Lane[ContextPtr->Lane];
+            if (LanePtr->CurrentQueueDepth > 0)
+            {
+                --LanePtr->CurrentQueueDepth;
+            }
+
+            if (ContextPtr->OsStatus == OS_QUEUE_FULL)
+            {
+                ++LanePtr->OverflowErrors;
+            }
+
+            /*
+             * Nothing was added to the pipe, so only notify if a message from another
+             * sender is still accounted for, as in CFE_SB_PipeReady_Arm().  Otherwise
+             * arm the handler again for the next message.
+             */
+            if (ContextPtr->ReadyHandler != NULL && PipeDscPtr->CurrentQueueDepth == 0)
+            {
+                PipeDscPtr->ReadyArmed   = (PipeDscPtr->ReadyHandler != NULL);
+                ContextPtr->ReadyHandler = NULL;
+            }
+        }
+        else
+        {
+            ContextPtr->ReadyHandler = NULL;
+        }
+
+        DestPtr = CFE_SB_GetBufferDestPtr(BufDscPtr, ContextPtr->PipeId);
+        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        {
+            DestPtr->BuffCount--;
+        }
+
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /* First message on the pipe since the owner found it empty, see above if it was not queued */
+    if (ContextPtr->ReadyHandler != NULL)
+    {
+        ContextPtr->ReadyHandler(ContextPtr->PipeId, ContextPtr->ReadyArg);
+    }
+
+    /* always keep going when sending (broadcast) */
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_ProcessPipes(CFE_SB_MessageTxn_PipeHandler_t HandlerFunc,
+                                    CFE_SB_MessageTxn_State_t      *TxnPtr,
+                                    void                           *Arg)
+{
+    uint32                 i;
+    CFE_SB_PipeSetEntry_t *ContextPtr;
+    bool                   should_continue;
+
+    should_continue = true;
+    for (i = 0; should_continue && i < TxnPtr->NumPipes; ++i)
+    {
+        ContextPtr = &TxnPtr->PipeSet[i];
+
+        if (ContextPtr->PendingEventId == 0)
+        {
+            should_continue = HandlerFunc(TxnPtr, ContextPtr, Arg);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr)
+{
+    int32             Status;
+    CFE_SB_BufferD_t *BufDscPtr;
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Send Err:Invalid MsgId(0x%x)in msg,App %s",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     CFE_SB_GetAppTskName(TskId, FullName));
-            break;
+    /* Sanity check on the input buffer - if this doesn't work, stop now */
+    Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
+    if (Status != CFE_SUCCESS)
+    {
+        /* There is currently no event defined for this */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
+        return;
+    }
 
-        case CFE_SB_MSG_TOO_BIG_EID:
-            *ReqBit    = CFE_SB_MSG_TOO_BIG_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    /* Save passed-in routing parameters into the descriptor */
+    BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
+    BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     CFE_SB_GetAppTskName(TskId, FullName),
-                     (int)TxnPtr->ContentSize,
-                     CFE_MISSION_SB_MAX_SB_MSG_SIZE);
-            break;
+    /* Convert the route to a set of pipes/destinations */
+    CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
 
-        case CFE_SB_SEND_NO_SUBS_EID:
-            *ReqBit    = CFE_SB_SEND_NO_SUBS_EID_BIT;
-            *EventType = CFE_EVS_EventType_INFORMATION;
+    /* Note the above function always succeeds - even if no pipes are subscribed,
+     * the transaction will simply have 0 pipes and this next call becomes a no-op */
+    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "No subscribers for MsgId 0x%x,sender %s",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     CFE_SB_GetAppTskName(TskId, FullName));
-            break;
+    /*
+     * Decrement the buffer UseCount - This means that the caller
+     * should not use the buffer anymore after this call.
+     */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    CFE_SB_DecrBufUseCnt(BufDscPtr);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
 
-        case CFE_SB_GET_BUF_ERR_EID:
-            *ReqBit    = CFE_SB_GET_BUF_ERR_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_MakeContiguous(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_PipeSetEntry_t *ContextPtr;
+    CFE_SB_BufferD_t      *CopyDscPtr;
+    uint8                 *DestPtr;
+    size_t                 TotalSize;
+    uint32                 NumUsers;
+    uint32                 i;
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     CFE_SB_GetAppTskName(TskId, FullName),
-                     (int)TxnPtr->ContentSize);
-            break;
+    NumUsers = 0;
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        ContextPtr = &TxnPtr->PipeSet[i];
+        if (ContextPtr->UseContiguous && ContextPtr->PendingEventId == 0)
+        {
+            ++NumUsers;
+        }
+    }
 
-        case CFE_SB_MSGID_LIM_ERR_EID:
-            *ReqBit    = CFE_SB_MSGID_LIM_ERR_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    if (NumUsers == 0)
+    {
+        return;
+    }
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     PipeName,
-                     CFE_SB_GetAppTskName(TskId, FullName));
-            break;
+    TotalSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
 
-        case CFE_SB_Q_FULL_ERR_EID:
-            *ReqBit    = CFE_SB_Q_FULL_ERR_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    CFE_SB_LockSharedData(__func__, __LINE__);
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     PipeName,
-                     CFE_SB_GetAppTskName(TskId, FullName));
+    /* As in CFE_SB_TransmitTxn_ExecuteCopy(), the new buffer has a use count of 1 for this task */
+    CopyDscPtr = CFE_SB_GetBufferFromPool(TotalSize);
+    if (CopyDscPtr != NULL)
+    {
+        CopyDscPtr->MsgId         = BufDscPtr->MsgId;
+        CopyDscPtr->DestRouteId   = BufDscPtr->DestRouteId;
+        CopyDscPtr->TransmitTicks = BufDscPtr->TransmitTicks;
+
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &CopyDscPtr->Link);
+
+        /* Move the references of the pipes that take the copy */
+        for (i = 0; i < TxnPtr->NumPipes; ++i)
+        {
+            ContextPtr = &TxnPtr->PipeSet[i];
+            if (ContextPtr->UseContiguous && ContextPtr->PendingEventId == 0)
+            {
+                CFE_SB_IncrBufUseCnt(CopyDscPtr);
+                CFE_SB_DecrBufUseCnt(BufDscPtr);
+            }
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (CopyDscPtr != NULL)
+    {
+        /* The copy is not visible to any other task until it is written to the pipes */
+        DestPtr = (uint8 *)&CopyDscPtr->Content;
+        memcpy(DestPtr, &BufDscPtr->Content, BufDscPtr->ContentSize);
+        DestPtr += BufDscPtr->ContentSize;
+
+        for (i = 0; i < BufDscPtr->SegmentList->NumSegments; ++i)
+        {
+            memcpy(DestPtr,
+                   BufDscPtr->SegmentList->Segments[i].DataPtr,
+                   BufDscPtr->SegmentList->Segments[i].Size);
+            DestPtr += BufDscPtr->SegmentList->Segments[i].Size;
+        }
+
+        TxnPtr->ContiguousBufDscPtr = CopyDscPtr;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ExecuteSegments(CFE_SB_MessageTxn_State_t  *TxnPtr,
+                                        CFE_SB_Buffer_t            *BufPtr,
+                                        const CFE_SB_SegmentList_t *SegListPtr)
+{
+    int32             Status;
+    CFE_SB_BufferD_t *BufDscPtr;
+    size_t            TotalSize;
+    size_t            InlineSize;
+    uint32            i;
+
+    Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
+        return;
+    }
+
+    /* The segments follow the part of the message in the buffer, which must fit in the buffer */
+    TotalSize  = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
+    InlineSize = TotalSize;
+    for (i = 0; i < SegListPtr->NumSegments; ++i)
+    {
+        if (SegListPtr->Segments[i].Size > InlineSize)
+        {
             break;
+        }
+        InlineSize -= SegListPtr->Segments[i].Size;
+    }
+
+    if (i < SegListPtr->NumSegments || InlineSize > (BufDscPtr->AllocatedSize - offsetof(CFE_SB_BufferD_t, Content)))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        return;
+    }
+
+    BufDscPtr->ContentSize = InlineSize;
+    BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
+    BufDscPtr->SegmentList = SegListPtr;
+
+    CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
+
+    /* Legacy pipes and transports get a copy of the whole message */
+    CFE_SB_TransmitTxn_MakeContiguous(TxnPtr, BufDscPtr);
+
+    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
+
+    /* Give up the references of this task, the segments are released along with the buffer */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    CFE_SB_DecrBufUseCnt(BufDscPtr);
+    if (TxnPtr->ContiguousBufDscPtr != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(TxnPtr->ContiguousBufDscPtr);
+    }
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ExecuteCopy(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_ES_AppId_t    AppId;
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    /* see CFE_SB_TransmitTxn_FindDestinations() - app ID should not be obtained while locked */
+    AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_ES_GetAppID(&AppId);
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /*
+     * Get a buffer - note this pre-initializes the returned buffer with
+     * a use count of 1, which refers to this task as it fills the buffer.
+     * It does not need to be tracked as a zero copy buffer, as it is
+     * never handed out to the application.
+     */
+    BufDscPtr = CFE_SB_GetBufferFromPool(CFE_SB_MessageTxn_GetContentSize(TxnPtr));
+    if (BufDscPtr != NULL)
+    {
+        BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
+        BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
+
+        CFE_SB_TransmitTxn_ResolveRoute(TxnPtr, BufDscPtr, AppId);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (BufDscPtr == NULL)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
+        return;
+    }
+
+    /*
+     * The buffer is not visible to any other task until it is written to the
+     * pipes, so the content can be filled in without holding the lock.  If there
+     * were no subscribers after all, there is nothing to fill in.
+     */
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        memcpy(&BufDscPtr->Content, MsgPtr, BufDscPtr->ContentSize);
+    }
+
+    CFE_SB_TransmitTxn_Originate(TxnPtr, BufDscPtr);
+
+    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
+
+    /* Release the reference held by this task, as in CFE_SB_TransmitTxn_Execute() */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    CFE_SB_DecrBufUseCnt(BufDscPtr);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ExecuteBatch(CFE_SB_TransmitTxn_State_t *TxnSet,
+                                     CFE_SB_Buffer_t *const     *BufPtrSet,
+                                     uint32                      NumTxns)
+{
+    CFE_SB_BufferD_t          *BufDscSet[CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_PipeId_t            PipeSet[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_MessageTxn_State_t *TxnPtr;
+    CFE_SB_PipeSetEntry_t     *ContextPtr;
+    CFE_ES_AppId_t             AppId;
+    uint32                     NumDistinctPipes;
+    uint32                     TxnIdx;
+    uint32                     PipeIdx;
+    uint32                     EntryIdx;
+    int32                      Status;
+
+    if (NumTxns > CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE)
+    {
+        NumTxns = CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE;
+    }
+
+    /* Sanity check on all input buffers and save routing parameters - this does not require the lock */
+    for (TxnIdx = 0; TxnIdx < NumTxns; ++TxnIdx)
+    {
+        TxnPtr            = &TxnSet[TxnIdx].MessageTxn_State;
+        BufDscSet[TxnIdx] = NULL;
+
+        if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+        {
+            Status = CFE_SB_ZeroCopyBufferValidate(BufPtrSet[TxnIdx], &BufDscSet[TxnIdx]);
+            if (Status != CFE_SUCCESS)
+            {
+                /* There is currently no event defined for this */
+                CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
+                BufDscSet[TxnIdx] = NULL;
+            }
+            else
+            {
+                BufDscSet[TxnIdx]->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
+                BufDscSet[TxnIdx]->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
+            }
+        }
+    }
+
+    /* see CFE_SB_TransmitTxn_FindDestinations() - app ID should not be obtained while locked */
+    CFE_ES_GetAppID(&AppId);
+
+    /* Convert the route of every message to a set of pipes/destinations, under a single lock */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (TxnIdx = 0; TxnIdx < NumTxns; ++TxnIdx)
+    {
+        if (BufDscSet[TxnIdx] == NULL)
+        {
+            continue;
+        }
+
+        TxnPtr = &TxnSet[TxnIdx].MessageTxn_State;
+
+        /*
+         * The owner is cleared once a buffer is routed, so if it is not set here it means
+         * the same buffer was passed more than once within this batch.  Only the first
+         * instance is sent, the buffer cannot be sent twice.
+         */
+        if (!CFE_RESOURCEID_TEST_DEFINED(BufDscSet[TxnIdx]->AppId))
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_BUFFER_INVALID);
+            BufDscSet[TxnIdx] = NULL;
+        }
+        else
+        {
+            CFE_SB_TransmitTxn_ResolveRoute(TxnPtr, BufDscSet[TxnIdx], AppId);
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-        case CFE_SB_Q_WR_ERR_EID:
-            *ReqBit    = CFE_SB_Q_WR_ERR_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    /* Origination actions are done outside the lock, same as a single transmit */
+    NumDistinctPipes = 0;
+    for (TxnIdx = 0; TxnIdx < NumTxns; ++TxnIdx)
+    {
+        if (BufDscSet[TxnIdx] == NULL)
+        {
+            continue;
+        }
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
-                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId),
-                     PipeName,
-                     CFE_SB_GetAppTskName(TskId, FullName),
-                     (long)LocalOsStatus);
-            break;
+        TxnPtr = &TxnSet[TxnIdx].MessageTxn_State;
 
-        case CFE_SB_Q_RD_ERR_EID:
-            *ReqBit    = -1;
-            *EventType = CFE_EVS_EventType_ERROR;
+        CFE_SB_TransmitTxn_Originate(TxnPtr, BufDscSet[TxnIdx]);
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Pipe Read Err,pipe %s,app %s,stat %ld",
-                     PipeName,
-                     CFE_SB_GetAppTskName(TskId, FullName),
-                     (long)LocalOsStatus);
-            break;
-        case CFE_SB_RCV_BAD_ARG_EID:
-            *ReqBit    = -1;
-            *EventType = CFE_EVS_EventType_ERROR;
+        /* Collect the set of distinct pipes that this batch will be written to */
+        for (EntryIdx = 0; EntryIdx < TxnPtr->NumPipes; ++EntryIdx)
+        {
+            ContextPtr = &TxnPtr->PipeSet[EntryIdx];
+            for (PipeIdx = 0; PipeIdx < NumDistinctPipes; ++PipeIdx)
+            {
+                if (CFE_RESOURCEID_TEST_EQUAL(PipeSet[PipeIdx], ContextPtr->PipeId))
+                {
+                    break;
+                }
+            }
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %s,t/o %d,app %s",
-                     (unsigned long)TxnPtr->RefMemPtr,
-                     PipeName,
-                     (int)TxnPtr->UserTimeoutParam,
-                     CFE_SB_GetAppTskName(TskId, FullName));
-            break;
-        case CFE_SB_BAD_PIPEID_EID:
-            *ReqBit    = -1;
-            *EventType = CFE_EVS_EventType_ERROR;
+            if (PipeIdx == NumDistinctPipes && NumDistinctPipes < CFE_PLATFORM_SB_MAX_PIPES)
+            {
+                PipeSet[NumDistinctPipes] = ContextPtr->PipeId;
+                ++NumDistinctPipes;
+            }
+        }
+    }
 
-            snprintf(EvtMsg,
-                     EvtMsgSize,
-                     "Rcv Err:PipeId %s does not exist,app %s",
-                     PipeName,
-                     CFE_SB_GetAppTskName(TskId, FullName));
-            break;
+    /*
+     * Write the queues grouped by destination pipe, so all messages bound for
+     * the same pipe are written back-to-back.  Within each pipe, messages are
+     * written in the order they appear in the batch, so the relative order
+     * seen by each receiver is the same as if they were sent one at a time.
+     */
+    for (PipeIdx = 0; PipeIdx < NumDistinctPipes; ++PipeIdx)
+    {
+        for (TxnIdx = 0; TxnIdx < NumTxns; ++TxnIdx)
+        {
+            if (BufDscSet[TxnIdx] == NULL)
+            {
+                continue;
+            }
 
-        default:
-            EvtMsg[0]  = 0;
-            *ReqBit    = 0;
-            *EventType = 0;
-            break;
+            TxnPtr = &TxnSet[TxnIdx].MessageTxn_State;
+
+            for (EntryIdx = 0; EntryIdx < TxnPtr->NumPipes; ++EntryIdx)
+            {
+                ContextPtr = &TxnPtr->PipeSet[EntryIdx];
+                if (ContextPtr->PendingEventId == 0 && CFE_RESOURCEID_TEST_EQUAL(PipeSet[PipeIdx], ContextPtr->PipeId))
+                {
+                    CFE_SB_TransmitTxn_PipeHandler(TxnPtr, ContextPtr, BufDscSet[TxnIdx]);
+                }
+            }
+        }
+    }
+
+    /*
+     * Decrement the use count of every buffer under a single lock - This means
+     * that the caller should not use any of the buffers anymore after this call.
+     */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (TxnIdx = 0; TxnIdx < NumTxns; ++TxnIdx)
+    {
+        if (BufDscSet[TxnIdx] != NULL)
+        {
+            CFE_SB_DecrBufUseCnt(BufDscSet[TxnIdx]);
+        }
     }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
+/******************************************************************
+ *
+ * RECEIVE TRANSACTION IMPLEMENTATION FUNCTIONS
+ *
+ ******************************************************************/
+
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CFE_SB_MessageTxn_ReportSingleEvent(const CFE_SB_MessageTxn_State_t *TxnPtr,
-                                         const CFE_SB_PipeSetEntry_t     *ContextPtr,
-                                         uint16                           EventId)
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *TxnPtr, const void *RefMemPtr)
 {
-    CFE_ES_TaskId_t          TskId;
-    CFE_EVS_EventType_Enum_t EventType;
-    char                     Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    int32                    ReqBit;
+    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, TxnPtr->Source, CFE_SB_PIPE_LANE_COUNT, RefMemPtr);
+    TxnPtr->MessageTxn_State.IsTransmit = false;
 
-    /* get task id for events and Sender Info*/
-    CFE_ES_GetTaskID(&TskId);
+    /* No matter what, the mem pointer from the caller should not be NULL */
+    /* note that the event ID is different between send and recv */
+    if (RefMemPtr == NULL)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
 
-    CFE_SB_MessageTxn_GetEventDetails(TxnPtr,
-                                      ContextPtr,
-                                      EventId,
-                                      TskId,
-                                      Message,
-                                      sizeof(Message),
-                                      &EventType,
-                                      &ReqBit);
+    return &TxnPtr->MessageTxn_State;
+}
 
-    if (EventType > 0 && CFE_SB_RequestToSendEvent(TskId, ReqBit) == CFE_SB_GRANTED)
-    {
-        CFE_EVS_SendEventWithAppID(EventId, EventType, CFE_SB_Global.AppId, "%s", Message);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEndpoint)
+{
+    TxnPtr->IsEndpoint = IsEndpoint;
+}
 
-        /* clear the bit so the task may send this event again */
-        CFE_SB_FinishSendEvent(TskId, ReqBit);
-    }
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_SetRouteHandle(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_RouteHandle_t *HandlePtr)
+{
+    TxnPtr->RouteHandlePtr = HandlePtr;
+}
 
-    /* If the event type was an error, this should increment the general error counter */
-    return (EventType >= CFE_EVS_EventType_ERROR);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
+{
+    /* Replaces any pipe that was set before */
+    TxnPtr->NumPipes = 0;
+    CFE_SB_ReceiveTxn_AddPipeId(TxnPtr, PipeId);
 }
 
 /*----------------------------------------------------------------
@@ -799,166 +2340,221 @@ bool CFE_SB_MessageTxn_ReportSingleEvent(const CFE_SB_MessageTxn_State_t *TxnPtr
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_ReportEvents(const CFE_SB_MessageTxn_State_t *TxnPtr)
+void CFE_SB_ReceiveTxn_AddPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
 {
-    uint32 i;
-    uint32 NumErrors;
-    bool   IsError;
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    CFE_SB_PipeSetEntry_t *ContextPtr;
 
-    NumErrors = 0;
+    if (TxnPtr->NumPipes >= TxnPtr->MaxPipes)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        return;
+    }
 
-    if (TxnPtr->TransactionEventId != 0)
+    ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
+    memset(ContextPtr, 0, sizeof(*ContextPtr));
+    ContextPtr->PipeId = PipeId;
+    ++TxnPtr->NumPipes;
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* If the pipe does not exist or PipeId is out of range... */
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
     {
-        IsError = CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, NULL, TxnPtr->TransactionEventId);
-        if (IsError)
+        ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_BAD_ARGUMENT);
+        ++TxnPtr->NumPipeErrs;
+    }
+    else
+    {
+        /* If the pipe has a high priority lane, that is checked first */
+        if (OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId) && TxnPtr->NumPipes < TxnPtr->MaxPipes)
         {
-            ++NumErrors;
+            ContextPtr->SysQueueId = PipeDscPtr->PriorityQueueId;
+            ContextPtr->Lane       = CFE_SB_QosPriority_HIGH;
+
+            ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
+            memset(ContextPtr, 0, sizeof(*ContextPtr));
+            ContextPtr->PipeId = PipeId;
+            ++TxnPtr->NumPipes;
         }
+
+        ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
+        ContextPtr->Lane       = CFE_SB_QosPriority_LOW;
+
+        /*
+         * Un-reference any previous buffer(s) from the last call.
+         *
+         * NOTE: This is historical behavior where apps call CFE_SB_ReceiveBuffer()
+         * in the loop within the app's main task.  There is currently no separate
+         * API to "free" or unreference a buffer that was returned from SB.
+         *
+         * Instead, each time this function is invoked, it is implicitly interpreted
+         * as an indication that the caller is done with the previous buffer.
+         *
+         * Unfortunately this prevents pipe IDs from being serviced/shared across
+         * multiple child tasks in a worker pattern design.  This may be changed
+         * in a future version of CFE to decouple these actions, to allow for
+         * multiple workers to service the same pipe.
+         */
+        CFE_SB_PipeDescReleaseBuffers(PipeDscPtr);
     }
 
-    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                       CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                       CFE_SB_BufferD_t          *BufDscPtr,
+                                       CFE_SB_BufferD_t         **ParentBufDscPtrP)
+{
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    uint64                 NowTicks;
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+
+    /* Read the timebase before taking the lock, so the lock is not held any longer */
+    NowTicks = 0;
+    if (CFE_SB_Global.LatencyStatsEnabled)
     {
-        if (TxnPtr->PipeSet[i].PendingEventId != 0)
-        {
-            IsError =
-                CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, &TxnPtr->PipeSet[i], TxnPtr->PipeSet[i].PendingEventId);
-            if (IsError)
-            {
-                ++NumErrors;
-            }
-        }
+        NowTicks = CFE_SB_GetTimebaseTicks();
     }
 
-    if (NumErrors > 0)
+    /* Now re-lock to store the buffer in the pipe descriptor */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /*
+     * NOTE: This uses the same PipeDscPtr that was found earlier.
+     * But it has to be revalidated because its theoretically possible
+     * the pipe got deleted between now and then.
+     */
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
     {
         /*
-         * Increment the error only if there was a real error,
-         * such as a validation issue or failure to allocate a buffer.
-         *
-         * Note that transmit side just has one error counter, whereas
-         * receive side has two - these differeniate between a bad passed-in
-         * arg vs some other internal error such as queue access.
+        ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
+        ** ptr corresponding to the message just read. This is done so that
+        ** the buffer can be released on the next receive call for this pipe.
+        **
+        ** This counts as a new reference as it is being stored in the PipeDsc
+        */
+        CFE_SB_IncrBufUseCnt(BufDscPtr);
+        PipeDscPtr->LastBuffer = BufDscPtr;
+
+        /*
+         * Also set the Receivers pointer to the address of the actual message
+         * (currently this is "borrowing" the ref above, not its own ref)
          */
-        CFE_SB_LockSharedData(__func__, __LINE__);
+        *ParentBufDscPtrP = BufDscPtr;
 
-        if (TxnPtr->IsTransmit)
+        /* get pointer to destination to be used in decrementing msg limit cnt*/
+        DestPtr = CFE_SB_GetBufferDestPtr(BufDscPtr, ContextPtr->PipeId);
+
+        /*
+        ** DestPtr would be NULL if the msg is unsubscribed to while it is on
+        ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
+        ** then resubscribed to while it is on the pipe. Both of these cases are
+        ** considered nominal and are handled by the code below.
+        */
+        if (DestPtr != NULL && DestPtr->BuffCount > 0)
         {
-            CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+            DestPtr->BuffCount--;
         }
-        else if (TxnPtr->Status == CFE_SB_BAD_ARGUMENT)
+
+        if (PipeDscPtr->CurrentQueueDepth > 0)
         {
-            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+            --PipeDscPtr->CurrentQueueDepth;
         }
-        else
+
+        if (PipeDscPtr->Lane[ContextPtr->Lane].CurrentQueueDepth > 0)
         {
-            /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
-            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+            --PipeDscPtr->Lane[ContextPtr->Lane].CurrentQueueDepth;
         }
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
-    }
-}
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetEventAndStatus(CFE_SB_MessageTxn_State_t *TxnPtr, uint16 EventId, CFE_Status_t Status)
-{
-    if (TxnPtr->TransactionEventId == 0)
-    {
-        TxnPtr->TransactionEventId = EventId;
-    }
-    if (TxnPtr->Status == CFE_SUCCESS)
-    {
-        TxnPtr->Status = Status;
-    }
-}
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetRoutingMsgId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_MsgId_t RoutingMsgId)
-{
-    /* validate the msgid in the message */
-    if (!CFE_SB_IsValidMsgId(RoutingMsgId))
-    {
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_INV_MSGID_EID, CFE_SB_BAD_ARGUMENT);
+        if (CFE_SB_Global.LatencyStatsEnabled)
+        {
+            CFE_SB_RecordLatency(PipeDscPtr, BufDscPtr, NowTicks);
+        }
     }
     else
     {
-        TxnPtr->RoutingMsgId = RoutingMsgId;
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+
+        /* should send the bad pipe ID event here too */
+        ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
     }
+
+    /* Always decrement the use count, for the ref that was in the queue */
+    CFE_SB_DecrBufUseCnt(BufDscPtr);
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local Helper function
+ * Not invoked outside of this unit
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetContentSize(CFE_SB_MessageTxn_State_t *TxnPtr, size_t ContentSize)
+bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
 {
-    if (ContentSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    CFE_SB_BufferD_t  *BufDscPtr;
+    CFE_SB_BufferD_t **ParentBufDscPtrP;
+    size_t             BufDscSize;
+
+    ParentBufDscPtrP = Arg;
+
+    /* Read the buffer descriptor address from the queue.  */
+    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId,
+                                       &BufDscPtr,
+                                       sizeof(BufDscPtr),
+                                       &BufDscSize,
+                                       CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+
+    /*
+     * translate the return value -
+     *
+     * CFE functions have their own set of RC values should not directly return OSAL codes
+     * The size should always match.  If it does not, then generate CFE_SB_Q_RD_ERR_EID.
+     */
+
+    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
     {
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_MSG_TOO_BIG_EID, CFE_SB_MSG_TOO_BIG);
+        CFE_SB_ReceiveTxn_ExportReference(TxnPtr, ContextPtr, BufDscPtr, ParentBufDscPtrP);
     }
     else
     {
-        TxnPtr->ContentSize = ContentSize;
-    }
-}
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr)
-{
-    CFE_Status_t   Status;
-    CFE_MSG_Size_t MsgSize;
-    CFE_SB_MsgId_t MsgId;
+        *ParentBufDscPtrP = NULL;
 
-    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
-    {
-        /* In this context, the user should have set the the size and MsgId in the content */
-        Status = CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        if (Status == CFE_SUCCESS)
-        {
-            CFE_SB_MessageTxn_SetRoutingMsgId(TxnPtr, MsgId);
-        }
-        else
+        if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
         {
-            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_BAD_ARG_EID, Status);
+            /* normal if using CFE_SB_POLL */
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_NO_MESSAGE);
         }
-    }
-
-    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
-    {
-        Status = CFE_MSG_GetSize(MsgPtr, &MsgSize);
-        if (Status == CFE_SUCCESS)
+        else if (ContextPtr->OsStatus == OS_QUEUE_TIMEOUT)
         {
-            CFE_SB_MessageTxn_SetContentSize(TxnPtr, MsgSize);
+            /* normal if using a nonzero timeout */
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
         }
         else
         {
-            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_BAD_ARG_EID, Status);
+            /* off-nominal condition, report an error event */
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+            ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
         }
     }
-}
 
-/******************************************************************
- *
- * TRANSMIT TRANSACTION IMPLEMENTATION FUNCTIONS
- *
- ******************************************************************/
+    /* Read ops only process one pipe */
+    return false;
+}
 
 /*----------------------------------------------------------------
  *
@@ -966,158 +2562,108 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_MessageTxn_State_t *CFE_SB_TransmitTxn_Init(CFE_SB_TransmitTxn_State_t *TxnPtr, const void *RefMemPtr)
-{
-    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, TxnPtr->DestSet, CFE_PLATFORM_SB_MAX_DEST_PER_PKT, RefMemPtr);
-    TxnPtr->MessageTxn_State.IsTransmit = true;
-
-    /* No matter what, the mem pointer from the caller should not be NULL */
-    if (RefMemPtr == NULL)
-    {
-        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
-    }
-
-    return &TxnPtr->MessageTxn_State;
-}
-
-/*----------------------------------------------------------------
- *
- * Local Helper function
- * Not invoked outside of this unit
- *
- *-----------------------------------------------------------------*/
-void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr)
 {
-    CFE_SB_PipeD_t        *PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeSetEntry_t *ContextPtr;
-    CFE_ES_AppId_t         AppId;
+    CFE_SB_BufferD_t      *BufDscPtr;
+    const CFE_SB_Buffer_t *Result;
+    CFE_SB_PipeId_t        PipeId;
     bool                   IsAcceptable;
     CFE_Status_t           Status;
 
     /*
-     * get app id for loopback testing  -
-     * This is only used if one or more of the destinations has its "IGNOREMINE" option set,
-     * but it should NOT be gotten while locked.  So since we do not know (yet) if we need it,
-     * it is better to get it and not need it than need it and not have it.
+     * If the pipe has a high priority lane, there is one entry per lane.  A message
+     * in either lane has to end the wait, so this is the same as waiting on a set of pipes.
      */
-    CFE_ES_GetAppID(&AppId);
-
-    /* take semaphore to prevent a task switch during processing */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+    if (TxnPtr->NumPipes > 1)
+    {
+        return CFE_SB_ReceiveAnyTxn_Execute(TxnPtr, &PipeId);
+    }
 
-    /* Get the routing id */
-    BufDscPtr->DestRouteId = CFE_SBR_GetRouteId(TxnPtr->RoutingMsgId);
+    Result = NULL;
 
-    /* For an invalid route / no subscribers this whole logic can be skipped */
-    if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
+    while (CFE_SB_MessageTxn_IsOK(TxnPtr))
     {
-        /* If this is the origination, then update the message content (while locked) before actually sending */
-        if (TxnPtr->IsEndpoint)
-        {
-            CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId);
+        BufDscPtr = NULL;
 
-            /* Set the sequence count from the route */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(BufDscPtr->DestRouteId));
-        }
+        /* Read from the pipe */
+        CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveTxn_PipeHandler, TxnPtr, &BufDscPtr);
 
-        /* Send the packet to all destinations  */
-        DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
-        while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
+        /* If nothing received, then quit */
+        if (BufDscPtr == NULL)
         {
-            ContextPtr = NULL;
-
-            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
-            {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
-            }
-            else
-            {
-                PipeDscPtr = NULL;
-            }
-
-            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
-            {
-                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) == 0
-                    || !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
-                {
-                    ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
-                    ++TxnPtr->NumPipes;
-                }
-            }
+            TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
+            TxnPtr->ContentSize  = 0;
+            Result               = NULL;
+            break;
+        }
 
-            if (ContextPtr != NULL)
+        if (TxnPtr->IsEndpoint)
+        {
+            Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+            if (Status != CFE_SUCCESS)
             {
-                memset(ContextPtr, 0, sizeof(*ContextPtr));
-
-                ContextPtr->PipeId     = DestPtr->PipeId;
-                ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
-
-                /* if Msg limit exceeded, log event, increment counter */
-                /* and go to next destination */
-                if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
-                {
-                    ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
-                    ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
-                    ++PipeDscPtr->SendErrors;
-                    ++TxnPtr->NumPipeErrs;
-                }
-                else
-                {
-                    CFE_SB_IncrBufUseCnt(BufDscPtr);
-                    ++DestPtr->BuffCount;
-
-                    ++PipeDscPtr->CurrentQueueDepth;
-                    if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
-                    {
-                        PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                    }
-                }
+                /* This typically should not happen - only if VerificationAction got bad arguments */
+                IsAcceptable = false;
             }
+        }
+        else
+        {
+            /* If no verification being done at this stage - consider everything "good" */
+            IsAcceptable = true;
+        }
 
-            DestPtr = DestPtr->Next;
+        if (IsAcceptable)
+        {
+            /*
+             * Replicate the buffer descriptor MsgId and ContentSize in the transaction.
+             *
+             * This does not use the functions that check the values because that will
+             * send an event and set an error status if they are bad.  But on the recv side,
+             * it is already here - whatever we got should be returned.  Error checking for
+             * size and MsgId should have been done on the transmit side, so they should never
+             * be bad at this point.
+             */
+            TxnPtr->RoutingMsgId = BufDscPtr->MsgId;
+            TxnPtr->ContentSize  = BufDscPtr->ContentSize;
+            Result               = &BufDscPtr->Content;
+            break;
         }
-    }
-    else
-    {
-        /* if there have been no subscriptions for this pkt, */
-        /* increment the dropped pkt cnt, send event and return success */
-        CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_NO_SUBS_EID, CFE_SUCCESS);
-    }
 
-    /*
-     * Remove this from whatever list it was in
-     *
-     * If it was a singleton/new buffer this has no effect.
-     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
-     */
-    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+        /* Report an event indicating the buffer is being dropped */
+        CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, TxnPtr->PipeSet, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
 
-    /* clear the AppID field in case it was a zero copy buffer,
-     * as it is no longer owned by that app after broadcasting */
-    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+        /*
+         * Also need to re-set the PipeId for proper accounting.  This buffer will be dropped,
+         * and this decrements the use count and removes it from the LastBuffer pointer in the
+         * Pipe Descriptor
+         */
+        CFE_SB_ReceiveTxn_SetPipeId(TxnPtr, TxnPtr->PipeSet->PipeId);
+    }
 
-    /* track the buffer as an in-transit message */
-    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
+    return Result;
+}
 
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveAnyTxn_Init(CFE_SB_ReceiveAnyTxn_State_t *TxnPtr, const void *RefMemPtr)
+{
+    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State,
+                           TxnPtr->SourceSet,
+                           CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES * CFE_SB_PIPE_LANE_COUNT,
+                           RefMemPtr);
+    TxnPtr->MessageTxn_State.IsTransmit = false;
 
-    /*
-     * Lastly, if this is the origination point, now that all headers should
-     * have known values (including sequence) - invoke the mission-specific
-     * message origination action.  This may update timestamps and/or compute
-     * any required error control fields.
-     */
-    if (CFE_SB_MessageTxn_IsOK(TxnPtr) && TxnPtr->IsEndpoint)
+    /* No matter what, the mem pointer from the caller should not be NULL */
+    if (RefMemPtr == NULL)
     {
-        /* Update any other system-specific MSG headers based on the current sequence */
-        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
-        if (Status != CFE_SUCCESS || !IsAcceptable)
-        {
-            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_MESSAGE_INTEGRITY_FAIL_EID, Status);
-        }
+        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
     }
+
+    return &TxnPtr->MessageTxn_State;
 }
 
 /*----------------------------------------------------------------
@@ -1126,124 +2672,180 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
  * Not invoked outside of this unit
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_MessageTxn_GetOsTimeout(const CFE_SB_MessageTxn_State_t *TxnPtr)
+bool CFE_SB_ReceiveAnyTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
 {
-    int32     OsTimeout;
-    OS_time_t TimeNow;
+    CFE_SB_ReceiveAnyState_t *StatePtr;
+    CFE_SB_BufferD_t         *BufDscPtr;
+    size_t                    BufDscSize;
 
-    switch (TxnPtr->TimeoutMode)
+    StatePtr = Arg;
+
+    /* Only poll here, waiting is done on all pipes at once */
+    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK);
+
+    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
     {
-        case CFE_SB_MessageTxn_TimeoutMode_PEND:
-            OsTimeout = OS_PEND;
-            break;
-        case CFE_SB_MessageTxn_TimeoutMode_TIMED:
-            CFE_PSP_GetTime(&TimeNow);
-            OsTimeout = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(TxnPtr->AbsTimeout, TimeNow));
-            if (OsTimeout < 0)
-            {
-                /* timeout has already expired, so all remaining pipes should be CHECK only */
-                OsTimeout = OS_CHECK;
-            }
-            break;
-        case CFE_SB_MessageTxn_TimeoutMode_POLL:
-        default:
-            OsTimeout = OS_CHECK;
-            break;
+        StatePtr->SourcePtr = ContextPtr;
+        CFE_SB_ReceiveTxn_ExportReference(TxnPtr, ContextPtr, BufDscPtr, &StatePtr->BufDscPtr);
+        return false;
     }
 
-    return OsTimeout;
+    if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
+    {
+        /* normal, check the next pipe */
+        return true;
+    }
+
+    /* off-nominal condition, report an error event */
+    CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+    ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
+
+    return false;
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
+const CFE_SB_Buffer_t *CFE_SB_ReceiveAnyTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t *PipeIdPtr)
 {
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t        *PipeDscPtr;
-    CFE_SB_BufferD_t      *BufDscPtr;
+    CFE_SB_ReceiveAnyState_t State;
+    CFE_SB_PipeD_t          *PipeDscPtr;
+    const CFE_SB_Buffer_t   *Result;
+    int32                    WaiterIdx;
+    bool                     IsAcceptable;
+    CFE_Status_t             Status;
 
-    BufDscPtr = Arg;
-
-    /*
-     * Write the buffer descriptor to the queue of the pipe.  Note that
-     * accounting for depth and buffer limits was already done as part
-     * of "FindDestinations" assuming this write will be successful - which
-     * is the expected/typical result here.
-     */
-    ContextPtr->OsStatus =
-        OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    Result    = NULL;
+    WaiterIdx = -1;
 
-    /*
-     * If it succeeded, nothing else to do.  But if it fails then we must undo the
-     * optimistic depth accounting done earlier.
-     */
-    if (ContextPtr->OsStatus != OS_SUCCESS)
+    while (CFE_SB_MessageTxn_IsOK(TxnPtr))
     {
-        ++TxnPtr->NumPipeErrs;
+        State.BufDscPtr = NULL;
+        State.SourcePtr = NULL;
 
-        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveAnyTxn_PipeHandler, TxnPtr, &State);
 
-        if (ContextPtr->OsStatus == OS_QUEUE_FULL)
-        {
-            ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
-        }
-        else
+        if (State.BufDscPtr != NULL)
         {
-            /* Unexpected error while writing to queue. */
-            ContextPtr->PendingEventId = CFE_SB_Q_WR_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
-        }
+            /* Same verification as CFE_SB_ReceiveTxn_Execute() */
+            IsAcceptable = true;
+            if (TxnPtr->IsEndpoint)
+            {
+                Status = CFE_MSG_VerificationAction(&State.BufDscPtr->Content.Msg, State.BufDscPtr->AllocatedSize,
+                                                    &IsAcceptable);
+                if (Status != CFE_SUCCESS)
+                {
+                    IsAcceptable = false;
+                }
+            }
 
-        PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
-        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->CurrentQueueDepth > 0)
-        {
-            --PipeDscPtr->CurrentQueueDepth;
+            if (IsAcceptable)
+            {
+                TxnPtr->RoutingMsgId = State.BufDscPtr->MsgId;
+                TxnPtr->ContentSize  = State.BufDscPtr->ContentSize;
+                *PipeIdPtr           = State.SourcePtr->PipeId;
+                Result               = &State.BufDscPtr->Content;
+                break;
+            }
+
+            /* Drop the buffer, and try again */
+            CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, State.SourcePtr, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+
+            PipeDscPtr = CFE_SB_LocatePipeDescByID(State.SourcePtr->PipeId);
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, State.SourcePtr->PipeId))
+            {
+                CFE_SB_PipeDescReleaseBuffers(PipeDscPtr);
+            }
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+            continue;
         }
 
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        /* All pipes are empty, unless there was a read error */
+        if (CFE_SB_MessageTxn_IsOK(TxnPtr))
         {
-            DestPtr->BuffCount--;
+            CFE_SB_PipeWaiter_Wait(TxnPtr, &WaiterIdx);
         }
+    }
 
-        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    if (WaiterIdx >= 0)
+    {
+        CFE_SB_PipeWaiter_Unregister(TxnPtr, WaiterIdx);
+    }
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    if (Result == NULL)
+    {
+        TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
+        TxnPtr->ContentSize  = 0;
     }
 
-    /* always keep going when sending (broadcast) */
-    return true;
+    return Result;
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_ProcessPipes(CFE_SB_MessageTxn_PipeHandler_t HandlerFunc,
-                                    CFE_SB_MessageTxn_State_t      *TxnPtr,
-                                    void                           *Arg)
+int32 CFE_SB_PipeWaiter_Register(const CFE_SB_MessageTxn_State_t *TxnPtr)
 {
-    uint32                 i;
-    CFE_SB_PipeSetEntry_t *ContextPtr;
-    bool                   should_continue;
+    CFE_SB_PipeWaiter_t *WaiterPtr;
+    CFE_SB_PipeD_t      *PipeDscPtr;
+    char                 SemName[OS_MAX_API_NAME];
+    int32                WaiterIdx;
+    uint32               i;
 
-    should_continue = true;
-    for (i = 0; should_continue && i < TxnPtr->NumPipes; ++i)
+    WaiterPtr = NULL;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (WaiterIdx = 0; WaiterIdx < CFE_SB_MAX_PIPE_WAITERS; ++WaiterIdx)
     {
-        ContextPtr = &TxnPtr->PipeSet[i];
+        if (!CFE_SB_Global.PipeWaiter[WaiterIdx].InUse)
+        {
+            WaiterPtr        = &CFE_SB_Global.PipeWaiter[WaiterIdx];
+            WaiterPtr->InUse = true;
+            break;
+        }
+    }
 
-        if (ContextPtr->PendingEventId == 0)
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (WaiterPtr == NULL)
+    {
+        return -1;
+    }
+
+    /* The semaphore is created outside the lock, the entry is reserved by now */
+    if (!OS_ObjectIdDefined(WaiterPtr->SemId))
+    {
+        snprintf(SemName, sizeof(SemName), "SB_WAIT%d", (int)WaiterIdx);
+        if (OS_BinSemCreate(&WaiterPtr->SemId, SemName, OS_SEM_EMPTY, 0) != OS_SUCCESS)
         {
-            should_continue = HandlerFunc(TxnPtr, ContextPtr, Arg);
+            WaiterPtr->SemId = OS_OBJECT_ID_UNDEFINED;
+            WaiterPtr->InUse = false;
+            return -1;
+        }
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet[i].PipeId);
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, TxnPtr->PipeSet[i].PipeId))
+        {
+            PipeDscPtr->WaiterMask |= (uint32)1 << WaiterIdx;
         }
     }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return WaiterIdx;
 }
 
 /*----------------------------------------------------------------
@@ -1252,65 +2854,88 @@ void CFE_SB_MessageTxn_ProcessPipes(CFE_SB_MessageTxn_PipeHandler_t HandlerFunc,
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr)
+void CFE_SB_PipeWaiter_Unregister(const CFE_SB_MessageTxn_State_t *TxnPtr, int32 WaiterIdx)
 {
-    int32             Status;
-    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32          i;
 
-    /* Sanity check on the input buffer - if this doesn't work, stop now */
-    Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
-    if (Status != CFE_SUCCESS)
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
     {
-        /* There is currently no event defined for this */
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
-        return;
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet[i].PipeId);
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, TxnPtr->PipeSet[i].PipeId))
+        {
+            PipeDscPtr->WaiterMask &= ~((uint32)1 << WaiterIdx);
+        }
     }
 
-    /* Save passed-in routing parameters into the descriptor */
-    BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
-    BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
-
-    /* Convert the route to a set of pipes/destinations */
-    CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
-
-    /* Note the above function always succeeds - even if no pipes are subscribed,
-     * the transaction will simply have 0 pipes and this next call becomes a no-op */
-    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
+    CFE_SB_Global.PipeWaiter[WaiterIdx].InUse = false;
 
-    /*
-     * Decrement the buffer UseCount - This means that the caller
-     * should not use the buffer anymore after this call.
-     */
-    CFE_SB_LockSharedData(__func__, __LINE__);
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
-/******************************************************************
- *
- * RECEIVE TRANSACTION IMPLEMENTATION FUNCTIONS
- *
- ******************************************************************/
-
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *TxnPtr, const void *RefMemPtr)
+void CFE_SB_PipeWaiter_Wait(CFE_SB_MessageTxn_State_t *TxnPtr, int32 *WaiterIdxPtr)
 {
-    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, &TxnPtr->Source, 1, RefMemPtr);
-    TxnPtr->MessageTxn_State.IsTransmit = false;
+    int32 OsTimeout;
+    int32 OsStatus;
 
-    /* No matter what, the mem pointer from the caller should not be NULL */
-    /* note that the event ID is different between send and recv */
-    if (RefMemPtr == NULL)
+    OsTimeout = CFE_SB_MessageTxn_GetOsTimeout(TxnPtr);
+    if (OsTimeout == OS_CHECK)
+    {
+        if (TxnPtr->TimeoutMode == CFE_SB_MessageTxn_TimeoutMode_POLL)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_NO_MESSAGE);
+        }
+        else
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+        }
+        return;
+    }
+
+    if (*WaiterIdxPtr < 0)
+    {
+        /*
+         * Register before waiting, then the caller checks all pipes again for any message
+         * written in the meantime, as those did not wake this task.
+         */
+        *WaiterIdxPtr = CFE_SB_PipeWaiter_Register(TxnPtr);
+        if (*WaiterIdxPtr < 0)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+        }
+        return;
+    }
+
+    /*
+     * The semaphore may also have been given for a message that was already
+     * read by an earlier check, in which case all pipes are simply checked again
+     */
+    if (OsTimeout == OS_PEND)
+    {
+        OsStatus = OS_BinSemTake(CFE_SB_Global.PipeWaiter[*WaiterIdxPtr].SemId);
+    }
+    else
     {
-        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        OsStatus = OS_BinSemTimedWait(CFE_SB_Global.PipeWaiter[*WaiterIdxPtr].SemId, OsTimeout);
     }
 
-    return &TxnPtr->MessageTxn_State;
+    if (OsStatus == OS_SEM_TIMEOUT)
+    {
+        /* normal if using a nonzero timeout */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+    }
+    else if (OsStatus != OS_SUCCESS)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1319,9 +2944,18 @@ CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *Txn
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEndpoint)
+void CFE_SB_PipeWaiter_Wake(uint32 WaiterMask)
 {
-    TxnPtr->IsEndpoint = IsEndpoint;
+    uint32 WaiterIdx;
+
+    for (WaiterIdx = 0; WaiterMask != 0; ++WaiterIdx)
+    {
+        if ((WaiterMask & 1) != 0)
+        {
+            OS_BinSemGive(CFE_SB_Global.PipeWaiter[WaiterIdx].SemId);
+        }
+        WaiterMask >>= 1;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1330,56 +2964,43 @@ void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEnd
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
+void CFE_SB_PipeReady_Arm(CFE_SB_PipeId_t PipeId)
 {
-    CFE_SB_PipeD_t        *PipeDscPtr;
-    CFE_SB_PipeSetEntry_t *ContextPtr;
-
-    /* For now, there is just one of these */
-    ContextPtr = TxnPtr->PipeSet;
-    memset(ContextPtr, 0, sizeof(*ContextPtr));
-    ContextPtr->PipeId = PipeId;
-    TxnPtr->NumPipes   = 1;
+    CFE_SB_PipeD_t           *PipeDscPtr;
+    CFE_SB_PipeReadyHandler_t Handler;
+    void                     *Arg;
 
-    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    Handler = NULL;
+    Arg     = NULL;
 
     CFE_SB_LockSharedData(__func__, __LINE__);
 
-    /* If the pipe does not exist or PipeId is out of range... */
-    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
-    {
-        ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_BAD_ARGUMENT);
-        ++TxnPtr->NumPipeErrs;
-    }
-    else
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) && PipeDscPtr->ReadyHandler != NULL)
     {
-        ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
-
         /*
-         * Un-reference any previous buffer from the last call.
-         *
-         * NOTE: This is historical behavior where apps call CFE_SB_ReceiveBuffer()
-         * in the loop within the app's main task.  There is currently no separate
-         * API to "free" or unreference a buffer that was returned from SB.
-         *
-         * Instead, each time this function is invoked, it is implicitly interpreted
-         * as an indication that the caller is done with the previous buffer.
-         *
-         * Unfortunately this prevents pipe IDs from being serviced/shared across
-         * multiple child tasks in a worker pattern design.  This may be changed
-         * in a future version of CFE to decouple these actions, to allow for
-         * multiple workers to service the same pipe.
+         * The depth is incremented under the lock before the message is written to
+         * the queue, so a nonzero depth here means a sender is past the point where
+         * it checks the armed flag.  Notify now so the owner reads the pipe again.
          */
-        if (PipeDscPtr->LastBuffer != NULL)
+        if (PipeDscPtr->CurrentQueueDepth == 0)
         {
-            /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-            CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-            PipeDscPtr->LastBuffer = NULL;
+            PipeDscPtr->ReadyArmed = true;
+        }
+        else
+        {
+            PipeDscPtr->ReadyArmed = false;
+            Handler                = PipeDscPtr->ReadyHandler;
+            Arg                    = PipeDscPtr->ReadyArg;
         }
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (Handler != NULL)
+    {
+        Handler(PipeId, Arg);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1388,131 +3009,90 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
  * Not invoked outside of this unit
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr,
-                                       CFE_SB_PipeSetEntry_t     *ContextPtr,
-                                       CFE_SB_BufferD_t          *BufDscPtr,
-                                       CFE_SB_BufferD_t         **ParentBufDscPtrP)
+bool CFE_SB_ReceiveTxn_MultiPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                        CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                        void                      *Arg)
 {
-    CFE_SB_PipeD_t        *PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_ReceiveMultiState_t *StatePtr;
+    CFE_SB_BufferD_t           *BufDscPtr;
+    size_t                      BufDscSize;
+    int32                       OsTimeout;
+    bool                        IsSingleLane;
+    bool                        ShouldContinue;
 
-    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
-
-    /* Now re-lock to store the buffer in the pipe descriptor */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+    StatePtr       = Arg;
+    ShouldContinue = false;
 
     /*
-     * NOTE: This uses the same PipeDscPtr that was found earlier.
-     * But it has to be revalidated because its theoretically possible
-     * the pipe got deleted between now and then.
+     * With more than one lane, each lane is only checked here (highest priority first)
+     * and CFE_SB_ReceiveTxn_ExecuteMulti() waits on all of them if they are all empty
      */
-    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
+    IsSingleLane = (TxnPtr->NumPipes == 1);
+    if (IsSingleLane)
     {
-        /*
-        ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
-        ** ptr corresponding to the message just read. This is done so that
-        ** the buffer can be released on the next receive call for this pipe.
-        **
-        ** This counts as a new reference as it is being stored in the PipeDsc
-        */
-        CFE_SB_IncrBufUseCnt(BufDscPtr);
-        PipeDscPtr->LastBuffer = BufDscPtr;
-
-        /*
-         * Also set the Receivers pointer to the address of the actual message
-         * (currently this is "borrowing" the ref above, not its own ref)
-         */
-        *ParentBufDscPtrP = BufDscPtr;
-
-        /* get pointer to destination to be used in decrementing msg limit cnt*/
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
-
-        /*
-        ** DestPtr would be NULL if the msg is unsubscribed to while it is on
-        ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-        ** then resubscribed to while it is on the pipe. Both of these cases are
-        ** considered nominal and are handled by the code below.
-        */
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
-        {
-            DestPtr->BuffCount--;
-        }
-
-        if (PipeDscPtr->CurrentQueueDepth > 0)
-        {
-            --PipeDscPtr->CurrentQueueDepth;
-        }
+        OsTimeout = CFE_SB_MessageTxn_GetOsTimeout(TxnPtr);
     }
     else
     {
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
-
-        /* should send the bad pipe ID event here too */
-        ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
+        OsTimeout = OS_CHECK;
     }
 
-    /* Always decrement the use count, for the ref that was in the queue */
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
-
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-}
+    while (StatePtr->NumBuffers < StatePtr->MaxBuffers)
+    {
+        /* Read the buffer descriptor address from the queue.  */
+        ContextPtr->OsStatus =
+            OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OsTimeout);
 
-/*----------------------------------------------------------------
- *
- * Local Helper function
- * Not invoked outside of this unit
- *
- *-----------------------------------------------------------------*/
-bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
-{
-    CFE_SB_BufferD_t  *BufDscPtr;
-    CFE_SB_BufferD_t **ParentBufDscPtrP;
-    size_t             BufDscSize;
+        if (ContextPtr->OsStatus != OS_SUCCESS || BufDscPtr == NULL || BufDscSize != sizeof(BufDscPtr))
+        {
+            break;
+        }
 
-    ParentBufDscPtrP = Arg;
+        StatePtr->BufDscSet[StatePtr->NumBuffers] = BufDscPtr;
+        StatePtr->LaneSet[StatePtr->NumBuffers]   = ContextPtr->Lane;
+        ++StatePtr->NumBuffers;
 
-    /* Read the buffer descriptor address from the queue.  */
-    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId,
-                                       &BufDscPtr,
-                                       sizeof(BufDscPtr),
-                                       &BufDscSize,
-                                       CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+        /* Only the first read may wait, the rest of the batch is whatever is already in the queue */
+        OsTimeout = OS_CHECK;
+    }
 
     /*
-     * translate the return value -
-     *
-     * CFE functions have their own set of RC values should not directly return OSAL codes
-     * The size should always match.  If it does not, then generate CFE_SB_Q_RD_ERR_EID.
+     * translate the return value - same as CFE_SB_ReceiveTxn_PipeHandler() if nothing
+     * was read at all.  Once at least one buffer was read, the batch is simply cut short,
+     * but an off-nominal queue status is still reported as an event.
      */
-
-    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
+    if (StatePtr->NumBuffers == StatePtr->MaxBuffers)
     {
-        CFE_SB_ReceiveTxn_ExportReference(TxnPtr, ContextPtr, BufDscPtr, ParentBufDscPtrP);
+        /* nominal, batch is full */
     }
-    else
+    else if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
     {
-        *ParentBufDscPtrP = NULL;
-
-        if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
+        if (StatePtr->NumBuffers == 0 && IsSingleLane)
         {
             /* normal if using CFE_SB_POLL */
             CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_NO_MESSAGE);
         }
-        else if (ContextPtr->OsStatus == OS_QUEUE_TIMEOUT)
-        {
-            /* normal if using a nonzero timeout */
-            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
-        }
-        else
+
+        /* fill the rest of the batch from the next lane, if any */
+        ShouldContinue = true;
+    }
+    else if (ContextPtr->OsStatus == OS_QUEUE_TIMEOUT)
+    {
+        /* normal if using a nonzero timeout, can only happen on the first read */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+    }
+    else
+    {
+        /* off-nominal condition, report an error event */
+        if (StatePtr->NumBuffers == 0)
         {
-            /* off-nominal condition, report an error event */
             CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
-            ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
         }
+        ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
     }
 
-    /* Read ops only process one pipe */
-    return false;
+    /* Read ops only process one pipe, but may process more than one lane of it */
+    return ShouldContinue;
 }
 
 /*----------------------------------------------------------------
@@ -1521,78 +3101,178 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr)
+uint32 CFE_SB_ReceiveTxn_ExecuteMulti(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                      CFE_SB_Buffer_t          **BufPtrSet,
+                                      uint32                     MaxBuffers)
 {
-    CFE_SB_BufferD_t      *BufDscPtr;
-    const CFE_SB_Buffer_t *Result;
-    bool                   IsAcceptable;
-    CFE_Status_t           Status;
+    CFE_SB_BufferD_t          *BufDscSet[CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE];
+    uint8                      LaneSet[CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE];
+    bool                       AcceptSet[CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE];
+    CFE_SB_ReceiveMultiState_t MultiState;
+    CFE_SB_PipeSetEntry_t     *ContextPtr;
+    CFE_SB_PipeD_t            *PipeDscPtr;
+    CFE_SB_DestinationD_t     *DestPtr;
+    CFE_SB_BufferD_t          *BufDscPtr;
+    CFE_Status_t               Status;
+    bool                       IsValidPipe;
+    uint32                     NumReceived;
+    uint32                     NumRejected;
+    uint32                     i;
+    int32                      WaiterIdx;
+    uint64                     NowTicks;
+
+    if (MaxBuffers > CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE)
+    {
+        MaxBuffers = CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE;
+    }
+
+    MultiState.BufDscSet  = BufDscSet;
+    MultiState.LaneSet    = LaneSet;
+    MultiState.MaxBuffers = MaxBuffers;
+    MultiState.NumBuffers = 0;
+
+    NumReceived          = 0;
+    WaiterIdx            = -1;
+    TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
+    TxnPtr->ContentSize  = 0;
+
+    while (NumReceived == 0 && CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        MultiState.NumBuffers = 0;
+        CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveTxn_MultiPipeHandler, TxnPtr, &MultiState);
+
+        /* If nothing received, then quit, or wait on all lanes if the pipe has more than one */
+        if (MultiState.NumBuffers == 0)
+        {
+            if (TxnPtr->NumPipes > 1 && CFE_SB_MessageTxn_IsOK(TxnPtr))
+            {
+                CFE_SB_PipeWaiter_Wait(TxnPtr, &WaiterIdx);
+                continue;
+            }
+            break;
+        }
 
-    Result = NULL;
+        /* Verify all buffers before taking the lock, same as a single receive */
+        for (i = 0; i < MultiState.NumBuffers; ++i)
+        {
+            BufDscPtr = BufDscSet[i];
 
-    while (CFE_SB_MessageTxn_IsOK(TxnPtr))
-    {
-        BufDscPtr = NULL;
+            if (TxnPtr->IsEndpoint)
+            {
+                Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &AcceptSet[i]);
+                if (Status != CFE_SUCCESS)
+                {
+                    /* This typically should not happen - only if VerificationAction got bad arguments */
+                    AcceptSet[i] = false;
+                }
+            }
+            else
+            {
+                /* If no verification being done at this stage - consider everything "good" */
+                AcceptSet[i] = true;
+            }
+        }
 
-        /*
-         * Read from the pipe(s).  Currently this is just one but someday could
-         * become more than one e.g. a high-pri and a low-pri queue.
-         */
-        CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveTxn_PipeHandler, TxnPtr, &BufDscPtr);
+        ContextPtr  = TxnPtr->PipeSet;
+        PipeDscPtr  = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+        NumRejected = 0;
 
-        /* If nothing received, then quit */
-        if (BufDscPtr == NULL)
+        /* One timebase read serves the whole set */
+        NowTicks = 0;
+        if (CFE_SB_Global.LatencyStatsEnabled)
         {
-            TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
-            TxnPtr->ContentSize  = 0;
-            Result               = NULL;
-            break;
+            NowTicks = CFE_SB_GetTimebaseTicks();
         }
 
-        if (TxnPtr->IsEndpoint)
+        /* Now re-lock once to store all the buffers in the pipe descriptor */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /*
+         * NOTE: This uses the same PipeDscPtr that was found earlier.
+         * But it has to be revalidated because its theoretically possible
+         * the pipe got deleted between now and then.
+         */
+        IsValidPipe = CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId);
+
+        for (i = 0; i < MultiState.NumBuffers; ++i)
         {
-            Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
-            if (Status != CFE_SUCCESS)
+            BufDscPtr = BufDscSet[i];
+
+            if (IsValidPipe)
             {
-                /* This typically should not happen - only if VerificationAction got bad arguments */
-                IsAcceptable = false;
+                /* see CFE_SB_ReceiveTxn_ExportReference() for handling of BuffCount */
+                DestPtr = CFE_SB_GetBufferDestPtr(BufDscPtr, ContextPtr->PipeId);
+                if (DestPtr != NULL && DestPtr->BuffCount > 0)
+                {
+                    DestPtr->BuffCount--;
+                }
+
+                if (PipeDscPtr->CurrentQueueDepth > 0)
+                {
+                    --PipeDscPtr->CurrentQueueDepth;
+                }
+
+                if (PipeDscPtr->Lane[LaneSet[i]].CurrentQueueDepth > 0)
+                {
+                    --PipeDscPtr->Lane[LaneSet[i]].CurrentQueueDepth;
+                }
+
+                if (CFE_SB_Global.LatencyStatsEnabled)
+                {
+                    CFE_SB_RecordLatency(PipeDscPtr, BufDscPtr, NowTicks);
+                }
+
+                if (AcceptSet[i] && PipeDscPtr->LastBatchCount < CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE)
+                {
+                    /* This counts as a new reference as it is being stored in the PipeDsc */
+                    CFE_SB_IncrBufUseCnt(BufDscPtr);
+                    PipeDscPtr->LastBatch[PipeDscPtr->LastBatchCount] = BufDscPtr;
+                    ++PipeDscPtr->LastBatchCount;
+
+                    /* The transaction reflects the first buffer in the set, for event reporting purposes */
+                    if (NumReceived == 0)
+                    {
+                        TxnPtr->RoutingMsgId = BufDscPtr->MsgId;
+                        TxnPtr->ContentSize  = BufDscPtr->ContentSize;
+                    }
+
+                    BufPtrSet[NumReceived] = &BufDscPtr->Content;
+                    ++NumReceived;
+                }
+                else
+                {
+                    ++NumRejected;
+                }
             }
+
+            /* Always decrement the use count, for the ref that was in the queue */
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
         }
-        else
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        if (!IsValidPipe)
         {
-            /* If no verification being done at this stage - consider everything "good" */
-            IsAcceptable = true;
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+
+            /* should send the bad pipe ID event here too */
+            ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
         }
 
-        if (IsAcceptable)
+        /* Report an event for each buffer being dropped */
+        while (NumRejected > 0)
         {
-            /*
-             * Replicate the buffer descriptor MsgId and ContentSize in the transaction.
-             *
-             * This does not use the functions that check the values because that will
-             * send an event and set an error status if they are bad.  But on the recv side,
-             * it is already here - whatever we got should be returned.  Error checking for
-             * size and MsgId should have been done on the transmit side, so they should never
-             * be bad at this point.
-             */
-            TxnPtr->RoutingMsgId = BufDscPtr->MsgId;
-            TxnPtr->ContentSize  = BufDscPtr->ContentSize;
-            Result               = &BufDscPtr->Content;
-            break;
+            CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, ContextPtr, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+            --NumRejected;
         }
+    }
 
-        /* Report an event indicating the buffer is being dropped */
-        CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, TxnPtr->PipeSet, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
-
-        /*
-         * Also need to re-set the PipeId for proper accounting.  This buffer will be dropped,
-         * and this decrements the use count and removes it from the LastBuffer pointer in the
-         * Pipe Descriptor
-         */
-        CFE_SB_ReceiveTxn_SetPipeId(TxnPtr, TxnPtr->PipeSet->PipeId);
+    if (WaiterIdx >= 0)
+    {
+        CFE_SB_PipeWaiter_Unregister(TxnPtr, WaiterIdx);
     }
 
-    return Result;
+    return NumReceived;
 }
 
 /*----------------------------------------------------------------
@@ -82,6 +82,18 @@
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
 
+/*
+ * Number of entries in the route presence table, message IDs share
+ * an entry based on their value modulo this size
+ */
+#define CFE_SB_ROUTE_PRESENCE_SIZE (4 * CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/*
+ * Number of tasks that can wait in CFE_SB_ReceiveBufferAny() at the same
+ * time, each one is a bit in the waiter mask of the pipe descriptor
+ */
+#define CFE_SB_MAX_PIPE_WAITERS 32
+
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
 #define CFE_SB_USECNT_ERR    (-3)
@@ -155,6 +167,14 @@ typedef struct CFE_SB_BufferD
 
     uint16 UseCount; /**< Number of active references to this buffer in the system */
 
+    uint64 TransmitTicks; /**< PSP timebase when the message was sent, if latency stats are enabled */
+
+    /**
+     * Rest of the message following the content, if sent with CFE_SB_TransmitSegments().
+     * ContentSize is then only the part of the message in this buffer.
+     */
+    const CFE_SB_SegmentList_t *SegmentList;
+
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
 
@@ -177,9 +197,79 @@ typedef struct
     uint16            MaxQueueDepth;
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
+    uint16            LastBatchCount;
+    uint32            WaiterMask;
     CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_BufferD_t *LastBatch[CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE];
+
+    /*
+     * Queue of the high priority lane, SysQueueId is the normal priority lane.
+     * This is only created on the first high priority subscription to the pipe.
+     */
+    osal_id_t              PriorityQueueId;
+    CFE_SB_PipeLaneStats_t Lane[CFE_SB_PIPE_LANE_COUNT];
+
+    /* Time messages spent in the pipe, see CFE_SB_RecordLatency() */
+    CFE_SB_LatencyHistogram_t Latency;
+
+    /*
+     * Readiness notification, see CFE_SB_SetPipeReadyHandler().  The handler
+     * is only called when armed, which is when the owner found the pipe empty.
+     */
+    CFE_SB_PipeReadyHandler_t ReadyHandler;
+    void                     *ReadyArg;
+    bool                      ReadyArmed;
+
+    /* If set, messages are passed to this instead of the queue, see CFE_SB_SetPipeTransport() */
+    CFE_SB_PipeTransportFunc_t TransportFunc;
+    void                      *TransportArg;
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeWaiter_t
+**
+**  Purpose:
+**     This structure holds the semaphore used to wake a task that is waiting
+**     on a set of pipes in CFE_SB_ReceiveBufferAny().  The semaphore is created
+**     on first use of the entry and kept for later waiters.
+*/
+typedef struct
+{
+    bool      InUse;
+    osal_id_t SemId;
+} CFE_SB_PipeWaiter_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_MaskSub_t
+**
+**  Purpose:
+**     This structure holds a mask subscription, see CFE_SB_SubscribeMask().
+**     A message ID matches if its value has the same bits as MsgIdValue in
+**     all bits that are set in Mask.  The entry is free if PipeId is not valid.
+*/
+typedef struct
+{
+    CFE_SB_PipeId_t     PipeId;
+    CFE_SB_MsgId_Atom_t MsgIdValue; /**< Already masked */
+    CFE_SB_MsgId_Atom_t Mask;
+    uint16              MsgLim;
+    uint8               Priority;
+} CFE_SB_MaskSub_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufCacheClass_t
+**
+**  Purpose:
+**     This structure holds released buffers of a single SB pool block size,
+**     so they can be re-used without returning them to the pool.
+*/
+typedef struct
+{
+    size_t            BlockSize;
+    uint16            Count;
+    CFE_SB_BufferD_t *Entries[CFE_PLATFORM_SB_BUF_CACHE_DEPTH];
+} CFE_SB_BufCacheClass_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -188,7 +278,9 @@ typedef struct
 */
 typedef struct
 {
-    CFE_ES_MemHandle_t PoolHdl;
+    CFE_ES_MemHandle_t     PoolHdl;
+    uint16                 NumCacheClasses;
+    CFE_SB_BufCacheClass_t Cache[CFE_PLATFORM_SB_POOL_MAX_BUCKETS];
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
 } CFE_SB_MemParams_t;
 
@@ -208,13 +300,14 @@ typedef struct
 /**
  * \brief Temporary holding buffer for records being written to a file.
  *
- * This is shared/reused between all file types (msg map, route info, pipe info).
+ * This is shared/reused between all file types (msg map, route info, pipe info, latency info).
  */
 typedef union
 {
     CFE_SB_BackgroundRouteInfoBuffer_t RouteInfo;
     CFE_SB_PipeInfoEntry_t             PipeInfo;
     CFE_SB_MsgMapFileEntry_t           MsgMapInfo;
+    CFE_SB_LatencyFileEntry_t          LatencyInfo;
 } CFE_SB_BackgroundFileBuffer_t;
 
 /**
@@ -257,6 +350,29 @@ typedef struct
 
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
+
+    /* A list of buffers whose segment lists are released once the lock is given */
+    CFE_SB_BufferLink_t SegmentReleaseList;
+
+    /* Number of routes for the message IDs sharing each entry, see CFE_SB_IsRoutePresent() */
+    uint16 RoutePresence[CFE_SB_ROUTE_PRESENCE_SIZE];
+
+    /* Incremented whenever message IDs may be routed differently, see CFE_SB_SetRouteHandle() */
+    uint32 RouteGeneration;
+
+    /* Tasks waiting on a set of pipes, see CFE_SB_ReceiveBufferAny() */
+    CFE_SB_PipeWaiter_t PipeWaiter[CFE_SB_MAX_PIPE_WAITERS];
+
+    /* Mask subscriptions, see CFE_SB_SubscribeMask() */
+    uint16           MaskSubsInUse;
+    CFE_SB_MaskSub_t MaskSub[CFE_PLATFORM_SB_MAX_MASK_SUBS];
+
+    /* Message latency statistics, see CFE_SB_RecordLatency() */
+    bool                      LatencyStatsEnabled;
+    uint32                    TimebaseTicksPerSecond;
+    uint32                    TimebaseLow32Rollover;
+    CFE_SB_LatencyHistogram_t RouteLatency[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    CFE_SB_LatencyTlm_t       LatencyTlmMsg;
 } CFE_SB_Global_t;
 
 /******************************************************************************
@@ -264,10 +380,16 @@ typedef struct
  */
 typedef struct
 {
-    CFE_SB_PipeId_t PipeId;
-    osal_id_t       SysQueueId;
-    uint16          PendingEventId;
-    int32           OsStatus;
+    CFE_SB_PipeId_t            PipeId;
+    osal_id_t                  SysQueueId;
+    uint16                     PendingEventId;
+    uint8                      Lane; /**< Lane of the pipe that SysQueueId belongs to */
+    int32                      OsStatus;
+    CFE_SB_PipeReadyHandler_t  ReadyHandler; /**< Set if the pipe readiness handler is to be called */
+    void                      *ReadyArg;
+    CFE_SB_PipeTransportFunc_t TransportFunc; /**< Set if the message goes to the transport instead of SysQueueId */
+    void                      *TransportArg;
+    bool                       UseContiguous; /**< Set if the pipe gets the contiguous copy of a segmented message */
 } CFE_SB_PipeSetEntry_t;
 
 typedef enum
@@ -302,8 +424,14 @@ typedef struct
     size_t         ContentSize;
     CFE_SB_MsgId_t RoutingMsgId;
 
+    CFE_MSG_SequenceCount_t SequenceCount;
+
     const void *RefMemPtr;
 
+    CFE_SB_BufferD_t *ContiguousBufDscPtr; /**< Copy of a segmented message, see CFE_SB_TransmitTxn_MakeContiguous() */
+
+    CFE_SB_RouteHandle_t *RouteHandlePtr; /**< Route resolved by the caller, see CFE_SB_TransmitTxn_SetRouteHandle() */
+
     CFE_SB_PipeSetEntry_t *PipeSet;
 } CFE_SB_MessageTxn_State_t;
 
@@ -332,9 +460,46 @@ typedef struct
 {
     CFE_SB_MessageTxn_State_t MessageTxn_State;
 
-    CFE_SB_PipeSetEntry_t Source;
+    CFE_SB_PipeSetEntry_t Source[CFE_SB_PIPE_LANE_COUNT]; /**< One entry for each lane of the pipe */
 } CFE_SB_ReceiveTxn_State_t;
 
+/**
+ * \brief Tracks the status of a receive transaction over a set of pipes
+ *
+ * Same as CFE_SB_ReceiveTxn_State_t, but with room for every lane of the largest
+ * set of pipes a caller may pass
+ */
+typedef struct
+{
+    CFE_SB_MessageTxn_State_t MessageTxn_State;
+
+    CFE_SB_PipeSetEntry_t SourceSet[CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES * CFE_SB_PIPE_LANE_COUNT];
+} CFE_SB_ReceiveAnyTxn_State_t;
+
+/**
+ * \brief Tracks the buffer read during a receive transaction over a set of pipes
+ *
+ * This is passed as the opaque argument to CFE_SB_ReceiveAnyTxn_PipeHandler()
+ */
+typedef struct
+{
+    CFE_SB_BufferD_t      *BufDscPtr; /**< Buffer that was read, NULL if none */
+    CFE_SB_PipeSetEntry_t *SourcePtr; /**< Pipe entry the buffer was read from */
+} CFE_SB_ReceiveAnyState_t;
+
+/**
+ * \brief Tracks the set of buffers read during a multi-buffer receive transaction
+ *
+ * This is passed as the opaque argument to CFE_SB_ReceiveTxn_MultiPipeHandler()
+ */
+typedef struct
+{
+    CFE_SB_BufferD_t **BufDscSet;
+    uint8             *LaneSet; /**< Lane each buffer in BufDscSet was read from */
+    uint32             MaxBuffers;
+    uint32             NumBuffers;
+} CFE_SB_ReceiveMultiState_t;
+
 typedef bool (*CFE_SB_MessageTxn_PipeHandler_t)(CFE_SB_MessageTxn_State_t *, CFE_SB_PipeSetEntry_t *, void *);
 
 /*
@@ -446,6 +611,19 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t  MsgId,
                            uint16          MsgLim,
                            uint8           Scope);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Creates the high priority lane of a pipe, if it does not have one already
+ *
+ * The lane is a second OS queue of the same depth as the pipe.  This is called
+ * for a high priority subscription before the subscription is added.  If the
+ * queue can not be created, messages for the subscription use the normal lane.
+ *
+ * @param PipeId   The Pipe ID to add the lane to
+ * @param AppId    The calling application, nothing is done unless it owns the pipe
+ */
+void CFE_SB_CreatePriorityLane(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Unsubscribe a Message ID from a pipe
@@ -586,6 +764,27 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
  */
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the transaction states for one chunk of a batch transmit from the SB memory pool
+ *
+ * The block holds #CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE entries.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ * @return Pointer to the first transaction state, or NULL if the pool is exhausted
+ */
+CFE_SB_TransmitTxn_State_t *CFE_SB_GetTransmitBatchBlk(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns a block from CFE_SB_GetTransmitBatchBlk() to the SB memory pool
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param TxnSet Pointer to the first transaction state
+ */
+void CFE_SB_PutTransmitBatchBlk(CFE_SB_TransmitTxn_State_t *TxnSet);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief For SB buffer tracking, get first/next position in a list
@@ -655,13 +854,93 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
  * \brief Returns a buffer to SB memory pool
  *
  * This function will return a block of memory back to the SB memory pool,
- * so it can be re-used for a future message
+ * so it can be re-used for a future message.  A buffer with a segment list
+ * to release is instead kept until the SB global lock is given, so the
+ * release function is not called with the lock held.
  *
  * @note This must only be invoked while holding the SB global lock
  * \param[in] bd Pointer to descriptor to return
  */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases the segment lists of buffers and returns them to the pool
+ *
+ * Calls the release function of the segment list of every buffer in the
+ * list, then takes the SB global lock to return the buffers to the pool.
+ * Used by CFE_SB_UnlockSharedData() for buffers that were returned while
+ * the lock was held.
+ *
+ * @note This must only be invoked while NOT holding the SB global lock
+ * \param[in] List Head of a list of buffers that nothing else refers to
+ */
+void CFE_SB_ReleaseSegmentLists(CFE_SB_BufferLink_t *List);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initializes the SB buffer cache
+ *
+ * Sets up one cache class for each block size of the SB memory pool, in
+ * increasing order of size, so that a buffer is always cached in the class
+ * corresponding to the pool bucket it was allocated from.  All classes
+ * are initially empty.
+ *
+ * \param[in] NumBlockSizes Number of entries in BlockSizeList
+ * \param[in] BlockSizeList Block sizes of the SB memory pool
+ */
+void CFE_SB_BufCacheInit(size_t NumBlockSizes, const size_t *BlockSizeList);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Finds the SB buffer cache class for an allocation size
+ *
+ * This uses the same selection as the memory pool, the smallest block size
+ * that is able to hold the allocation.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] AllocSize Total size of the allocation, including the descriptor
+ * \returns Pointer to cache class, or NULL if no block size is large enough
+ */
+CFE_SB_BufCacheClass_t *CFE_SB_BufCacheFindClass(size_t AllocSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the current PSP timebase as a single tick count
+ *
+ * Same as CFE_ES_GetTimebaseTicks(), with the rollover value of the lower
+ * register that was read when SB was initialized.
+ *
+ * \returns Current timebase, in ticks of CFE_SB_Global.TimebaseTicksPerSecond
+ */
+uint64 CFE_SB_GetTimebaseTicks(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds one message to a latency histogram
+ *
+ * \param[inout] HistPtr Histogram to update
+ * \param[in]    Latency Time the message spent in the pipe, in microseconds
+ */
+void CFE_SB_LatencyHistogram_Add(CFE_SB_LatencyHistogram_t *HistPtr, uint32 Latency);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Records the time a message spent in a pipe
+ *
+ * Adds the time since the buffer was sent to the latency histograms of the
+ * pipe and of the route the buffer was sent on.  Only called when latency
+ * statistics are enabled.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] PipeDscPtr Pipe the message was received from
+ * \param[in]    BufDscPtr  Buffer that was received
+ * \param[in]    NowTicks   Current timebase, from CFE_SB_GetTimebaseTicks()
+ */
+void CFE_SB_RecordLatency(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr, uint64 NowTicks);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Perform basic sanity check on the Zero Copy handle
@@ -673,6 +952,22 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  */
 int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Perform basic sanity check on a buffer received from a pipe
+ *
+ * Checks that the descriptor of the buffer is a block of the SB memory pool
+ * before it is read, and that the buffer is still in use.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]  BufPtr pointer to the content buffer
+ * \param[out] BufDscPtr Will be set to actual buffer descriptor
+ *
+ * \returns CFE_SUCCESS if validation passed, or error code.
+ */
+int32 CFE_SB_ReceivedBufferValidate(const CFE_SB_Buffer_t *BufPtr, const CFE_SB_BufferD_t **BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Add a destination node
@@ -713,6 +1008,140 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
  */
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Update the route presence table when a route is added or removed
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] MsgId     The message ID of the route
+ * \param[in] IsPresent true if the route was added, false if it was removed
+ */
+void CFE_SB_SetRoutePresence(CFE_SB_MsgId_t MsgId, bool IsPresent);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Quick check whether a route may exist for a message ID
+ *
+ * Private function used to skip work for messages that have no subscribers
+ * before the SB shared data lock is taken.  As message IDs share entries in
+ * the presence table, this may return true when there is no route, but it
+ * does not return false when a route exists.
+ *
+ * \note Must be called without the SB shared data lock, which is only taken
+ *       to check the mask subscriptions when there are any.  A route being added
+ *       concurrently may not be seen, which is equivalent to the check having
+ *       been done just before the route was added.
+ *
+ * \param[in] MsgId The message ID to check
+ *
+ * \returns false if there is definitely no route (or matching mask subscription) for the message ID
+ */
+bool CFE_SB_IsRoutePresent(CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds a route for a message ID and updates the route statistics
+ *
+ * \note Must be called while holding the SB shared data lock.  Assumes there
+ *       is no route for the message ID yet.
+ *
+ * \param[in]  MsgId         The message ID of the route
+ * \param[out] CollisionsPtr Number of collisions (if not null)
+ *
+ * \returns Route ID, will be invalid if the routing table is full
+ */
+CFE_SBR_RouteId_t CFE_SB_AddRouteEntry(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes a route that has no destinations and updates the route statistics
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] RouteId The route, must be valid
+ */
+void CFE_SB_RemoveRouteEntry(CFE_SBR_RouteId_t RouteId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the route for a message ID, adding it for mask subscriptions
+ *
+ * If there is no route for the message ID but it matches a mask subscription,
+ * the route is added with the destinations of all matching mask subscriptions.
+ * Later lookups then find the route directly.
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] MsgId The message ID
+ *
+ * \returns Route ID, will be invalid if there are no subscribers
+ */
+CFE_SBR_RouteId_t CFE_SB_LookupRoute(CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Stores a resolved route in a route handle
+ *
+ * The handle is marked with the current route generation, so it is known to be stale
+ * once a subscription changes.  Must be called with the SB shared data locked.
+ *
+ * \param[out] HandlePtr Handle to update
+ * \param[in]  MsgId     Message ID the route was resolved for
+ * \param[in]  RouteId   Route of the message ID, may be invalid if there is none
+ */
+void CFE_SB_SetRouteHandle(CFE_SB_RouteHandle_t *HandlePtr, CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Checks whether a message ID matches a mask subscription
+ *
+ * \param[in] MaskSubPtr The mask subscription, must be in use
+ * \param[in] MsgId      The message ID
+ *
+ * \returns true if the message ID matches
+ */
+bool CFE_SB_MaskSubMatches(const CFE_SB_MaskSub_t *MaskSubPtr, CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Checks whether any mask subscription of a pipe matches a message ID
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] PipeId The pipe, or an undefined pipe ID to check the mask subscriptions of all pipes
+ * \param[in] MsgId  The message ID
+ *
+ * \returns Pointer to the first matching mask subscription, or NULL if none match
+ */
+CFE_SB_MaskSub_t *CFE_SB_FindMaskSub(CFE_SB_PipeId_t PipeId, CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds the destination for a mask subscription to a route
+ *
+ * Nothing is added if the pipe already has a destination in the route, or the
+ * route has the maximum number of destinations.
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] RouteId    The route, must be valid
+ * \param[in] MaskSubPtr The mask subscription
+ *
+ * \returns true if a destination was added
+ */
+bool CFE_SB_AddMaskDest(CFE_SBR_RouteId_t RouteId, const CFE_SB_MaskSub_t *MaskSubPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds the destinations of all matching mask subscriptions to a new route
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[in] RouteId The route, must be valid
+ */
+void CFE_SB_ApplyMaskSubs(CFE_SBR_RouteId_t RouteId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Get destination pointer for PipeId from RouteId
@@ -727,6 +1156,22 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  */
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get destination pointer for PipeId from the route a buffer was sent on
+ *
+ * Same as CFE_SB_GetDestPtr() using the DestRouteId of the buffer, but also
+ * checks the route still belongs to the message ID of the buffer.  The route
+ * of a buffer still queued on a pipe may have been removed and reused for
+ * another message ID.
+ *
+ * \param[in] BufDscPtr The buffer descriptor
+ * \param[in] PipeId    The pipe ID to search for
+ *
+ * \returns The destination pointer for a match, NULL otherwise
+ */
+CFE_SB_DestinationD_t *CFE_SB_GetBufferDestPtr(const CFE_SB_BufferD_t *BufDscPtr, CFE_SB_PipeId_t PipeId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Get the size of a message header.
@@ -924,6 +1369,19 @@ void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeo
  */
 void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEndpoint);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Sets the route handle to use for a transmit transaction
+ *
+ * If the handle is still current and was resolved for the message ID of the transaction,
+ * its route is used as is, without looking up the message ID.  Otherwise the message ID
+ * is looked up as usual, and the handle is updated with the result.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] HandlePtr Route handle of the caller
+ */
+void CFE_SB_TransmitTxn_SetRouteHandle(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_RouteHandle_t *HandlePtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Helper function to get the OSAL timeout to use
@@ -1050,6 +1508,19 @@ CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *Txn
  */
 void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds a Pipe ID to read to a receive transaction
+ *
+ * Same as CFE_SB_ReceiveTxn_SetPipeId(), but keeps the pipes that were already set, for
+ * a receive transaction over a set of pipes.  Any buffers retained from the previous
+ * receive call on the pipe are released.
+ *
+ * \param[inout] TxnPtr  Transaction object
+ * \param[in]    PipeId  Pipe ID to read from
+ */
+void CFE_SB_ReceiveTxn_AddPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Pipe handler function for receive transactions
@@ -1096,6 +1567,145 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
  */
 const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pipe handler function for multi-buffer receive transactions
+ *
+ * Helper function to implement reading of a pipe during a multi-buffer receive transaction.
+ * The first read uses the timeout of the transaction, after which the pipe is polled until
+ * it is empty or the set is full.  This is only used via CFE_SB_MessageTxn_ProcessPipes(),
+ * but declared here so it can be unit tested.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] Arg        Opaque argument for API, should be a CFE_SB_ReceiveMultiState_t*
+ * \returns always false to stop the parent loop (receive transactions only read a single pipe)
+ */
+bool CFE_SB_ReceiveTxn_MultiPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                        CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                        void                      *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a multi-buffer receive transaction
+ *
+ * Similar to CFE_SB_ReceiveTxn_Execute() but reads up to MaxBuffers from the pipe, and
+ * stores all of them in the pipe descriptor under a single acquisition of the SB lock.
+ * The references are released on the next receive call for the same pipe.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[out]   BufPtrSet  Array to store the buffer pointers that were read
+ * \param[in]    MaxBuffers Size of BufPtrSet, limited to #CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE
+ * \returns Number of buffers stored in BufPtrSet, 0 if no message was read
+ */
+uint32 CFE_SB_ReceiveTxn_ExecuteMulti(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                      CFE_SB_Buffer_t          **BufPtrSet,
+                                      uint32                     MaxBuffers);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initialize a receive transaction over a set of pipes
+ *
+ * Same as CFE_SB_ReceiveTxn_Init(), pipes are then added with CFE_SB_ReceiveTxn_AddPipeId().
+ *
+ * \param[out] TxnPtr    Transaction object to initialize
+ * \param[in]  RefMemPtr Pointer to user object/buffer being received (opaque)
+ */
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveAnyTxn_Init(CFE_SB_ReceiveAnyTxn_State_t *TxnPtr, const void *RefMemPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pipe handler function for receive transactions over a set of pipes
+ *
+ * Polls the pipe, and stops the parent loop at the first pipe that has a message
+ * or that can not be read.  Empty pipes are skipped.  This is only used via
+ * CFE_SB_MessageTxn_ProcessPipes(), but declared here so it can be unit tested.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] Arg        Opaque argument for API, should be a CFE_SB_ReceiveAnyState_t*
+ * \returns true to continue with the next pipe if this pipe is empty
+ */
+bool CFE_SB_ReceiveAnyTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                      CFE_SB_PipeSetEntry_t     *ContextPtr,
+                                      void                      *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a receive transaction over a set of pipes
+ *
+ * Reads the first message available from any of the pipes, which are checked in the
+ * order they were added.  If all pipes are empty, the calling task waits until a
+ * message is written to any of them or the timeout of the transaction expires.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[out]   PipeIdPtr  Set to the pipe the message was read from
+ * \returns Pointer to buffer that was read
+ * \retval  NULL if no message was read (e.g. if a timeout occurred or polling empty queues)
+ */
+const CFE_SB_Buffer_t *CFE_SB_ReceiveAnyTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t *PipeIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Registers the calling task as waiting on the pipes of a receive transaction
+ *
+ * Gets a free waiter entry, creating its semaphore if needed, and sets its bit in the
+ * waiter mask of all pipes of the transaction.
+ *
+ * \param[in] TxnPtr  Transaction object
+ * \returns Index of the waiter entry
+ * \retval  -1 if no entry is available or the semaphore can not be created
+ */
+int32 CFE_SB_PipeWaiter_Register(const CFE_SB_MessageTxn_State_t *TxnPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes a waiter registered with CFE_SB_PipeWaiter_Register()
+ *
+ * \param[in] TxnPtr    Transaction object, same as passed to CFE_SB_PipeWaiter_Register()
+ * \param[in] WaiterIdx Index of the waiter entry
+ */
+void CFE_SB_PipeWaiter_Unregister(const CFE_SB_MessageTxn_State_t *TxnPtr, int32 WaiterIdx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Waits for a message on any pipe of a receive transaction
+ *
+ * Called after all pipes of the transaction were found empty.  The first call only
+ * registers the waiter, the caller must then check all pipes again before the next
+ * call actually waits.  The transaction status is set if the wait should end, that
+ * is on a timeout (or if polling) or an error.
+ *
+ * \param[inout] TxnPtr        Transaction object
+ * \param[inout] WaiterIdxPtr  Waiter entry index, must be -1 on the first call
+ */
+void CFE_SB_PipeWaiter_Wait(CFE_SB_MessageTxn_State_t *TxnPtr, int32 *WaiterIdxPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Wakes the tasks in the waiter mask of a pipe
+ *
+ * This does not require the SB lock, the waiter semaphores are never deleted.
+ *
+ * \param[in] WaiterMask Waiter mask from the pipe descriptor
+ */
+void CFE_SB_PipeWaiter_Wake(uint32 WaiterMask);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Arms the readiness notification of a pipe
+ *
+ * Called when the owner of the pipe found it empty.  If a message was already
+ * accounted for in the pipe depth by then, the handler is called right away
+ * instead, so a message that was in the middle of being sent is not missed.
+ * Has no effect if the pipe has no readiness handler.
+ *
+ * \note Must be called without the SB lock held.
+ *
+ * \param[in] PipeId The pipe that was found empty
+ */
+void CFE_SB_PipeReady_Arm(CFE_SB_PipeId_t PipeId);
+
 /*
  * Transmit Transaction implementation/helper functions
  * These functions are specific to the transmit-side operation
@@ -1157,6 +1767,51 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  */
 void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Marks a transmit transaction as having no subscribers
+ *
+ * Increments the no subscribers counter and sets the pending event.  The
+ * status of the transaction remains successful, as this is not an error.
+ *
+ * \note Must be called while holding the SB shared data lock
+ *
+ * \param[inout] TxnPtr Transaction object
+ */
+void CFE_SB_TransmitTxn_SetNoSubscribers(CFE_SB_MessageTxn_State_t *TxnPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Resolve the route of a transmit transaction into a set of destination pipes
+ *
+ * This is the portion of CFE_SB_TransmitTxn_FindDestinations() that operates on the
+ * routing tables.  It is separated so that several transactions can be resolved under
+ * a single acquisition of the SB lock.
+ *
+ * \note The caller must hold the SB global lock when invoking this function.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
+ * \param[in]    AppId     The application that is transmitting the buffer
+ */
+void CFE_SB_TransmitTxn_ResolveRoute(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                     CFE_SB_BufferD_t          *BufDscPtr,
+                                     CFE_ES_AppId_t             AppId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Perform origination actions on a transmit transaction, if applicable
+ *
+ * If the transaction is still OK and is marked as an endpoint, this sets the
+ * sequence count obtained by CFE_SB_TransmitTxn_ResolveRoute() and invokes
+ * CFE_MSG_OriginationAction() on the buffer content.  The SB lock must NOT
+ * be held when calling this function.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
+ */
+void CFE_SB_TransmitTxn_Originate(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Pipe handler function for transmit transactions
@@ -1195,6 +1850,80 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
  */
 void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes the transmit transaction for a copy of a message
+ *
+ * Internal routine used by CFE_SB_TransmitMsg() that gets a buffer for the message
+ * and resolves the route under the same acquisition of the SB lock, then copies the
+ * message into the buffer and broadcasts it.  The buffer is never tracked as a zero
+ * copy buffer, and is not cleared before the copy as it is entirely overwritten.
+ *
+ * If there are no subscribers the message is not copied, and the buffer is released.
+ * Any errors or off-nominal events that occur will be stored in the transaction object
+ * for deferred reporting via CFE_SB_TransmitTxn_ReportEvents().
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[in]    MsgPtr    Message to copy, of the content size set in the transaction
+ */
+void CFE_SB_TransmitTxn_ExecuteCopy(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Makes the contiguous copy of a segmented message, if any pipe needs it
+ *
+ * Internal routine used by CFE_SB_TransmitTxn_ExecuteSegments() after the route has
+ * been resolved.  Pipes that do not have the #CFE_SB_PIPEOPTS_SEGMENTS option, or that
+ * have a transport, get a copy of the whole message in a single buffer.  The buffer
+ * references of those pipes are moved to the copy, which is stored in the transaction.
+ * If the copy can not be allocated, the transaction is left without one, and the
+ * write to those pipes fails in CFE_SB_TransmitTxn_PipeHandler().
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[in]    BufDscPtr Buffer holding the start of the message
+ */
+void CFE_SB_TransmitTxn_MakeContiguous(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes the transmit transaction for a message sent in segments
+ *
+ * Same as CFE_SB_TransmitTxn_Execute(), except that the message content size in the
+ * transaction includes the segments, which follow the part of the message in the buffer.
+ * The segment list is attached to the buffer, and released along with it.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[inout] BufPtr     Buffer object holding the start of the message
+ * \param[in]    SegListPtr Segments holding the rest of the message
+ */
+void CFE_SB_TransmitTxn_ExecuteSegments(CFE_SB_MessageTxn_State_t  *TxnPtr,
+                                        CFE_SB_Buffer_t            *BufPtr,
+                                        const CFE_SB_SegmentList_t *SegListPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a set of transmit transactions as a batch
+ *
+ * Equivalent to calling CFE_SB_TransmitTxn_Execute() on each transaction in turn, except
+ * that the SB lock is only acquired once to resolve all routes and once to release all
+ * buffers, and the queue writes are grouped by destination pipe.  Messages written to
+ * the same pipe retain the relative order in which they appear in the set.
+ *
+ * Transactions that are not OK on entry are skipped.  If the same buffer appears more
+ * than once in the set, only the first instance is sent and the others are marked
+ * with #CFE_SB_BUFFER_INVALID status.
+ *
+ * \note The same use count semantics as CFE_SB_TransmitTxn_Execute() apply to every
+ * buffer in the set.
+ *
+ * \param[inout] TxnSet    Array of transaction objects
+ * \param[inout] BufPtrSet Array of buffer objects pending broadcast, parallel to TxnSet
+ * \param[in]    NumTxns   Number of entries in TxnSet/BufPtrSet, at most #CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE
+ */
+void CFE_SB_TransmitTxn_ExecuteBatch(CFE_SB_TransmitTxn_State_t *TxnSet,
+                                     CFE_SB_Buffer_t *const     *BufPtrSet,
+                                     uint32                      NumTxns);
+
 /*
  * Software Bus Message Handler Function prototypes
  */
@@ -1314,6 +2043,17 @@ int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data);
  */
 int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Write Latency Info' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_WriteLatencyInfoCmd(const CFE_SB_WriteLatencyInfoCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Command Message Handler function
@@ -1355,6 +2095,20 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubsCmd_t *data);
  */
 CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Release all buffer references retained by a Pipe descriptor
+ *
+ * Decrements the use count of the buffer(s) that were returned by the previous
+ * receive call(s) on this pipe, and clears the references from the descriptor.
+ *
+ * As this dereferences fields within the descriptor, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[inout] PipeDscPtr   pointer to Pipe table entry
+ */
+void CFE_SB_PipeDescReleaseBuffers(CFE_SB_PipeD_t *PipeDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Pipe descriptor is in use or free/empty
@@ -1512,6 +2266,15 @@ bool CFE_SB_WriteMsgMapInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffe
 void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr);
 bool CFE_SB_WriteRouteInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
 bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Local callback helper for writing latency info to a file
+ *
+ * Records 0 to #CFE_PLATFORM_SB_MAX_PIPES - 1 are the pipes, the records after
+ * that are the routes.  Unused pipes and routes are skipped.
+ */
+bool CFE_SB_WriteLatencyInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
 void CFE_SB_BackgroundFileEventHandler(void                   *Meta,
                                        CFE_FS_FileWriteEvent_t Event,
                                        int32                   Status,
@@ -512,18 +512,25 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
 {
-    uint32                   PipeDscCount;
-    uint32                   PipeStatCount;
-    CFE_SB_PipeD_t          *PipeDscPtr;
-    CFE_SB_PipeDepthStats_t *PipeStatPtr;
+    uint32                     PipeDscCount;
+    uint32                     PipeStatCount;
+    uint32                     BinIdx;
+    CFE_SB_PipeD_t            *PipeDscPtr;
+    CFE_SB_PipeDepthStats_t   *PipeStatPtr;
+    CFE_SB_PipeLatencyStats_t *LatencyStatPtr;
+    CFE_SB_LatencyHistogram_t *TotalPtr;
+
+    TotalPtr = &CFE_SB_Global.LatencyTlmMsg.Payload.Total;
+    memset(TotalPtr, 0, sizeof(*TotalPtr));
 
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
     /* Collect data on pipes */
-    PipeDscCount  = CFE_PLATFORM_SB_MAX_PIPES;
-    PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
-    PipeDscPtr    = CFE_SB_Global.PipeTbl;
-    PipeStatPtr   = CFE_SB_Global.StatTlmMsg.Payload.PipeDepthStats;
+    PipeDscCount   = CFE_PLATFORM_SB_MAX_PIPES;
+    PipeStatCount  = CFE_MISSION_SB_MAX_PIPES;
+    PipeDscPtr     = CFE_SB_Global.PipeTbl;
+    PipeStatPtr    = CFE_SB_Global.StatTlmMsg.Payload.PipeDepthStats;
+    LatencyStatPtr = CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats;
 
     while (PipeDscCount > 0 && PipeStatCount > 0)
     {
@@ -536,7 +543,23 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
             PipeStatPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
             PipeStatPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
 
+            /* Copy latency summary, and add to the total of all pipes */
+            LatencyStatPtr->PipeId     = PipeDscPtr->PipeId;
+            LatencyStatPtr->MsgCount   = PipeDscPtr->Latency.MsgCount;
+            LatencyStatPtr->MaxLatency = PipeDscPtr->Latency.MaxLatency;
+
+            TotalPtr->MsgCount += PipeDscPtr->Latency.MsgCount;
+            if (PipeDscPtr->Latency.MaxLatency > TotalPtr->MaxLatency)
+            {
+                TotalPtr->MaxLatency = PipeDscPtr->Latency.MaxLatency;
+            }
+            for (BinIdx = 0; BinIdx < CFE_MISSION_SB_LATENCY_HIST_BINS; ++BinIdx)
+            {
+                TotalPtr->Bin[BinIdx] += PipeDscPtr->Latency.Bin[BinIdx];
+            }
+
             ++PipeStatPtr;
+            ++LatencyStatPtr;
             --PipeStatCount;
         }
 
@@ -544,19 +567,31 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
         ++PipeDscPtr;
     }
 
+    CFE_SBR_GetProbeHistogram(CFE_SB_Global.StatTlmMsg.Payload.RouteProbeHistogram,
+                              CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS);
+
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 
     while (PipeStatCount > 0)
     {
         memset(PipeStatPtr, 0, sizeof(*PipeStatPtr));
+        memset(LatencyStatPtr, 0, sizeof(*LatencyStatPtr));
 
         ++PipeStatPtr;
+        ++LatencyStatPtr;
         --PipeStatCount;
     }
 
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.StatTlmMsg.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.StatTlmMsg.TelemetryHeader), true);
 
+    /* The latency summary would be all zero otherwise */
+    if (CFE_SB_Global.LatencyStatsEnabled)
+    {
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader), true);
+    }
+
     CFE_EVS_SendEvent(CFE_SB_SND_STATS_EID, CFE_EVS_EventType_DEBUG, "Software Bus Statistics packet sent");
 
     CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
@@ -884,6 +919,7 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
             PipeBufferPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
             PipeBufferPtr->CurrentQueueDepth = PipeDscPtr->CurrentQueueDepth;
             PipeBufferPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
+            memcpy(PipeBufferPtr->Lane, PipeDscPtr->Lane, sizeof(PipeBufferPtr->Lane));
 
             SysQueueId = PipeDscPtr->SysQueueId;
         }
@@ -1104,6 +1140,135 @@ int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_WriteLatencyInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_SB_BackgroundFileStateInfo_t *BgFilePtr;
+    CFE_SB_LatencyFileEntry_t        *EntryPtr;
+    CFE_SB_PipeD_t                   *PipeDscPtr;
+    CFE_SBR_RouteId_t                 RouteId;
+    bool                              IsValid;
+
+    /* Cast arguments for local use */
+    BgFilePtr = (CFE_SB_BackgroundFileStateInfo_t *)Meta;
+    EntryPtr  = &BgFilePtr->Buffer.LatencyInfo;
+    IsValid   = false;
+
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+    EntryPtr->MsgId  = CFE_SB_INVALID_MSG_ID;
+    EntryPtr->PipeId = CFE_SB_INVALID_PIPE;
+
+    /* Data must be locked to snapshot the histograms */
+    CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+    if (RecordNum < CFE_PLATFORM_SB_MAX_PIPES)
+    {
+        /* Pipe entries first */
+        PipeDscPtr = &CFE_SB_Global.PipeTbl[RecordNum];
+        IsValid    = CFE_SB_PipeDescIsUsed(PipeDscPtr);
+        if (IsValid)
+        {
+            EntryPtr->PipeId  = CFE_SB_PipeDescGetID(PipeDscPtr);
+            EntryPtr->Latency = PipeDscPtr->Latency;
+        }
+    }
+    else if (RecordNum < (CFE_PLATFORM_SB_MAX_PIPES + CFE_PLATFORM_SB_MAX_MSG_IDS))
+    {
+        /* Then route entries, unused routes have no message ID */
+        RouteId         = CFE_SBR_ValueToRouteId(RecordNum - CFE_PLATFORM_SB_MAX_PIPES);
+        EntryPtr->MsgId = CFE_SBR_GetMsgId(RouteId);
+        IsValid         = CFE_SB_IsValidMsgId(EntryPtr->MsgId);
+        if (IsValid)
+        {
+            EntryPtr->Latency = CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)];
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+
+    if (IsValid)
+    {
+        *Buffer  = EntryPtr;
+        *BufSize = sizeof(*EntryPtr);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= (CFE_PLATFORM_SB_MAX_PIPES + CFE_PLATFORM_SB_MAX_MSG_IDS - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_WriteLatencyInfoCmd(const CFE_SB_WriteLatencyInfoCmd_t *data)
+{
+    const CFE_SB_WriteFileInfoCmd_Payload_t *CmdPtr;
+    CFE_SB_BackgroundFileStateInfo_t        *StatePtr;
+    int32                                    Status;
+
+    StatePtr = &CFE_SB_Global.BackgroundFile;
+    CmdPtr   = &data->Payload;
+
+    /* If a pipe info dump was already pending, do not overwrite the current request */
+    if (!CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        /*
+         * Fill out the remainder of meta data.
+         * This data is currently the same for every request
+         */
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_LATENCYDATA;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Latency Information");
+
+        StatePtr->FileWrite.GetData = CFE_SB_WriteLatencyInfoDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName,
+                                             CmdPtr->Filename,
+                                             sizeof(StatePtr->FileWrite.FileName),
+                                             sizeof(CmdPtr->Filename),
+                                             CFE_PLATFORM_SB_DEFAULT_LATENCY_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+    else
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        /* generate the same event as is generated when unable to create the file (same thing, really) */
+        CFE_SB_BackgroundFileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, Status, 0, 0, 0);
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -48,6 +48,22 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_MASK_SUBS < 1
+#error CFE_PLATFORM_SB_MAX_MASK_SUBS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_MASK_SUBS > 65535
+#error CFE_PLATFORM_SB_MAX_MASK_SUBS cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS < 1
+#error CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS > CFE_PLATFORM_SB_MAX_MSG_IDS
+#error CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS cannot be greater than CFE_PLATFORM_SB_MAX_MSG_IDS!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -76,6 +92,14 @@
 #error CFE_MISSION_SB_MAX_SB_MSG_SIZE cannot be less than 6 (CCSDS Primary Hdr Size)!
 #endif
 
+#if CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS < 1
+#error CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS cannot be less than 1!
+#endif
+
+#if CFE_MISSION_SB_LATENCY_HIST_BINS < 1
+#error CFE_MISSION_SB_LATENCY_HIST_BINS cannot be less than 1!
+#endif
+
 /*
 **  SB Memory Pool Block Sizes
 */
@@ -91,6 +115,34 @@
 #error CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT cannot be greater than 65535!
 #endif
 
+#if CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE < 1
+#error CFE_PLATFORM_SB_TRANSMIT_BATCH_SIZE cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE < 1
+#error CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE > 65535
+#error CFE_PLATFORM_SB_RECEIVE_BATCH_SIZE cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES > CFE_PLATFORM_SB_MAX_PIPES
+#error CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES cannot be greater than CFE_PLATFORM_SB_MAX_PIPES!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH < 1
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH > 65535
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be greater than 65535!
+#endif
+
 /*
 ** Validate task stack size...
 */
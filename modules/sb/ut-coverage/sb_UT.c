@@ -329,6 +329,7 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Noop);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RstCtrs);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Stats);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_StatsLatency);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_BackgroundFileWriteEvents);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoAlreadyPending);
@@ -339,6 +340,9 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoAlreadyPending);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyInfoDef);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyInfoAlreadyPending);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyInfoDataGetter);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteValParam);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteNonExist);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteInvParam);
@@ -425,6 +429,8 @@ void Test_SB_Cmds_Stats(void)
     CFE_SB_PipeId_t PipeId1 = CFE_SB_INVALID_PIPE;
     CFE_SB_PipeId_t PipeId2 = CFE_SB_INVALID_PIPE;
     CFE_SB_PipeId_t PipeId3 = CFE_SB_INVALID_PIPE;
+    uint32          Count;
+    uint32          i;
 
     memset(&SendSbStats, 0, sizeof(SendSbStats));
 
@@ -450,6 +456,14 @@ void Test_SB_Cmds_Stats(void)
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SND_STATS_EID);
 
+    /* Every route in use appears once in the probe length histogram */
+    Count = 0;
+    for (i = 0; i < CFE_MISSION_SB_ROUTE_PROBE_HIST_BINS; i++)
+    {
+        Count += CFE_SB_Global.StatTlmMsg.Payload.RouteProbeHistogram[i];
+    }
+    UtAssert_UINT32_EQ(Count, CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SendSbStats.SBBuf), 0, UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
 
@@ -507,6 +521,72 @@ void Test_SB_Cmds_Stats(void)
     }
 }
 
+
+/*
+** Test send SB stats command with latency statistics enabled
+*/
+void Test_SB_Cmds_StatsLatency(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        CFE_SB_SendSbStatsCmd_t Cmd;
+    } SendSbStats;
+    CFE_SB_MsgId_t  MsgId[2];
+    CFE_MSG_Size_t  Size[2];
+    CFE_SB_PipeId_t PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    memset(&SendSbStats, 0, sizeof(SendSbStats));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 4, "TestPipe2"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Give the pipes some history */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId1);
+    CFE_SB_LatencyHistogram_Add(&PipeDscPtr->Latency, 0);
+    CFE_SB_LatencyHistogram_Add(&PipeDscPtr->Latency, 3);
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId2);
+    CFE_SB_LatencyHistogram_Add(&PipeDscPtr->Latency, 100);
+
+    CFE_SB_Global.LatencyStatsEnabled = true;
+
+    /* Generic command processing - The dispatch must be set up FIRST */
+    UT_SetupBasicMsgDispatch(&UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC, sizeof(SendSbStats.Cmd), false);
+
+    /* For internal TransmitMsg calls, stats packet then latency packet */
+    MsgId[0] = CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID);
+    MsgId[1] = CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID);
+    Size[0]  = sizeof(CFE_SB_Global.StatTlmMsg);
+    Size[1]  = sizeof(CFE_SB_Global.LatencyTlmMsg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+
+    CFE_SB_ProcessCmdPipePkt(&SendSbStats.SBBuf);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_STATS_EID);
+
+    /* Both packets are time stamped and sent */
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 2);
+
+    /* The total combines all pipes */
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.Total.MsgCount, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.Total.MaxLatency, 100);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.Total.Bin[0], 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.Total.Bin[2], 1);
+
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[0].PipeId, PipeId1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[0].MsgCount, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[0].MaxLatency, 3);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[1].PipeId, PipeId2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[1].MsgCount, 1);
+    UtAssert_ZERO(CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[2].MsgCount);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
 /*
 ** Test write routing information command using the default file name
 */
@@ -760,9 +840,12 @@ void Test_SB_Cmds_PipeInfoDataGetter(void)
     UtAssert_BOOL_FALSE(CFE_SB_WritePipeInfoDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
     UtAssert_ZERO(LocalBufSize);
 
+    /* Lane statistics are included */
+    CFE_SB_LocatePipeDescByID(PipeId1)->Lane[CFE_SB_QosPriority_HIGH].PeakQueueDepth = 3;
     UtAssert_BOOL_FALSE(CFE_SB_WritePipeInfoDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
     UtAssert_NOT_NULL(LocalBuffer);
     UtAssert_NONZERO(LocalBufSize);
+    UtAssert_UINT16_EQ(((CFE_SB_PipeInfoEntry_t *)LocalBuffer)->Lane[CFE_SB_QosPriority_HIGH].PeakQueueDepth, 3);
 
     UtAssert_BOOL_TRUE(
         CFE_SB_WritePipeInfoDataGetter(&State, CFE_PLATFORM_SB_MAX_PIPES - 1, &LocalBuffer, &LocalBufSize));
@@ -944,6 +1027,134 @@ void Test_SB_Cmds_MapInfoAlreadyPending(void)
     CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
 }
 
+
+/*
+** Test write latency information command nominal path
+*/
+void Test_SB_Cmds_LatencyInfoDef(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        CFE_SB_WriteLatencyInfoCmd_t Cmd;
+    } WriteLatencyInfo;
+
+    memset(&WriteLatencyInfo, 0, sizeof(WriteLatencyInfo));
+
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter = 0;
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt,
+                    CFE_MSG_PTR(WriteLatencyInfo.SBBuf),
+                    sizeof(WriteLatencyInfo.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_LATENCY_INFO_CC);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.BackgroundFile.FileWrite.FileSubType, CFE_FS_SubType_SB_LATENCYDATA);
+
+    /* Also test with a bad file name - should generate CFE_SB_SND_RTG_ERR1_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt,
+                    CFE_MSG_PTR(WriteLatencyInfo.SBBuf),
+                    sizeof(WriteLatencyInfo.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_LATENCY_INFO_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt,
+                    CFE_MSG_PTR(WriteLatencyInfo.SBBuf),
+                    0,
+                    UT_TPID_CFE_SB_CMD_WRITE_LATENCY_INFO_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+}
+
+/*
+** Test write latency information command when already pending
+*/
+void Test_SB_Cmds_LatencyInfoAlreadyPending(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        CFE_SB_WriteLatencyInfoCmd_t Cmd;
+    } WriteLatencyInfo;
+
+    memset(&WriteLatencyInfo, 0, sizeof(WriteLatencyInfo));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt,
+                    CFE_MSG_PTR(WriteLatencyInfo.SBBuf),
+                    sizeof(WriteLatencyInfo.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_LATENCY_INFO_CC);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+}
+
+/*
+** Test write latency information data getter for background file write
+*/
+void Test_SB_Cmds_LatencyInfoDataGetter(void)
+{
+    CFE_SB_PipeId_t                  PipeId1   = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t                   MsgId0    = SB_UT_TLM_MID1;
+    uint16                           PipeDepth = 10;
+    void                            *LocalBuffer;
+    size_t                           LocalBufSize;
+    CFE_SB_BackgroundFileStateInfo_t State;
+    CFE_SB_LatencyFileEntry_t       *EntryPtr;
+    CFE_SB_PipeD_t                  *PipeDscPtr;
+    CFE_SBR_RouteId_t                RouteId;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId0, PipeId1));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId1);
+    RouteId    = CFE_SBR_GetRouteId(MsgId0);
+    CFE_SB_LatencyHistogram_Add(&PipeDscPtr->Latency, 5);
+    CFE_SB_LatencyHistogram_Add(&CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)], 7);
+
+    memset(&State, 0, sizeof(State));
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+
+    /* Note that CFE_SB_CreatePipe() fills entry 1 first, so entry 0 is unused and skipped */
+    UtAssert_BOOL_FALSE(CFE_SB_WriteLatencyInfoDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    UtAssert_BOOL_FALSE(CFE_SB_WriteLatencyInfoDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State.Buffer.LatencyInfo);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(CFE_SB_LatencyFileEntry_t));
+    EntryPtr = LocalBuffer;
+    CFE_UtAssert_RESOURCEID_EQ(EntryPtr->PipeId, PipeId1);
+    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(EntryPtr->MsgId));
+    UtAssert_UINT32_EQ(EntryPtr->Latency.MaxLatency, 5);
+
+    /* Route records follow the pipes */
+    UtAssert_BOOL_FALSE(CFE_SB_WriteLatencyInfoDataGetter(&State,
+                                                          CFE_PLATFORM_SB_MAX_PIPES + CFE_SBR_RouteIdToValue(RouteId),
+                                                          &LocalBuffer,
+                                                          &LocalBufSize));
+    UtAssert_NOT_NULL(LocalBuffer);
+    EntryPtr = LocalBuffer;
+    CFE_UtAssert_MSGID_EQ(EntryPtr->MsgId, MsgId0);
+    CFE_UtAssert_RESOURCEID_EQ(EntryPtr->PipeId, CFE_SB_INVALID_PIPE);
+    UtAssert_UINT32_EQ(EntryPtr->Latency.MaxLatency, 7);
+
+    /* Last record is an unused route, and is the end of the file */
+    UtAssert_BOOL_TRUE(CFE_SB_WriteLatencyInfoDataGetter(
+        &State, CFE_PLATFORM_SB_MAX_PIPES + CFE_PLATFORM_SB_MAX_MSG_IDS - 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Out of range */
+    UtAssert_BOOL_TRUE(CFE_SB_WriteLatencyInfoDataGetter(
+        &State, CFE_PLATFORM_SB_MAX_PIPES + CFE_PLATFORM_SB_MAX_MSG_IDS, &LocalBuffer, &LocalBufSize));
+    UtAssert_ZERO(LocalBufSize);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
 /*
 ** Test command to enable a specific route using a valid route
 */
@@ -2194,6 +2405,10 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SubscriptionReporting);
     SB_UT_ADD_SUBTEST(Test_Subscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_HasSubscribers);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_PriorityLane);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Mask);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Mask_Errors);
 }
 
 /*
@@ -2547,6 +2762,308 @@ void Test_Subscribe_InvalidPipeOwner(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test checking whether a message ID has any active subscribers
+*/
+void Test_Subscribe_HasSubscribers(void)
+{
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t         SharedMsgId;
+    CFE_SB_PipeId_t        PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_DestinationD_t *DestPtr;
+
+    SharedMsgId = CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(MsgId) + CFE_SB_ROUTE_PRESENCE_SIZE);
+
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(CFE_SB_INVALID_MSG_ID));
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(MsgId));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UtAssert_BOOL_TRUE(CFE_SB_HasSubscribers(MsgId));
+
+    /* Shares the presence entry but has no route */
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(SharedMsgId));
+
+    /* A disabled destination does not count */
+    DestPtr         = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+    DestPtr->Active = CFE_SB_INACTIVE;
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(MsgId));
+    DestPtr->Active = CFE_SB_ACTIVE;
+
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId));
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(MsgId));
+    UtAssert_ZERO(CFE_SB_Global.RoutePresence[CFE_SB_MsgIdToValue(MsgId) % CFE_SB_ROUTE_PRESENCE_SIZE]);
+
+    /* Clearing an entry that is already clear has no effect */
+    CFE_SB_SetRoutePresence(MsgId, false);
+    UtAssert_ZERO(CFE_SB_Global.RoutePresence[CFE_SB_MsgIdToValue(MsgId) % CFE_SB_ROUTE_PRESENCE_SIZE]);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/* Gives the pipe a priority lane while its lane queue is being created */
+static int32
+UT_SetLaneOnQueueCreate(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    CFE_SB_PipeD_t *PipeDscPtr = UserObj;
+
+    PipeDscPtr->PriorityQueueId = PipeDscPtr->SysQueueId;
+
+    return StubRetcode;
+}
+
+/*
+** Test creation of the priority lane by a high priority subscription
+*/
+void Test_Subscribe_PriorityLane(void)
+{
+    CFE_SB_PipeId_t PipeId     = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t  MsgId      = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t  MsgId2     = SB_UT_CMD_MID;
+    CFE_SB_Qos_t    HighPrio   = {CFE_SB_QosPriority_HIGH, CFE_SB_QosReliability_LOW};
+    CFE_SB_PipeD_t *PipeDscPtr = NULL;
+    CFE_ES_AppId_t  RealOwner;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId));
+
+    /* A normal subscription does not create the lane */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeEx(MsgId2, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    UtAssert_STUB_COUNT(OS_QueueCreate, 1);
+    UtAssert_UINT8_EQ(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId2), PipeId)->Priority, CFE_SB_QosPriority_LOW);
+
+    /* The first high priority subscription does */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeEx(MsgId, PipeId, HighPrio, 4));
+    UtAssert_STUB_COUNT(OS_QueueCreate, 2);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId));
+    UtAssert_UINT8_EQ(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId)->Priority, CFE_SB_QosPriority_HIGH);
+
+    /* Any later one uses the same lane */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId2, PipeId));
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeEx(MsgId2, PipeId, HighPrio, 4));
+    UtAssert_STUB_COUNT(OS_QueueCreate, 2);
+
+    /* Both queues are deleted with the pipe */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_STUB_COUNT(OS_QueueDelete, 2);
+
+    /* The subscription still works if the lane can not be created, using the normal lane */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeEx(MsgId, PipeId, HighPrio, 4));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId));
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    /* Only the owner of the pipe gets a lane */
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+    UtAssert_VOIDCALL(CFE_SB_CreatePriorityLane(PipeId, RealOwner));
+    PipeDscPtr->AppId = RealOwner;
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PipeDscPtr->PriorityQueueId));
+
+    /* Nothing is created for an invalid pipe */
+    UtAssert_VOIDCALL(CFE_SB_CreatePriorityLane(SB_UT_ALTERNATE_INVALID_PIPEID, RealOwner));
+    UtAssert_STUB_COUNT(OS_QueueCreate, 4);
+
+    /* A lane added while the queue was being created is kept, and the new queue deleted */
+    UT_SetHookFunction(UT_KEY(OS_QueueCreate), UT_SetLaneOnQueueCreate, PipeDscPtr);
+    UtAssert_VOIDCALL(CFE_SB_CreatePriorityLane(PipeId, RealOwner));
+    UT_SetHookFunction(UT_KEY(OS_QueueCreate), NULL, NULL);
+    UtAssert_STUB_COUNT(OS_QueueCreate, 5);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 3);
+    CFE_UtAssert_RESOURCEID_EQ(PipeDscPtr->PriorityQueueId, PipeDscPtr->SysQueueId);
+    PipeDscPtr->PriorityQueueId = OS_OBJECT_ID_UNDEFINED;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test subscribing to a set of message IDs with a value and mask
+*/
+void Test_Subscribe_Mask(void)
+{
+    CFE_SB_PipeId_t        PipeId1  = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t        PipeId2  = CFE_SB_INVALID_PIPE;
+    CFE_SB_Qos_t           HighPrio = {CFE_SB_QosPriority_HIGH, CFE_SB_QosReliability_LOW};
+    CFE_SB_MsgId_t         MsgId    = SB_UT_TLM_MID3;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_SB_DestinationD_t *DestPtr;
+    uint32                 Generation;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 10, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeId2));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* A route that already exists gets the destination right away, as a local one */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId1, CFE_SB_DEFAULT_QOS, 4));
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    UtAssert_UINT16_EQ(CFE_SB_Global.MaskSubsInUse, 1);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId1);
+    UtAssert_NOT_NULL(DestPtr);
+    UtAssert_BOOL_TRUE(DestPtr->MaskSub);
+    UtAssert_UINT8_EQ(DestPtr->Scope, CFE_SB_MSG_LOCAL);
+    UtAssert_UINT16_EQ(DestPtr->MsgId2PipeLim, 4);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse, 2);
+
+    /* Other matching IDs have subscribers, but checking does not add a route */
+    Generation = CFE_SB_Global.RouteGeneration;
+    UtAssert_BOOL_TRUE(CFE_SB_HasSubscribers(SB_UT_TLM_MID2));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID2)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.RouteGeneration, Generation);
+
+    /* They get a route on the first lookup */
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SB_LookupRoute(SB_UT_TLM_MID2)));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId1));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 2);
+
+    /* IDs that do not match do not */
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(SB_UT_CMD_MID));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_CMD_MID)));
+
+    /* Sending a matching message adds the route and delivers it */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId1));
+
+    /* An explicit subscription takes over the destination */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeEx(SB_UT_TLM_MID2, PipeId1, HighPrio, 8));
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_DUP_SUBSCRIP_EID);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId1);
+    UtAssert_BOOL_FALSE(DestPtr->MaskSub);
+    UtAssert_UINT8_EQ(DestPtr->Scope, CFE_SB_MSG_GLOBAL);
+    UtAssert_UINT16_EQ(DestPtr->MsgId2PipeLim, 8);
+    UtAssert_UINT8_EQ(DestPtr->Priority, CFE_SB_QosPriority_HIGH);
+
+    /* A destination added by a mask subscription is not removed by an explicit unsubscribe */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(SB_UT_TLM_MID1, PipeId1));
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId1));
+
+    /* An overlapping mask subscription keeps the destinations it matches */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0xFFFE, PipeId1, HighPrio, 4));
+    UtAssert_UINT16_EQ(CFE_SB_Global.MaskSubsInUse, 2);
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId1));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_REMOVED_EID);
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId1));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId1));
+
+    /* The route of an ID that no longer matches is released with its last destination */
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+
+    /* Removing the last one leaves only the explicit destinations */
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFFE, PipeId1));
+    UtAssert_ZERO(CFE_SB_Global.MaskSubsInUse);
+    UtAssert_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId1));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId2));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId1));
+
+    /* A route is not kept if the destination can not be added */
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeMask(SB_UT_CMD_MID, 0xFFF0, PipeId1, CFE_SB_DEFAULT_QOS, 4));
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SB_LookupRoute(SB_UT_CMD_MID1)));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_CMD_MID1)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter, 1);
+
+    /* Deleting the pipe removes its mask subscriptions */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    UtAssert_ZERO(CFE_SB_Global.MaskSubsInUse);
+    UtAssert_BOOL_FALSE(CFE_SB_HasSubscribers(SB_UT_CMD_MID1));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
+/*
+** Test mask subscription error handling
+*/
+void Test_Subscribe_Mask_Errors(void)
+{
+    CFE_SB_PipeId_t     PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t     *PipeDscPtr;
+    CFE_ES_AppId_t      RealOwner;
+    CFE_SB_MsgId_Atom_t Mask;
+    uint32              Idx;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Invalid pipe */
+    UtAssert_INT32_EQ(
+        CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0xFFF0, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_DEFAULT_QOS, 4),
+        CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_INV_PIPE_EID);
+    UtAssert_INT32_EQ(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFF0, SB_UT_ALTERNATE_INVALID_PIPEID),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_INV_PIPE_EID);
+
+    /* Not the owner of the pipe */
+    PipeDscPtr        = CFE_SB_LocatePipeDescByID(PipeId);
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId, CFE_SB_DEFAULT_QOS, 4),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_INV_CALLER_EID);
+    UtAssert_INT32_EQ(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_INV_CALLER_EID);
+    PipeDscPtr->AppId = RealOwner;
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter, 2);
+    UtAssert_ZERO(CFE_SB_Global.MaskSubsInUse);
+
+    /* A mask matching more IDs than the routing table should give to it */
+    UT_ClearEventHistory();
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0, PipeId, CFE_SB_DEFAULT_QOS, 4), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_ARG_ERR_EID);
+    Mask = ~(CFE_SB_MsgId_Atom_t)((2 * CFE_PLATFORM_SB_MAX_MASK_MATCH_IDS) - 1);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, PipeId, CFE_SB_DEFAULT_QOS, 4), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter, 4);
+    UtAssert_ZERO(CFE_SB_Global.MaskSubsInUse);
+
+    /* Not subscribed */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId));
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+
+    /* Duplicate, bits outside the mask do not make a difference */
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID1, 0xFFF0, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    CFE_UtAssert_EVENTSENT(CFE_SB_DUP_SUBSCRIP_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.DuplicateSubscriptionsCounter, 1);
+    UtAssert_UINT16_EQ(CFE_SB_Global.MaskSubsInUse, 1);
+
+    /* Table full */
+    for (Idx = 1; Idx < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++Idx)
+    {
+        CFE_UtAssert_SETUP(
+            CFE_SB_SubscribeMask(CFE_SB_ValueToMsgId(Idx), 0xFFFF, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    }
+    UT_ClearEventHistory();
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_CMD_MID, 0xFFF0, PipeId, CFE_SB_DEFAULT_QOS, 4),
+                      CFE_SB_MAX_MSGS_MET);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MAX_MASK_SUBS_MET_EID);
+    UtAssert_UINT16_EQ(CFE_SB_Global.MaskSubsInUse, CFE_PLATFORM_SB_MAX_MASK_SUBS);
+
+    /* A freed entry can be reused */
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, 0xFFF0, PipeId));
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_CMD_MID, 0xFFF0, PipeId, CFE_SB_DEFAULT_QOS, 4));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.MaskSubsInUse);
+}
+
 /*
 ** Function for calling SB unsubscribe API test functions
 */
@@ -2562,6 +3079,7 @@ void Test_Unsubscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_RemovesRoute);
 }
 
 /*
@@ -2853,6 +3371,45 @@ void Test_Unsubscribe_GetDestPtr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
 }
 
+/*
+** Test that removing the last destination of a message ID releases its route
+*/
+void Test_Unsubscribe_RemovesRoute(void)
+{
+    CFE_SB_MsgId_t  MsgId     = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t TestPipe1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t TestPipe2 = CFE_SB_INVALID_PIPE;
+    uint16          PipeDepth = 50;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, TestPipe1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, TestPipe2));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* Route stays while there is still a destination */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, TestPipe1));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* Route is removed with the last destination */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, TestPipe2));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+    UtAssert_BOOL_FALSE(CFE_SB_IsRoutePresent(MsgId));
+
+    /* Subscribing again adds a new route, and deleting the pipe removes it */
+    CFE_UtAssert_SUCCESS(CFE_SB_Subscribe(MsgId, TestPipe1));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(TestPipe1));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+    UtAssert_BOOL_FALSE(CFE_SB_IsRoutePresent(MsgId));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
+}
+
 void Test_TransmitTxn_Init(void)
 {
     /* Test case for:
@@ -2966,6 +3523,7 @@ void Test_MessageTxn_SetupFromMsg(void)
     CFE_MSG_Message_t         Msg;
     CFE_SB_MsgId_t            MsgId;
     CFE_MSG_Size_t            MsgSize;
+    CFE_MSG_HeaderView_t      HdrView;
 
     memset(&Msg, 0, sizeof(Msg));
 
@@ -2975,9 +3533,9 @@ void Test_MessageTxn_SetupFromMsg(void)
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_SetupFromMsg(&Txn, &Msg));
     UtAssert_INT32_EQ(Txn.Status, -20);
 
-    /* CFE_MSG_GetMsgId() fail case */
+    /* CFE_MSG_DecodeHeader() fail case */
     memset(&Txn, 0, sizeof(Txn));
-    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetMsgId), 1, -10);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_DecodeHeader), 1, -10);
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_SetupFromMsg(&Txn, &Msg));
     UtAssert_INT32_EQ(Txn.Status, -10);
     UtAssert_UINT32_EQ(Txn.TransactionEventId, CFE_SB_SEND_BAD_ARG_EID);
@@ -2990,14 +3548,17 @@ void Test_MessageTxn_SetupFromMsg(void)
     UtAssert_INT32_EQ(Txn.Status, CFE_SB_BAD_ARGUMENT);
     UtAssert_UINT32_EQ(Txn.TransactionEventId, CFE_SB_SEND_INV_MSGID_EID);
 
-    /* CFE_MSG_GetSize() fail case */
+    /* Decoded header provided as a whole */
     memset(&Txn, 0, sizeof(Txn));
-    MsgId = SB_UT_TLM_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetSize), 1, -11);
+    memset(&HdrView, 0, sizeof(HdrView));
+    HdrView.MsgId = SB_UT_TLM_MID;
+    HdrView.Size  = sizeof(Msg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_DecodeHeader), &HdrView, sizeof(HdrView), false);
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_SetupFromMsg(&Txn, &Msg));
-    UtAssert_INT32_EQ(Txn.Status, -11);
-    UtAssert_UINT32_EQ(Txn.TransactionEventId, CFE_SB_SEND_BAD_ARG_EID);
+    UtAssert_INT32_EQ(Txn.Status, CFE_SUCCESS);
+    CFE_UtAssert_MSGID_EQ(Txn.RoutingMsgId, SB_UT_TLM_MID);
+    UtAssert_UINT32_EQ(Txn.ContentSize, sizeof(Msg));
+    UT_ResetState(UT_KEY(CFE_MSG_DecodeHeader));
 
     /* Message too big case */
     memset(&Txn, 0, sizeof(Txn));
@@ -3262,6 +3823,64 @@ void Test_TransmitTxn_Execute(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+void Test_TransmitTxn_ExecuteCopy(void)
+{
+    /* Test case for:
+     * void CFE_SB_TransmitTxn_ExecuteCopy(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr);
+     */
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_SB_BufferD_t          *BufDscPtr;
+    CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t             MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t           TlmPkt;
+
+    memset(&TlmPkt, 0xA5, sizeof(TlmPkt));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+
+    /* no subs - nothing copied, and the buffer is released again */
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, &TlmPkt);
+    CFE_SB_MessageTxn_SetRoutingMsgId(Txn, MsgId);
+    CFE_SB_MessageTxn_SetContentSize(Txn, sizeof(TlmPkt));
+    CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_ExecuteCopy(Txn, CFE_MSG_PTR(TlmPkt.TelemetryHeader)));
+    UtAssert_UINT32_EQ(Txn->TransactionEventId, CFE_SB_SEND_NO_SUBS_EID);
+    UtAssert_INT32_EQ(Txn->Status, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 0);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* nominal case, the buffer goes straight to the in transit list with a copy of the message */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, &TlmPkt);
+    CFE_SB_MessageTxn_SetRoutingMsgId(Txn, MsgId);
+    CFE_SB_MessageTxn_SetContentSize(Txn, sizeof(TlmPkt));
+    CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_ExecuteCopy(Txn, CFE_MSG_PTR(TlmPkt.TelemetryHeader)));
+    UtAssert_BOOL_TRUE(CFE_SB_MessageTxn_IsOK(Txn));
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    UtAssert_BOOL_TRUE(CFE_SB_TrackingListIsEnd(&CFE_SB_Global.ZeroCopyList, CFE_SB_Global.ZeroCopyList.Next));
+    BufDscPtr = (CFE_SB_BufferD_t *)CFE_SB_Global.InTransitList.Next;
+    UtAssert_BOOL_FALSE(CFE_SB_TrackingListIsEnd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link));
+    UtAssert_UINT32_EQ(BufDscPtr->UseCount, 1);
+    UtAssert_MemCmp(&BufDscPtr->Content, &TlmPkt, sizeof(TlmPkt), "Buffer content");
+
+    /* buffer allocation failure */
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, &TlmPkt);
+    CFE_SB_MessageTxn_SetRoutingMsgId(Txn, MsgId);
+    CFE_SB_MessageTxn_SetContentSize(Txn, sizeof(TlmPkt));
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_ExecuteCopy(Txn, CFE_MSG_PTR(TlmPkt.TelemetryHeader)));
+    UtAssert_UINT32_EQ(Txn->TransactionEventId, CFE_SB_GET_BUF_ERR_EID);
+    UtAssert_INT32_EQ(Txn->Status, CFE_SB_BUF_ALOC_ERR);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 void Test_MessageTxn_GetEventDetails(void)
 {
     /* Test case for:
@@ -3492,6 +4111,7 @@ void Test_TransmitMsg_API(void)
 {
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_NullPtr);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_NoSubscribersSharedPresence);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MaxMsgSizePlusOne);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_BasicSend);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_UpdateHeader);
@@ -3501,8 +4121,15 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
+    SB_UT_ADD_SUBTEST(Test_TransmitBufferBatch);
+    SB_UT_ADD_SUBTEST(Test_TransmitBufferBatch_Errors);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_PriorityLane);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeTransport);
+    SB_UT_ADD_SUBTEST(Test_TransmitSegments);
+    SB_UT_ADD_SUBTEST(Test_TransmitSegments_Errors);
+    SB_UT_ADD_SUBTEST(Test_TransmitBufferToRoute);
 
     SB_UT_ADD_SUBTEST(Test_MessageTxn_SetEventAndStatus);
     SB_UT_ADD_SUBTEST(Test_MessageTxn_SetupFromMsg);
@@ -3515,6 +4142,7 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_FindDestinations);
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_PipeHandler);
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_Execute);
+    SB_UT_ADD_SUBTEST(Test_TransmitTxn_ExecuteCopy);
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
@@ -3551,6 +4179,47 @@ void Test_TransmitMsg_NoSubscribers(void)
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
+
+    /* No buffer is allocated for a message nobody subscribes to */
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse);
+}
+
+/*
+** Test response to sending a message with no subscriptions, where the
+** message ID shares its subscriber presence entry with a subscribed one
+*/
+void Test_TransmitMsg_NoSubscribersSharedPresence(void)
+{
+    CFE_SB_MsgId_t   SubMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   MsgId;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+
+    MsgId = CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(SubMsgId) + CFE_SB_ROUTE_PRESENCE_SIZE);
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SubMsgId, PipeId));
+    UtAssert_BOOL_TRUE(CFE_SB_IsRoutePresent(MsgId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    CFE_UtAssert_EVENTCOUNT(3);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
+
+    /* Route lookup is still done, and the buffer released again */
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
 /*
@@ -3717,28 +4386,27 @@ void Test_TransmitMsg_UpdateHeader(void)
 
     CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId)); /* should have no subscribers now */
 
-    SeqCntExpected = 3;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), SeqCntExpected);
+    /* The route is removed with the last subscriber, so there is no sequence count to update */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
-    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* increment to 3 */
-    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 3);
-    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 3);
-    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 2);
 
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId)); /* resubscribe so we can receive a msg */
 
-    SeqCntExpected = 4;
+    SeqCntExpected = 3;
     UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), SeqCntExpected);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
-    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* increment to 4 */
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* increment to 3 */
     UtAssert_INT32_EQ(SeqCnt, SeqCntExpected);
-    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 4);
-    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 4);
-    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 3);
+    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 3);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4082,6 +4750,131 @@ void Test_TransmitBuffer_NoIncrement(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test successfully sending a set of messages in zero copy mode
+*/
+void Test_TransmitBufferBatch(void)
+{
+    CFE_SB_Buffer_t *SendPtr[3];
+    CFE_SB_Buffer_t *ReceivePtr = NULL;
+    CFE_Status_t     StatusArray[3];
+    CFE_SB_PipeId_t  PipeId1   = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t  PipeId2   = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId[3]  = {SB_UT_TLM_MID, SB_UT_TLM_MID2, SB_UT_TLM_MID};
+    CFE_MSG_Size_t   Size[3]   = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t)};
+    uint32           PipeDepth = 10;
+    uint32           i;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "BatchTestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "BatchTestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[0], PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[1], PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[1], PipeId2));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    for (i = 0; i < 3; ++i)
+    {
+        SendPtr[i] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+        UtAssert_NOT_NULL(SendPtr[i]);
+        StatusArray[i] = CFE_SB_BAD_ARGUMENT;
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+
+    /* Test a successful batch, messages should be received in the same order per pipe */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtr, StatusArray, 3, false));
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    CFE_UtAssert_SUCCESS(StatusArray[1]);
+    CFE_UtAssert_SUCCESS(StatusArray[2]);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[0]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[1]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[2]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId2, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[1]);
+
+    /* A batch of zero buffers does nothing */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtr, StatusArray, 0, false));
+
+    /* If the pool cannot supply the transaction states the buffers are sent one at a time */
+    for (i = 0; i < 3; ++i)
+    {
+        SendPtr[i] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+        UtAssert_NOT_NULL(SendPtr[i]);
+        StatusArray[i] = CFE_SB_BAD_ARGUMENT;
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtr, StatusArray, 3, false));
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    CFE_UtAssert_SUCCESS(StatusArray[1]);
+    CFE_UtAssert_SUCCESS(StatusArray[2]);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[0]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[1]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[2]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId2, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[1]);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
+/*
+** Test error handling when sending a set of messages in zero copy mode
+*/
+void Test_TransmitBufferBatch_Errors(void)
+{
+    CFE_SB_Buffer_t *SendPtr[3];
+    CFE_SB_Buffer_t *ReceivePtr = NULL;
+    CFE_Status_t     StatusArray[3];
+    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId[2]  = {SB_UT_TLM_MID, SB_UT_TLM_MID};
+    CFE_MSG_Size_t   Size[2]   = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t)};
+    uint32           PipeDepth = 10;
+
+    /* Null arrays */
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(NULL, StatusArray, 1, false), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtr, NULL, 1, false), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "BatchErrTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId[0], PipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Null entry and the same buffer twice - only the first instance is sent */
+    SendPtr[0] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    SendPtr[1] = NULL;
+    SendPtr[2] = SendPtr[0];
+    UtAssert_NOT_NULL(SendPtr[0]);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtr, StatusArray, 3, false), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    UtAssert_INT32_EQ(StatusArray[1], CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(StatusArray[2], CFE_SB_BUFFER_INVALID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr[0]);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test releasing a pointer to a buffer for zero copy mode
 */
@@ -4152,248 +4945,1275 @@ void Test_TransmitMsg_DisabledDestination(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
-void UT_CFE_MSG_Verify_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    bool *IsAcceptable = UT_Hook_GetArgValueByName(Context, "IsAcceptable", bool *);
-
-    /* Return alternating false/true (this is needed to avoid an endless loop) */
-    *IsAcceptable = (UT_GetStubCount(FuncKey) & 1) == 0;
-}
-
 /*
-** Function for calling SB receive message API test functions
+** Test queue depth statistics of a pipe with a priority lane
 */
-void Test_ReceiveBuffer_API(void)
+void Test_TransmitMsg_PriorityLane(void)
 {
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidPipeId);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidTimeout);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Poll);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Timeout);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
-    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
-}
+    CFE_SB_PipeId_t  PipeId   = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId    = SB_UT_TLM_MID;
+    CFE_SB_Qos_t     HighPrio = {CFE_SB_QosPriority_HIGH, CFE_SB_QosReliability_LOW};
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeD_t  *PipeDscPtr;
 
-static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    CFE_SB_BufferD_t      **OutData     = UT_Hook_GetArgValueByName(Context, "data", void *);
-    size_t                 *size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
-    int32                   status;
-    static CFE_SB_BufferD_t LocalBuf;
-    CFE_SB_PipeD_t         *PipeDscPtr = UserObj;
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    memset(&LocalBuf, 0, sizeof(LocalBuf));
-    CFE_SB_TrackingListReset(&LocalBuf.Link);
-    LocalBuf.UseCount = 1;
-    *OutData          = &LocalBuf;
-    *size_copied      = sizeof(*OutData);
-    status            = OS_SUCCESS;
-    UT_Stub_SetReturnValue(FuncKey, status);
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "LaneTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, HighPrio, 4));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    /* Modify the PipeID so it fails to match */
-    PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].PeakQueueDepth, 1);
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].PeakQueueDepth);
+
+    /* A full lane is counted against that lane */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].PeakQueueDepth, 2);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].OverflowErrors, 1);
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].OverflowErrors);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
-/* Special handler to hit OS_QueueGet error casses */
-static void SB_UT_QueueGetHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+/* Captures the messages passed to a pipe transport */
+typedef struct
 {
-    size_t **data        = (size_t **)UT_Hook_GetArgValueByName(Context, "data", void *);
-    size_t  *size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
-    int32    status      = OS_SUCCESS;
+    uint32                 Count;
+    CFE_SB_PipeId_t        PipeId;
+    const CFE_SB_Buffer_t *BufPtr;
+    size_t                 MsgSize;
+    CFE_Status_t           Status;
+} SB_UT_TransportState_t;
 
-    *data = UserObj;
+static CFE_Status_t UT_PipeTransport(CFE_SB_PipeId_t PipeId, const CFE_SB_Buffer_t *BufPtr, size_t MsgSize, void *Arg)
+{
+    SB_UT_TransportState_t *StatePtr = Arg;
 
-    if (*data == NULL)
-    {
-        *size_copied = sizeof(CFE_SB_BufferD_t *);
-    }
-    else
-    {
-        *size_copied = *((size_t *)UserObj);
-    }
-    UT_Stub_SetReturnValue(FuncKey, status);
+    ++StatePtr->Count;
+    StatePtr->PipeId  = PipeId;
+    StatePtr->BufPtr  = BufPtr;
+    StatePtr->MsgSize = MsgSize;
+
+    return StatePtr->Status;
 }
 
 /*
-** Test receiving a message from the software bus with an invalid pipe ID
+** Test sending to a pipe with a transport function
 */
-void Test_ReceiveBuffer_InvalidPipeId(void)
+void Test_TransmitMsg_PipeTransport(void)
 {
-    CFE_SB_Buffer_t *SBBufPtr;
-    CFE_SB_PipeId_t  InvalidPipeId = SB_UT_ALTERNATE_INVALID_PIPEID;
-    CFE_SB_PipeId_t  PipeId        = CFE_SB_INVALID_PIPE;
-    CFE_SB_PipeD_t  *PipeDscPtr;
+    CFE_SB_PipeId_t        PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t        OtherPipeId;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t        *PipeDscPtr;
+    CFE_SB_Buffer_t       *SBBufPtr;
+    CFE_ES_AppId_t         OrigOwner;
+    SB_UT_TransportState_t State;
 
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&State, 0, sizeof(State));
 
-    CFE_UtAssert_EVENTCOUNT(1);
-    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
-    UT_ClearEventHistory();
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TransportPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&OtherPipeId, 4, "LocalPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, OtherPipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    /*
-     * The internal call to OS_QueueGet is done with the SB global unlocked, as other tasks must be able
-     * to access the SB global while another task is pending on a receive.  Because of this lock/unlock/relock
-     * pattern, the CFE_SB_ReceiveBuffer() function validates the pipeID twice, after each time it obtains the
-     * global SB lock.  The second check is to cover the corner case that the pipeID was deleted or reconfigured
-     * while it was pending.
-     *
-     * This case is harder to test for, need to set up a handler function that changes the pipe in between these
-     * two checks, such that the first check passes, but the second (identical) check fails.
-     */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeTransport(PipeId, UT_PipeTransport, &State));
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "RcvTestPipe"));
-    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
-    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_PipeIdModifyHandler, PipeDscPtr);
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
-    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    /* The transport gets the message, only the other pipe is written to a queue */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(State.Count, 1);
+    CFE_UtAssert_RESOURCEID_EQ(State.PipeId, PipeId);
+    UtAssert_NOT_NULL(State.BufPtr);
+    UtAssert_UINT32_EQ(State.MsgSize, sizeof(TlmPkt));
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT16_EQ(PipeDscPtr->PeakQueueDepth, 1);
+    UtAssert_ZERO(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId)->BuffCount);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Only the reference from the other pipe is left */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, OtherPipeId, CFE_SB_POLL));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(OtherPipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* A transport error is counted as a pipe write error */
+    State.Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(State.Count, 2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_WR_ERR_EID);
     UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
-    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
 
-    /* restore the PipeID so it can be deleted */
-    PipeDscPtr->PipeId = PipeId;
+    /* Removing the transport writes to the queue again */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeTransport(PipeId, NULL, NULL));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(State.Count, 2);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Errors, only the owner can set the transport */
+    UtAssert_INT32_EQ(CFE_SB_SetPipeTransport(SB_UT_ALTERNATE_INVALID_PIPEID, UT_PipeTransport, &State),
+                      CFE_SB_BAD_ARGUMENT);
+    OrigOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(OrigOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeTransport(PipeId, UT_PipeTransport, &State), CFE_SB_BAD_ARGUMENT);
+    PipeDscPtr->AppId = OrigOwner;
+    UtAssert_NULL(PipeDscPtr->TransportFunc);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter, 2);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeTransport(PipeId, UT_PipeTransport, &State), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
 /*
-** Test receiving a message response to invalid timeout value (< -1)
+** Test sending messages with a pre-resolved route handle
 */
-void Test_ReceiveBuffer_InvalidTimeout(void)
+void Test_TransmitBufferToRoute(void)
 {
-    CFE_SB_Buffer_t *SBBufPtr;
-    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
-    uint32           PipeDepth = 10;
-    int32            TimeOut   = -5;
+    CFE_SB_PipeId_t      PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t      PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t       MsgId   = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t       MsgId2  = SB_UT_TLM_MID2;
+    CFE_MSG_Size_t       Size    = sizeof(SB_UT_Test_Tlm_t);
+    CFE_SB_RouteHandle_t Handle;
+    CFE_SB_RouteHandle_t Handle2;
+    CFE_SB_Buffer_t     *SendPtr;
+    CFE_SB_Buffer_t     *ReceivePtr;
+    uint32               Generation;
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "RoutePipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 4, "RoutePipe2"));
     UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_BAD_ARGUMENT);
-
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    /* Resolved while there are no subscribers, the message is dropped and the handle stays current */
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteHandle(MsgId, &Handle));
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle, false));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    UtAssert_UINT32_EQ(Handle.Generation, CFE_SB_Global.RouteGeneration);
+
+    /* A new route makes the handle stale, so it is resolved again when used */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    UtAssert_True(Handle.Generation != CFE_SB_Global.RouteGeneration, "Handle is stale after subscribe");
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle, false));
+    UtAssert_UINT32_EQ(Handle.Generation, CFE_SB_Global.RouteGeneration);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+
+    /* While current, the route in the handle is used without a lookup (shown by swapping in another route) */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId2));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteHandle(MsgId, &Handle));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteHandle(MsgId2, &Handle2));
+    Handle.RouteIdValue = Handle2.RouteIdValue;
+    SendPtr             = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle, false));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId2, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+
+    /* A handle for another message ID is not used, it is updated for the message ID that was sent */
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle2, false));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(Handle2.MsgId, MsgId));
+
+    /* A cleared handle is never current */
+    memset(&Handle, 0, sizeof(Handle));
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle, false));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+    UtAssert_UINT32_EQ(Handle.Generation, CFE_SB_Global.RouteGeneration);
+
+    /* Removing the route and adding a mask subscription both change the generation */
+    Generation = CFE_SB_Global.RouteGeneration;
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId1));
+    UtAssert_True(Generation != CFE_SB_Global.RouteGeneration, "Generation changed by unsubscribe");
+    Generation = CFE_SB_Global.RouteGeneration;
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(MsgId, 0xFFF0, PipeId1, CFE_SB_DEFAULT_QOS, 4));
+    UtAssert_True(Generation != CFE_SB_Global.RouteGeneration, "Generation changed by mask subscribe");
+
+    /* The mask subscription is found when the stale handle is used */
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferToRoute(SendPtr, &Handle, false));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+
+    /* Errors */
+    UtAssert_INT32_EQ(CFE_SB_GetRouteHandle(MsgId, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetRouteHandle(CFE_SB_INVALID_MSG_ID, &Handle), CFE_SB_BAD_ARGUMENT);
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferToRoute(NULL, &Handle, false), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferToRoute(SendPtr, NULL, false), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
+/* Counts the releases of a segment list, ReleaseArg points to the count */
+static void UT_SegmentRelease(const CFE_SB_SegmentList_t *SegListPtr)
+{
+    /* Must be called with the SB lock given */
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), UT_GetStubCount(UT_KEY(OS_MutSemGive)));
+
+    ++(*(uint32 *)SegListPtr->ReleaseArg);
+}
+
+/*
+** Test sending a message in segments to a segment aware pipe and a legacy pipe
+*/
+void Test_TransmitSegments(void)
+{
+    CFE_SB_PipeId_t      SegPipeId    = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t      LegacyPipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t       MsgId        = SB_UT_TLM_MID;
+    CFE_MSG_Type_t       Type         = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t       Size         = sizeof(SB_UT_Test_Tlm_t) + 32;
+    CFE_SB_Buffer_t     *SendPtr;
+    CFE_SB_Buffer_t     *ReceivePtr;
+    uint8                Payload[2][16];
+    CFE_SB_Segment_t     Segments[2];
+    CFE_SB_SegmentList_t SegList;
+    uint32               ReleaseCount;
+    const void          *DataPtr;
+    size_t               DataSize;
+
+    memset(Payload[0], 0xA5, sizeof(Payload[0]));
+    memset(Payload[1], 0x5A, sizeof(Payload[1]));
+    Segments[0].DataPtr = Payload[0];
+    Segments[0].Size    = sizeof(Payload[0]);
+    Segments[1].DataPtr = Payload[1];
+    Segments[1].Size    = sizeof(Payload[1]);
+    SegList.Segments    = Segments;
+    SegList.NumSegments = 2;
+    SegList.ReleaseFunc = UT_SegmentRelease;
+    SegList.ReleaseArg  = &ReleaseCount;
+    ReleaseCount        = 0;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&SegPipeId, 4, "SegmentPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeOpts(SegPipeId, CFE_SB_PIPEOPTS_SEGMENTS));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&LegacyPipeId, 4, "LegacyPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, SegPipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, LegacyPipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtr);
+    memset(SendPtr, 0x11, sizeof(SB_UT_Test_Tlm_t));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    /* The pipes hold the buffer and its copy, so the segments are not released yet */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitSegments(SendPtr, &SegList, false));
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_ZERO(ReleaseCount);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 2);
+
+    /* The segment aware pipe gets the buffer as it was sent */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, SegPipeId, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_GetSegment(ReceivePtr, 0, &DataPtr, &DataSize));
+    UtAssert_ADDRESS_EQ(DataPtr, SendPtr);
+    UtAssert_UINT32_EQ(DataSize, sizeof(SB_UT_Test_Tlm_t));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetSegment(ReceivePtr, 1, &DataPtr, &DataSize));
+    UtAssert_ADDRESS_EQ(DataPtr, Payload[0]);
+    UtAssert_UINT32_EQ(DataSize, sizeof(Payload[0]));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetSegment(ReceivePtr, 2, &DataPtr, &DataSize));
+    UtAssert_ADDRESS_EQ(DataPtr, Payload[1]);
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(ReceivePtr, 3, &DataPtr, &DataSize), CFE_SB_BAD_ARGUMENT);
+
+    /* The legacy pipe gets a copy of the whole message */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, LegacyPipeId, CFE_SB_POLL));
+    UtAssert_True(ReceivePtr != SendPtr, "Legacy pipe received a copy");
+    CFE_UtAssert_SUCCESS(CFE_SB_GetSegment(ReceivePtr, 0, &DataPtr, &DataSize));
+    UtAssert_UINT32_EQ(DataSize, Size);
+    UtAssert_MemCmp(DataPtr, SendPtr, sizeof(SB_UT_Test_Tlm_t), "Copy of buffer content");
+    UtAssert_MemCmp((const uint8 *)DataPtr + sizeof(SB_UT_Test_Tlm_t), Payload, sizeof(Payload), "Copy of segments");
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(ReceivePtr, 1, &DataPtr, &DataSize), CFE_SB_BAD_ARGUMENT);
+
+    /* Released once the last pipe lets go of the original buffer */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(SegPipeId));
+    UtAssert_UINT32_EQ(ReleaseCount, 1);
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(LegacyPipeId));
+    UtAssert_UINT32_EQ(ReleaseCount, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* Without subscribers the segments are released before returning */
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitSegments(SendPtr, &SegList, true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    UtAssert_UINT32_EQ(ReleaseCount, 2);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+}
+
+/*
+** Test error handling when sending a message in segments
+*/
+void Test_TransmitSegments_Errors(void)
+{
+    CFE_SB_PipeId_t      PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t       MsgId  = SB_UT_TLM_MID;
+    CFE_MSG_Type_t       Type   = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t       Size   = sizeof(SB_UT_Test_Tlm_t) + 16;
+    CFE_SB_BufferD_t     BadZeroCpyBuf;
+    CFE_SB_Buffer_t     *SendPtr;
+    uint8                Payload[16];
+    CFE_SB_Segment_t     Segment;
+    CFE_SB_SegmentList_t SegList;
+    uint32               ReleaseCount;
+    const void          *DataPtr;
+    size_t               DataSize;
+
+    memset(&BadZeroCpyBuf, 0, sizeof(BadZeroCpyBuf));
+    memset(Payload, 0, sizeof(Payload));
+    Segment.DataPtr     = Payload;
+    Segment.Size        = sizeof(Payload);
+    SegList.Segments    = &Segment;
+    SegList.NumSegments = 1;
+    SegList.ReleaseFunc = UT_SegmentRelease;
+    SegList.ReleaseArg  = &ReleaseCount;
+    ReleaseCount        = 0;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LegacyPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    SendPtr = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(NULL, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, NULL, false), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* Segment data must be given */
+    Segment.DataPtr = NULL;
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    Segment.DataPtr  = Payload;
+    SegList.Segments = NULL;
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    SegList.Segments = &Segment;
+
+    /* Commands can not be segmented */
+    Type = CFE_MSG_Type_Cmd;
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    Type = CFE_MSG_Type_Tlm;
+
+    /* Segments larger than the message, or a remainder too large for the buffer */
+    Size = sizeof(Payload) - 1;
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    Size = sizeof(SB_UT_Test_Tlm_t) + sizeof(Payload) + 1000;
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(SendPtr, &SegList, false), CFE_SB_BAD_ARGUMENT);
+    Size = sizeof(SB_UT_Test_Tlm_t) + sizeof(Payload);
+
+    /* Not a zero copy buffer */
+    UtAssert_INT32_EQ(CFE_SB_TransmitSegments(&BadZeroCpyBuf.Content, &SegList, false), CFE_SB_BUFFER_INVALID);
+
+    /* The buffer is still owned by the caller after all of the above, nothing was released */
+    UtAssert_ZERO(ReleaseCount);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+
+    /* The copy for the legacy pipe can not be allocated, the write fails but the segments are still released */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitSegments(SendPtr, &SegList, false));
+    CFE_UtAssert_EVENTSENT(CFE_SB_GET_BUF_ERR_EID);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_UINT32_EQ(ReleaseCount, 1);
+    UtAssert_UINT16_EQ(CFE_SB_LocatePipeDescByID(PipeId)->CurrentQueueDepth, 0);
+    UtAssert_ZERO(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId)->BuffCount);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* Bad arguments when getting a segment */
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(NULL, 0, &DataPtr, &DataSize), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(&BadZeroCpyBuf.Content, 0, NULL, &DataSize), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(&BadZeroCpyBuf.Content, 0, &DataPtr, NULL), CFE_SB_BAD_ARGUMENT);
+
+    /* Buffers that are not in use or not from the SB pool are not read */
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(&BadZeroCpyBuf.Content, 0, &DataPtr, &DataSize), CFE_SB_BUFFER_INVALID);
+    BadZeroCpyBuf.UseCount = 1;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetSegment(&BadZeroCpyBuf.Content, 0, &DataPtr, &DataSize));
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBufInfo), 1, CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_SB_GetSegment(&BadZeroCpyBuf.Content, 0, &DataPtr, &DataSize), CFE_SB_BUFFER_INVALID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+void UT_CFE_MSG_Verify_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    bool *IsAcceptable = UT_Hook_GetArgValueByName(Context, "IsAcceptable", bool *);
+
+    /* Return alternating false/true (this is needed to avoid an endless loop) */
+    *IsAcceptable = (UT_GetStubCount(FuncKey) & 1) == 0;
+}
+
+/*
+** Function for calling SB receive message API test functions
+*/
+void Test_ReceiveBuffer_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidPipeId);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidTimeout);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Poll);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Timeout);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferMulti);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferMulti_Errors);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferAny);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferAny_Wait);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferAny_Errors);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PriorityLane);
+    SB_UT_ADD_SUBTEST(Test_PipeReadyHandler);
+    SB_UT_ADD_SUBTEST(Test_PipeReadyHandler_Errors);
+}
+
+static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_BufferD_t      **OutData     = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t                 *size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    int32                   status;
+    static CFE_SB_BufferD_t LocalBuf;
+    CFE_SB_PipeD_t         *PipeDscPtr = UserObj;
+
+    memset(&LocalBuf, 0, sizeof(LocalBuf));
+    CFE_SB_TrackingListReset(&LocalBuf.Link);
+    LocalBuf.UseCount = 1;
+    *OutData          = &LocalBuf;
+    *size_copied      = sizeof(*OutData);
+    status            = OS_SUCCESS;
+    UT_Stub_SetReturnValue(FuncKey, status);
+
+    /* Modify the PipeID so it fails to match */
+    PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+}
+
+/* Special handler to hit OS_QueueGet error casses */
+static void SB_UT_QueueGetHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    size_t **data        = (size_t **)UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t  *size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    int32    status      = OS_SUCCESS;
+
+    *data = UserObj;
+
+    if (*data == NULL)
+    {
+        *size_copied = sizeof(CFE_SB_BufferD_t *);
+    }
+    else
+    {
+        *size_copied = *((size_t *)UserObj);
+    }
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+** Test receiving a message from the software bus with an invalid pipe ID
+*/
+void Test_ReceiveBuffer_InvalidPipeId(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  InvalidPipeId = SB_UT_ALTERNATE_INVALID_PIPEID;
+    CFE_SB_PipeId_t  PipeId        = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t  *PipeDscPtr;
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, InvalidPipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+
     CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    UT_ClearEventHistory();
+
+    /*
+     * The internal call to OS_QueueGet is done with the SB global unlocked, as other tasks must be able
+     * to access the SB global while another task is pending on a receive.  Because of this lock/unlock/relock
+     * pattern, the CFE_SB_ReceiveBuffer() function validates the pipeID twice, after each time it obtains the
+     * global SB lock.  The second check is to cover the corner case that the pipeID was deleted or reconfigured
+     * while it was pending.
+     *
+     * This case is harder to test for, need to set up a handler function that changes the pipe in between these
+     * two checks, such that the first check passes, but the second (identical) check fails.
+     */
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_PipeIdModifyHandler, PipeDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+
+    /* restore the PipeID so it can be deleted */
+    PipeDscPtr->PipeId = PipeId;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message response to invalid timeout value (< -1)
+*/
+void Test_ReceiveBuffer_InvalidTimeout(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
+    uint32           PipeDepth = 10;
+    int32            TimeOut   = -5;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message response when there is no message on the queue
+*/
+void Test_ReceiveBuffer_Poll(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
+    uint32           PipeDepth = 10;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message response to a timeout
+*/
+void Test_ReceiveBuffer_Timeout(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
+    uint32           PipeDepth = 10;
+    int32            TimeOut   = 200;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_TIME_OUT);
+
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message response to a pipe read error
+*/
+void Test_ReceiveBuffer_PipeReadError(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
+    uint32           PipeDepth = 10;
+    size_t           Data      = 1;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* Set handler to exercise error conditions for OS_QueueGet */
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetHandler, &Data);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetHandler, NULL);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 3);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message response to a "pend forever" timeout
+*/
+void Test_ReceiveBuffer_PendForever(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = 10;
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+
+    UtAssert_NOT_NULL(SBBufPtr);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+
+    /* Ensure that calling a second time with no message clears the LastBuffer reference */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a set of messages in a single call
+*/
+void Test_ReceiveBufferMulti(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth   = 10;
+    uint32           NumReceived = 99;
+    CFE_MSG_Size_t   Size        = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMultiTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    for (i = 0; i < 3; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+
+    /* First call should return a full set, with references retained by the pipe */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(NumReceived, 2);
+    UtAssert_UINT16_EQ(PipeDscPtr->LastBatchCount, 2);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[0]->Content, SBBufPtrs[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[1]->Content, SBBufPtrs[1]);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Second call releases the previous set and returns the remainder */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(NumReceived, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->LastBatchCount, 1);
+    UtAssert_NULL(PipeDscPtr->LastBatch[1]);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+
+    /* A single receive also releases the set */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT16_EQ(PipeDscPtr->LastBatchCount, 0);
+
+    /* Nothing left in the pipe */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test error handling when receiving a set of messages in a single call
+*/
+void Test_ReceiveBufferMulti_Errors(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth   = 10;
+    uint32           NumReceived = 99;
+    CFE_MSG_Size_t   Size        = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMultiTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(NULL, 2, &NumReceived, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    NumReceived = 99;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 0, &NumReceived, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+
+    /* Read error on the first read */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_PEND_FOREVER),
+                      CFE_SB_PIPE_RD_ERR);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    for (i = 0; i < 2; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    /* Read error after the first read cuts the set short but is not a failure */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(NumReceived, 1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* Message rejected by verification is dropped, and the next one is returned */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_VerificationAction), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+    UtAssert_UINT16_EQ(PipeDscPtr->LastBatchCount, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a message from any of a set of pipes
+*/
+void Test_ReceiveBufferAny(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeIds[2];
+    CFE_SB_PipeId_t  RcvPipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr[2];
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[0], 10, "RcvAnyTestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[1], 10, "RcvAnyTestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeIds[0]));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeIds[1]));
+    PipeDscPtr[0] = CFE_SB_LocatePipeDescByID(PipeIds[0]);
+    PipeDscPtr[1] = CFE_SB_LocatePipeDescByID(PipeIds[1]);
 
-    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* The first pipe in the set is checked first */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_POLL));
+    CFE_UtAssert_RESOURCEID_EQ(RcvPipeId, PipeIds[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr[0]->LastBuffer->Content, SBBufPtr);
+    UtAssert_UINT16_EQ(PipeDscPtr[0]->CurrentQueueDepth, 0);
+
+    /* An empty pipe is skipped, and the previous buffer is released */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_PEND_FOREVER));
+    CFE_UtAssert_RESOURCEID_EQ(RcvPipeId, PipeIds[1]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr[1]->LastBuffer->Content, SBBufPtr);
+    UtAssert_NULL(PipeDscPtr[0]->LastBuffer);
+    UtAssert_UINT16_EQ(PipeDscPtr[1]->CurrentQueueDepth, 0);
+
+    /* Nothing left in either pipe, no need to wait when polling */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(SBBufPtr);
+    UtAssert_NULL(PipeDscPtr[1]->LastBuffer);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 0);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[0]));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[1]));
+}
+
+/* Transmits a message while waiting in CFE_SB_ReceiveBufferAny() */
+static int32
+UT_TransmitOnBinSemTake(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    SB_UT_Test_Tlm_t *TlmPktPtr = UserObj;
+
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPktPtr->TelemetryHeader), true);
+
+    return StubRetcode;
 }
 
 /*
-** Test receiving a message response when there is no message on the queue
+** Test waiting for a message on a set of pipes
 */
-void Test_ReceiveBuffer_Poll(void)
+void Test_ReceiveBufferAny_Wait(void)
 {
     CFE_SB_Buffer_t *SBBufPtr;
-    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
-    uint32           PipeDepth = 10;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeIds[2];
+    CFE_SB_PipeId_t  RcvPipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr;
+    uint32           i;
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[0], 10, "RcvAnyTestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[1], 10, "RcvAnyTestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeIds[0]));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeIds[0]);
     UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    /* A message written while waiting wakes the task */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), UT_TransmitOnBinSemTake, &TlmPkt);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_PEND_FOREVER));
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), NULL, NULL);
+    CFE_UtAssert_RESOURCEID_EQ(RcvPipeId, PipeIds[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* The waiter is removed again, and the semaphore is kept */
+    UtAssert_ZERO(PipeDscPtr->WaiterMask);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.PipeWaiter[0].InUse);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CFE_SB_Global.PipeWaiter[0].SemId));
+
+    /* Timeout */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, 100), CFE_SB_TIME_OUT);
+    UtAssert_NULL(SBBufPtr);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
 
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    /* Error while waiting */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_PEND_FOREVER),
+                      CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(PipeDscPtr->WaiterMask);
 
-    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    /* No waiter entry available */
+    for (i = 0; i < CFE_SB_MAX_PIPE_WAITERS; ++i)
+    {
+        CFE_SB_Global.PipeWaiter[i].InUse = true;
+    }
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_PEND_FOREVER),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    memset(CFE_SB_Global.PipeWaiter, 0, sizeof(CFE_SB_Global.PipeWaiter));
+
+    /* Semaphore can not be created */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_PEND_FOREVER),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.PipeWaiter[0].InUse);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_SB_Global.PipeWaiter[0].SemId));
+
+    /* Deleting a pipe wakes its waiters */
+    PipeDscPtr->WaiterMask = 0x5;
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[0]));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 3);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[1]));
 }
 
 /*
-** Test receiving a message response to a timeout
+** Test error handling when receiving a message from any of a set of pipes
 */
-void Test_ReceiveBuffer_Timeout(void)
+void Test_ReceiveBufferAny_Errors(void)
 {
     CFE_SB_Buffer_t *SBBufPtr;
-    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
-    uint32           PipeDepth = 10;
-    int32            TimeOut   = 200;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeIds[CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES + 1];
+    CFE_SB_PipeId_t  RcvPipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t  *PipeDscPtr;
+    uint32           i;
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[0], 10, "RcvAnyTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeIds[0]));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeIds[0]);
     UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(NULL, &RcvPipeId, PipeIds, 1, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, NULL, PipeIds, 1, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, NULL, 1, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 0, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
 
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_TIME_OUT);
+    /* Too many pipes in the set (the same pipe repeated) */
+    UT_ClearEventHistory();
+    for (i = 1; i <= CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES; ++i)
+    {
+        PipeIds[i] = PipeIds[0];
+    }
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr,
+                                              &RcvPipeId,
+                                              PipeIds,
+                                              CFE_PLATFORM_SB_MAX_RECEIVE_ANY_PIPES + 1,
+                                              CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
 
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    /* Invalid pipe in the set */
+    UT_ClearEventHistory();
+    PipeIds[1] = SB_UT_ALTERNATE_INVALID_PIPEID;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 2, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
 
-    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    /* Read error */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 1, CFE_SB_PEND_FOREVER),
+                      CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* Message rejected by verification is dropped, and the pipe is checked again */
+    for (i = 0; i < 2; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_VerificationAction), 1, -1);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferAny(&SBBufPtr, &RcvPipeId, PipeIds, 1, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[0]));
 }
 
 /*
-** Test receiving a message response to a pipe read error
+** Test receiving from a pipe with a priority lane
 */
-void Test_ReceiveBuffer_PipeReadError(void)
+void Test_ReceiveBuffer_PriorityLane(void)
 {
     CFE_SB_Buffer_t *SBBufPtr;
-    CFE_SB_PipeId_t  PipeId    = CFE_SB_INVALID_PIPE;
-    uint32           PipeDepth = 10;
-    size_t           Data      = 1;
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_MsgId_t   MsgId    = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   MsgId2   = SB_UT_CMD_MID;
+    CFE_SB_Qos_t     HighPrio = {CFE_SB_QosPriority_HIGH, CFE_SB_QosReliability_LOW};
+    CFE_SB_PipeId_t  PipeId   = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size        = sizeof(TlmPkt);
+    uint32           NumReceived = 99;
+    CFE_SB_PipeD_t  *PipeDscPtr;
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "LaneTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, HighPrio, 4));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* One message on each lane, the normal one first */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId2, sizeof(MsgId2), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
     UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].CurrentQueueDepth, 1);
 
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    /* The high priority lane is read first */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].CurrentQueueDepth);
+    UtAssert_UINT16_EQ(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].CurrentQueueDepth, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
 
-    CFE_UtAssert_EVENTCOUNT(1);
+    /* The normal lane is read once the high priority lane is empty */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].CurrentQueueDepth);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 0);
 
-    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    /* Both lanes empty */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(SBBufPtr);
 
-    /* Set handler to exercise error conditions for OS_QueueGet */
-    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetHandler, &Data);
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
-    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetHandler, NULL);
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
-    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    /* A message on either lane ends the wait */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), UT_TransmitOnBinSemTake, &TlmPkt);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), NULL, NULL);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 1);
+    UtAssert_ZERO(PipeDscPtr->WaiterMask);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100), CFE_SB_TIME_OUT);
+
+    /* A batch is filled from the high priority lane first, then the normal lane */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId2, sizeof(MsgId2), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(NumReceived, 2);
+    UtAssert_UINT16_EQ(PipeDscPtr->LastBatchCount, 2);
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_HIGH].CurrentQueueDepth);
+    UtAssert_ZERO(PipeDscPtr->Lane[CFE_SB_QosPriority_LOW].CurrentQueueDepth);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+
+    /* A batch receive also waits on both lanes */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), UT_TransmitOnBinSemTake, &TlmPkt);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_PEND_FOREVER));
+    UT_SetHookFunction(UT_KEY(OS_BinSemTake), NULL, NULL);
+    UtAssert_UINT32_EQ(NumReceived, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 2);
+    UtAssert_ZERO(PipeDscPtr->WaiterMask);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(NumReceived, 0);
+    UtAssert_ZERO(PipeDscPtr->WaiterMask);
+
+    CFE_UtAssert_EVENTCOUNT(0);
     UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 3);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/* Counts calls to the pipe readiness handler */
+static void UT_PipeReadyHandler(CFE_SB_PipeId_t PipeId, void *Arg)
+{
+    uint32 *CountPtr = Arg;
+
+    ++(*CountPtr);
+}
+
 /*
-** Test receiving a message response to a "pend forever" timeout
+** Test the pipe readiness notification
 */
-void Test_ReceiveBuffer_PendForever(void)
+void Test_PipeReadyHandler(void)
 {
     CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_Buffer_t *SBBufPtrs[2];
     CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
     CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
     SB_UT_Test_Tlm_t TlmPkt;
-    uint32           PipeDepth = 10;
-    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
-    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+    CFE_MSG_Size_t   Size        = sizeof(TlmPkt);
+    uint32           NumReceived = 0;
+    uint32           Count       = 0;
     CFE_SB_PipeD_t  *PipeDscPtr;
 
     memset(&TlmPkt, 0, sizeof(TlmPkt));
 
-    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "ReadyTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
     PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
-    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
-    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
     UT_ClearEventHistory(); /* Clear events generated during test setup */
 
-    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    /* Setting the handler on an empty pipe only arms it */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeReadyHandler(PipeId, UT_PipeReadyHandler, &Count));
+    UtAssert_BOOL_TRUE(PipeDscPtr->ReadyArmed);
+    UtAssert_UINT32_EQ(Count, 0);
 
-    UtAssert_NOT_NULL(SBBufPtr);
-    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    /* Only the first message notifies, until the pipe is found empty again */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(Count, 1);
 
-    /* Ensure that calling a second time with no message clears the LastBuffer reference */
-    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_NO_MESSAGE);
-    UtAssert_NULL(PipeDscPtr->LastBuffer);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    /* Receiving does not arm it while there are messages left */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_BOOL_TRUE(PipeDscPtr->ReadyArmed);
+    UtAssert_UINT32_EQ(Count, 1);
+
+    /* A failed write does not notify, the handler is armed again */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true);
+    UtAssert_UINT32_EQ(Count, 1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_BOOL_TRUE(PipeDscPtr->ReadyArmed);
 
+    /* Unless a message from another sender is accounted for, which did not notify */
+    ++PipeDscPtr->CurrentQueueDepth;
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true);
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+    --PipeDscPtr->CurrentQueueDepth;
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_BOOL_TRUE(PipeDscPtr->ReadyArmed);
+
+    /*
+     * A message that is accounted for but not yet in the queue is found as an empty
+     * queue, this must notify right away instead of arming
+     */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(Count, 3);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL),
+                      CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 4);
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+
+    /* Same when the handler is set on a pipe that is not empty */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeReadyHandler(PipeId, UT_PipeReadyHandler, &Count));
+    UtAssert_UINT32_EQ(Count, 5);
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(NumReceived, 1);
+
+    /* Removing the handler stops notifications */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeReadyHandler(PipeId, NULL, NULL));
+    UtAssert_NULL(PipeDscPtr->ReadyHandler);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_BOOL_FALSE(PipeDscPtr->ReadyArmed);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(Count, 5);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test errors when setting the pipe readiness handler
+*/
+void Test_PipeReadyHandler_Errors(void)
+{
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *PipeDscPtr;
+    CFE_ES_AppId_t  OrigOwner;
+    uint32          Count = 0;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "ReadyTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    UtAssert_INT32_EQ(CFE_SB_SetPipeReadyHandler(SB_UT_ALTERNATE_INVALID_PIPEID, UT_PipeReadyHandler, &Count),
+                      CFE_SB_BAD_ARGUMENT);
+
+    /* Only the owner can set the handler */
+    OrigOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(OrigOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeReadyHandler(PipeId, UT_PipeReadyHandler, &Count), CFE_SB_BAD_ARGUMENT);
+    PipeDscPtr->AppId = OrigOwner;
+    UtAssert_NULL(PipeDscPtr->ReadyHandler);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter, 2);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeReadyHandler(PipeId, UT_PipeReadyHandler, &Count),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Arming a pipe that is gone has no effect */
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_VOIDCALL(CFE_SB_PipeReady_Arm(PipeId));
+    UtAssert_UINT32_EQ(Count, 0);
 }
 
 /*
@@ -4829,8 +6649,11 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_ReqToSendEvent_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_BufCache);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_Latency);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubResubPath);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubReusedRoute);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_FalseEndpoint);
     SB_UT_ADD_SUBTEST(Test_RecieveBuffer_VerificationFail);
     SB_UT_ADD_SUBTEST(Test_MessageString);
@@ -4969,6 +6792,173 @@ void Test_CFE_SB_Buffers(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test the cache of released buffers in front of the SB buffer pool
+*/
+void Test_CFE_SB_BufCache(void)
+{
+    static const size_t BlockSizes[] = {1024, sizeof(CFE_SB_BufferD_t) + 16, 4096};
+    CFE_SB_BufferD_t   *bd1;
+    CFE_SB_BufferD_t   *bd2;
+    CFE_SB_BufferD_t   *bdset[CFE_PLATFORM_SB_BUF_CACHE_DEPTH + 1];
+    uint32              i;
+
+    /* No block sizes means no caching */
+    CFE_SB_BufCacheInit(0, NULL);
+    UtAssert_NULL(CFE_SB_BufCacheFindClass(1));
+
+    /* Classes should be sorted by size */
+    CFE_SB_BufCacheInit(3, BlockSizes);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.NumCacheClasses, 3);
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheFindClass(1), &CFE_SB_Global.Mem.Cache[0]);
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheFindClass(1000), &CFE_SB_Global.Mem.Cache[1]);
+    UtAssert_ADDRESS_EQ(CFE_SB_BufCacheFindClass(4096), &CFE_SB_Global.Mem.Cache[2]);
+    UtAssert_NULL(CFE_SB_BufCacheFindClass(4097));
+
+    /* First allocation is a miss, once released it should be cached rather than returned to the pool */
+    bd1 = CFE_SB_GetBufferFromPool(100);
+    UtAssert_NOT_NULL(bd1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheMisses, 1);
+    CFE_SB_ReturnBufferToPool(bd1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT16_EQ(CFE_SB_Global.Mem.Cache[1].Count, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+
+    /* Another allocation in the same class is a hit and gets the same buffer back */
+    bd2 = CFE_SB_GetBufferFromPool(200);
+    UtAssert_ADDRESS_EQ(bd2, bd1);
+    UtAssert_UINT32_EQ(bd2->AllocatedSize, 200 + offsetof(CFE_SB_BufferD_t, Content));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufCacheHits, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_ZERO(CFE_SB_Global.Mem.Cache[1].Count);
+    CFE_SB_ReturnBufferToPool(bd2);
+
+    /* Once the cache is full, buffers are returned to the pool */
+    for (i = 0; i <= CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        bdset[i] = CFE_SB_GetBufferFromPool(100);
+        UtAssert_NOT_NULL(bdset[i]);
+    }
+    for (i = 0; i <= CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        CFE_SB_ReturnBufferToPool(bdset[i]);
+    }
+    UtAssert_UINT16_EQ(CFE_SB_Global.Mem.Cache[1].Count, CFE_PLATFORM_SB_BUF_CACHE_DEPTH);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    /* Allocations that do not fit any class bypass the cache */
+    bd1 = CFE_SB_GetBufferFromPool(5000);
+    UtAssert_NOT_NULL(bd1);
+    CFE_SB_ReturnBufferToPool(bd1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    /* Pool allocation failure is still reported */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetBufferFromPool(5000));
+
+    CFE_SB_BufCacheInit(0, NULL);
+}
+
+
+/*
+** Test the message latency histograms
+*/
+void Test_CFE_SB_Latency(void)
+{
+    CFE_SB_LatencyHistogram_t Hist;
+    CFE_SB_PipeD_t            PipeDsc;
+    CFE_SB_BufferD_t          BufDsc;
+    CFE_SB_Buffer_t          *SBBufPtr;
+    CFE_SB_Buffer_t          *SBBufPtrs[2];
+    CFE_SB_PipeId_t           PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t            MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeD_t           *PipeDscPtr;
+    CFE_SBR_RouteId_t         RouteId;
+    SB_UT_Test_Tlm_t          TlmPkt;
+    CFE_MSG_Size_t            Size        = sizeof(TlmPkt);
+    uint32                    NumReceived = 0;
+
+    /* Bin 0 is below 1 usec, bin N is [2^(N-1), 2^N) usec, the last bin takes everything longer */
+    memset(&Hist, 0, sizeof(Hist));
+    CFE_SB_LatencyHistogram_Add(&Hist, 0);
+    CFE_SB_LatencyHistogram_Add(&Hist, 1);
+    CFE_SB_LatencyHistogram_Add(&Hist, 2);
+    CFE_SB_LatencyHistogram_Add(&Hist, 3);
+    CFE_SB_LatencyHistogram_Add(&Hist, 4);
+    CFE_SB_LatencyHistogram_Add(&Hist, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(Hist.MsgCount, 6);
+    UtAssert_UINT32_EQ(Hist.MaxLatency, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(Hist.Bin[0], 1);
+    UtAssert_UINT32_EQ(Hist.Bin[1], 1);
+    UtAssert_UINT32_EQ(Hist.Bin[2], 2);
+    UtAssert_UINT32_EQ(Hist.Bin[3], 1);
+    UtAssert_UINT32_EQ(Hist.Bin[CFE_MISSION_SB_LATENCY_HIST_BINS - 1], 1);
+
+    /* Ticks are converted to usec, no route to update for an unrouted buffer */
+    memset(&PipeDsc, 0, sizeof(PipeDsc));
+    memset(&BufDsc, 0, sizeof(BufDsc));
+    BufDsc.DestRouteId                   = CFE_SBR_INVALID_ROUTE_ID;
+    BufDsc.TransmitTicks                 = 1000;
+    CFE_SB_Global.TimebaseTicksPerSecond = 10000000;
+    CFE_SB_RecordLatency(&PipeDsc, &BufDsc, 1000 + 300);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.MaxLatency, 30);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.Bin[5], 1);
+
+    /* Timebase going backwards counts as zero */
+    CFE_SB_RecordLatency(&PipeDsc, &BufDsc, 500);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.Bin[0], 1);
+
+    /* Very long times are limited, not wrapped */
+    CFE_SB_RecordLatency(&PipeDsc, &BufDsc, 0xFFFFFFFFFFFFFFFF);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.MaxLatency, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.MsgCount, 3);
+
+    /* Nothing is recorded without a timebase rate */
+    CFE_SB_Global.TimebaseTicksPerSecond = 0;
+    CFE_SB_RecordLatency(&PipeDsc, &BufDsc, 2000);
+    UtAssert_UINT32_EQ(PipeDsc.Latency.MsgCount, 3);
+
+    /* Timebase registers are combined with or without a rollover value (stub leaves them zero) */
+    CFE_SB_Global.TimebaseLow32Rollover = 0;
+    UtAssert_ZERO(CFE_SB_GetTimebaseTicks());
+    CFE_SB_Global.TimebaseLow32Rollover = 1000000;
+    UtAssert_ZERO(CFE_SB_GetTimebaseTicks());
+    CFE_SB_Global.TimebaseLow32Rollover = 0;
+
+    /* Messages are counted on the pipe and route when received, singly or in a batch */
+    CFE_SB_Global.LatencyStatsEnabled    = true;
+    CFE_SB_Global.TimebaseTicksPerSecond = 1000000;
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "LatencyPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RouteId    = CFE_SBR_GetRouteId(MsgId);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(PipeDscPtr->Latency.MsgCount, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)].MsgCount, 1);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferMulti(SBBufPtrs, 2, &NumReceived, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(NumReceived, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->Latency.MsgCount, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)].MsgCount, 2);
+
+    /* A new route starts with an empty histogram */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+    UtAssert_ZERO(CFE_SB_Global.RouteLatency[CFE_SBR_RouteIdToValue(RouteId)].MsgCount);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
 /*
 ** Test internal function to get the pipe table index for the given pipe ID
 */
@@ -5039,6 +7029,50 @@ void Test_ReceiveBuffer_UnsubResubPath(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test receiving a message after unsubscribing to it, then subscribing to
+** another message that reuses its route while it's in the pipe
+*/
+void Test_ReceiveBuffer_UnsubReusedRoute(void)
+{
+    CFE_SB_Buffer_t       *SBBufPtr;
+    CFE_SB_MsgId_t         MsgId  = SB_UT_TLM_MID1;
+    CFE_SB_MsgId_t         MsgId2 = SB_UT_TLM_MID2;
+    CFE_SB_PipeId_t        PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    uint32                 PipeDepth = 10;
+    CFE_MSG_Type_t         Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    /* The new subscription takes over the route of the message still in the pipe */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(MsgId2)), CFE_SBR_RouteIdToValue(RouteId));
+    DestPtr            = CFE_SB_GetDestPtr(RouteId, PipeId);
+    DestPtr->BuffCount = 1;
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_NOT_NULL(SBBufPtr);
+
+    /* The count of the other message ID must not be changed */
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+    UtAssert_NULL(CFE_SB_GetBufferDestPtr(CFE_SB_LocatePipeDescByID(PipeId)->LastBuffer, PipeId));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test receiving a message response to an unsubscribing to message, then
 ** resubscribing to it while it's in the pipe however with Txn->IsEndpoint
@@ -376,6 +376,18 @@ void Test_SB_Cmds_RstCtrs(void);
 ******************************************************************************/
 void Test_SB_Cmds_Stats(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send SB stats command with latency statistics enabled
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_StatsLatency(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send routing information command default/nominal path
@@ -769,6 +781,42 @@ void Test_SB_Cmds_MapInfoAlreadyPending(void);
 ******************************************************************************/
 void Test_SB_Cmds_MapInfoDataGetter(void);
 
+/*****************************************************************************/
+/**
+** \brief Test write latency information command nominal path
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_LatencyInfoDef(void);
+
+/*****************************************************************************/
+/**
+** \brief Test write latency information command when already pending
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_LatencyInfoAlreadyPending(void);
+
+/*****************************************************************************/
+/**
+** \brief Test latency information data getter function
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_LatencyInfoDataGetter(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test command to enable a specific route using a valid route
@@ -1590,6 +1638,73 @@ void Test_Subscribe_SubscriptionReporting(void);
 ******************************************************************************/
 void Test_Subscribe_InvalidPipeOwner(void);
 
+/*****************************************************************************/
+/**
+** \brief Test checking whether a message ID has active subscribers
+**
+** \par Description
+**        This function tests CFE_SB_HasSubscribers, including disabled
+**        destinations and message IDs sharing a subscriber presence entry.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_HasSubscribers(void);
+
+/*****************************************************************************/
+/**
+** \brief Test creation of the priority lane of a pipe
+**
+** \par Description
+**        This function tests that a high priority subscription creates the
+**        priority lane of a pipe, and falls back to the normal lane if the
+**        lane can not be created.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_PriorityLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test subscribing to a set of message IDs with a value and mask
+**
+** \par Description
+**        This function tests that a mask subscription adds its pipe to existing
+**        and newly looked up routes of matching message IDs, interacts with
+**        explicit subscriptions of the same pipe, and is removed again.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_Mask(void);
+
+/*****************************************************************************/
+/**
+** \brief Test mask subscription error handling
+**
+** \par Description
+**        This function tests the response of the mask subscription functions
+**        to an invalid pipe, a pipe owned by another application, a duplicate
+**        subscription and a full mask subscription table.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_Mask_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB unsubscribe API test functions
@@ -1787,6 +1902,22 @@ void Test_Unsubscribe_MiddleDestWithMany(void);
 ******************************************************************************/
 void Test_Unsubscribe_GetDestPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief  Test that removing the last destination of a message releases its route
+**
+** \par Description
+**        This function tests that the route of a message ID is removed when
+**        its last subscription is removed, and added again on a new subscription.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Unsubscribe_RemovesRoute(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB send message API test functions
@@ -1850,6 +1981,23 @@ void Test_TransmitMsg_InvalidMsgId(void);
 ******************************************************************************/
 void Test_TransmitMsg_NoSubscribers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending a message with no subscribers that shares a presence entry
+**
+** \par Description
+**        This function tests the response to sending a message which has no
+**        subscribers, where another message ID sharing its subscriber presence
+**        entry is subscribed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_NoSubscribersSharedPresence(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message with the message size larger
@@ -2029,6 +2177,38 @@ void Test_TransmitMsg_ZeroCopyBufferValidate(void);
 ******************************************************************************/
 void Test_TransmitBuffer_NoIncrement(void);
 
+/*****************************************************************************/
+/**
+** \brief Test successfully sending a set of messages in zero copy mode
+**
+** \par Description
+**        This function tests successfully sending a set of messages in zero
+**        copy mode, including ordering of the messages on each pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBufferBatch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test error handling when sending a set of messages in zero copy mode
+**
+** \par Description
+**        This function tests the response to null arrays, null buffers, and
+**        duplicate buffers passed to the batch zero copy transmit.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBufferBatch_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing a pointer to a buffer for zero copy mode
@@ -2061,6 +2241,90 @@ void Test_ReleaseMessageBuffer(void);
 ******************************************************************************/
 void Test_TransmitMsg_DisabledDestination(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send message queue statistics of a priority lane
+**
+** \par Description
+**        This function tests the per-lane queue depth and overflow statistics
+**        of a pipe with a priority lane.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_PriorityLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending to a pipe with a transport function
+**
+** \par Description
+**        This function tests that messages to a pipe with a transport function
+**        are passed to it instead of the queue, and that transport errors are
+**        reported as pipe write errors.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_PipeTransport(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending a message in segments
+**
+** \par Description
+**        This function tests that a pipe with the segments option receives
+**        the buffer and segments as sent, that other pipes receive a
+**        contiguous copy, and that the segments are released once no pipe
+**        holds the message.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitSegments(void);
+
+/*****************************************************************************/
+/**
+** \brief Test error handling when sending a message in segments
+**
+** \par Description
+**        This function tests the argument checks of CFE_SB_TransmitSegments and
+**        CFE_SB_GetSegment, and the failure to allocate the contiguous copy.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitSegments_Errors(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending messages with a route handle
+**
+** \par Description
+**        This function tests that a current route handle is used without a
+**        lookup, and that a stale, cleared or mismatched handle falls back
+**        to the lookup and is updated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBufferToRoute(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test CFE_SB_TransmitTxn_BroadcastToRoute
@@ -2237,6 +2501,135 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving a set of messages in a single call
+**
+** \par Description
+**        This function tests receiving multiple messages with a single call,
+**        including the release of the previous set on the next call.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferMulti(void);
+
+/*****************************************************************************/
+/**
+** \brief Test error handling when receiving a set of messages in a single call
+**
+** \par Description
+**        This function tests the response to bad arguments, pipe read errors,
+**        and verification failures during a multi-message receive.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferMulti_Errors(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving a message from any of a set of pipes
+**
+** \par Description
+**        This function tests receiving from a set of pipes, including
+**        skipping empty pipes and polling when all pipes are empty.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferAny(void);
+
+/*****************************************************************************/
+/**
+** \brief Test waiting for a message on a set of pipes
+**
+** \par Description
+**        This function tests waking a task waiting on a set of pipes, as
+**        well as timeouts and errors while waiting.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferAny_Wait(void);
+
+/*****************************************************************************/
+/**
+** \brief Test error handling when receiving from any of a set of pipes
+**
+** \par Description
+**        This function tests the response to bad arguments, pipe read errors,
+**        and verification failures when receiving from a set of pipes.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferAny_Errors(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving from a pipe with a priority lane
+**
+** \par Description
+**        This function tests that the priority lane of a pipe is read first,
+**        and that single and batch receives wait on both lanes.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_PriorityLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the pipe readiness notification
+**
+** \par Description
+**        This function tests that the readiness handler is called on the
+**        first message after the pipe was found empty, and right away when
+**        a message is in the middle of being sent.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PipeReadyHandler(void);
+
+/*****************************************************************************/
+/**
+** \brief Test errors when setting the pipe readiness handler
+**
+** \par Description
+**        This function tests the response to an invalid pipe ID, a caller
+**        that does not own the pipe, and an app ID error.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PipeReadyHandler_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2442,6 +2835,38 @@ void Test_PutDestBlk_ErrLogic(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the cache of released buffers in front of the SB buffer pool
+**
+** \par Description
+**        This function tests that released buffers are re-used for later
+**        allocations of the same block size, up to the configured depth.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_BufCache(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the message latency histograms
+**
+**
+** \par Description
+**        This function tests the latency bins and conversion, and that messages
+**        are counted on the pipe and route when received.
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_Latency(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
@@ -2473,6 +2898,23 @@ void Test_CFE_SB_BadPipeInfo(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_UnsubResubPath(void);
 
+/*****************************************************************************/
+/**
+** \brief Test ReceiveBuffer function unsubscribe path with the route reused
+**
+** \par Description
+**        This function tests receiving a message after it is unsubscribed and
+**        its route is reused by a subscription to another message, which must
+**        not have its buffer count changed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_UnsubReusedRoute(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test ReceiveBuffer function unsubscribe/resubscribe path with a false
@@ -73,6 +73,7 @@ extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_ROUTING_INFO_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_PIPE_INFO_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_MAP_INFO_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_LATENCY_INFO_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SEND_HK;
@@ -99,3 +99,43 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     return routeid;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)] = CFE_SBR_INVALID_ROUTE_ID;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetProbeHistogram(uint32 *HistogramPtr, uint32 NumBins)
+{
+    CFE_SB_MsgId_Atom_t msgidx;
+
+    if (NumBins == 0)
+    {
+        return;
+    }
+
+    memset(HistogramPtr, 0, NumBins * sizeof(*HistogramPtr));
+
+    /* Direct lookup never collides, every route is found on the first probe */
+    for (msgidx = 0; msgidx < CFE_SBR_MSG_MAP_SIZE; msgidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[msgidx]))
+        {
+            HistogramPtr[0]++;
+        }
+    }
+}
@@ -173,3 +173,95 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     return routeid;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hole;
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t home;
+    CFE_SBR_RouteId_t   routeid;
+
+    if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        return;
+    }
+
+    /* Find the map entry, same search as CFE_SBR_GetRouteId */
+    hole    = CFE_SBR_MsgIdHash(MsgId);
+    routeid = CFE_SBR_MSGMAP[hole];
+    while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
+    {
+        hole    = (hole + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        routeid = CFE_SBR_MSGMAP[hole];
+    }
+
+    if (!CFE_SBR_IsValidRouteId(routeid))
+    {
+        /* Not in the map */
+        return;
+    }
+
+    /*
+     * Backward shift deletion: simply emptying the slot would break the probe
+     * sequence of any later entry that collided past it.  Instead, walk the rest
+     * of the cluster and move back into the hole each entry whose home position
+     * is not between the hole and its current position.  This leaves the map as
+     * if the removed entry had never been added, so probe lengths don't grow
+     * over time as routes come and go, and no tombstones are needed.
+     */
+    hash = (hole + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash]))
+    {
+        home = CFE_SBR_MsgIdHash(CFE_SBR_GetMsgId(CFE_SBR_MSGMAP[hash]));
+
+        /* Entry can move if the distance from its home exceeds the distance from the hole */
+        if (((hash - home) & (CFE_SBR_MSG_MAP_SIZE - 1)) >= ((hash - hole) & (CFE_SBR_MSG_MAP_SIZE - 1)))
+        {
+            CFE_SBR_MSGMAP[hole] = CFE_SBR_MSGMAP[hash];
+            hole                 = hash;
+        }
+
+        hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    }
+
+    CFE_SBR_MSGMAP[hole] = CFE_SBR_INVALID_ROUTE_ID;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetProbeHistogram(uint32 *HistogramPtr, uint32 NumBins)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t probes;
+
+    if (NumBins == 0)
+    {
+        return;
+    }
+
+    memset(HistogramPtr, 0, NumBins * sizeof(*HistogramPtr));
+
+    for (hash = 0; hash < CFE_SBR_MSG_MAP_SIZE; hash++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash]))
+        {
+            /* Probe length is the distance from the home position, accounting for wrap */
+            probes = (hash - CFE_SBR_MsgIdHash(CFE_SBR_GetMsgId(CFE_SBR_MSGMAP[hash]))) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            if (probes >= NumBins)
+            {
+                probes = NumBins - 1;
+            }
+
+            HistogramPtr[probes]++;
+        }
+    }
+}
@@ -0,0 +1,280 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+ * Keyed hash routing map implementation
+ *
+ * Same hash and linear probing as the hash map implementation, but each map
+ * slot holds the message ID along with the route ID.  Probing compares the
+ * message ID in the slot itself instead of looking it up in the routing table,
+ * so a lookup normally only touches the map.  Each slot is 8 bytes instead of
+ * 2 (for a 32 bit message ID) in exchange for fewer cache misses per lookup.
+ *
+ * Notes:
+ *   These functions manipulate/access global variables and need
+ *   to be protected by the SB Shared data lock.
+ *
+ */
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_sb.h"
+
+#include <string.h>
+
+/*
+ * Macro Definitions
+ */
+
+/**
+ * \brief Message map size
+ *
+ * See the hash map implementation, the same sizing constraints apply
+ */
+#define CFE_SBR_MSG_MAP_SIZE (4 * CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/* Verify power of two */
+#if ((CFE_SBR_MSG_MAP_SIZE & (CFE_SBR_MSG_MAP_SIZE - 1)) != 0)
+#error CFE_SBR_MSG_MAP_SIZE must be a power of 2 for hash algorithm to work
+#endif
+
+/** \brief Hash algorithm magic number
+ *
+ * Ref:
+ * https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key/12996028#12996028
+ */
+#define CFE_SBR_HASH_MAGIC (0x45d9f3b)
+
+/******************************************************************************
+ * Type Definitions
+ */
+
+/** \brief Message map slot, route ID is invalid if the slot is empty */
+typedef struct
+{
+    CFE_SB_MsgId_t    MsgId;   /**< \brief Message ID the route is for */
+    CFE_SBR_RouteId_t RouteId; /**< \brief Route ID for the message ID */
+} CFE_SBR_MapSlot_t;
+
+/******************************************************************************
+ * Shared data
+ */
+
+/** \brief Message map shared data */
+CFE_SBR_MapSlot_t CFE_SBR_MSGMAP[CFE_SBR_MSG_MAP_SIZE];
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Hashes the message id
+ *
+ * Note: algorithm designed for a 32 bit int, changing the size of
+ * CFE_SB_MsgId_Atom_t may require an update to this implementation
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MsgId_Atom_t CFE_SBR_MsgIdHash(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+
+    hash = CFE_SB_MsgIdToValue(MsgId);
+
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = (hash >> 16) ^ hash;
+
+    /* Reduce to fit in map */
+    hash &= CFE_SBR_MSG_MAP_SIZE - 1;
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finds the map slot for the message id, or the empty slot that
+ * ends its probe sequence if it is not in the map
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MsgId_Atom_t CFE_SBR_FindSlot(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+
+    hash = CFE_SBR_MsgIdHash(MsgId);
+
+    /*
+     * Increment from original hash to find matching slot.
+     * Since map is larger than possible routes this will
+     * never deadlock
+     */
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash].RouteId) &&
+           !CFE_SB_MsgId_Equal(CFE_SBR_MSGMAP[hash].MsgId, MsgId))
+    {
+        /* Increment or loop to start of array */
+        hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init_Map(void)
+{
+    /* Clear the shared data */
+    memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    uint32              collisions = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        hash = CFE_SBR_MsgIdHash(MsgId);
+
+        /*
+         * Increment from original hash to find the next open slot.
+         * Since map is larger than possible routes this will
+         * never deadlock
+         */
+        while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash].RouteId))
+        {
+            /* Increment or loop to start of array */
+            hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            collisions++;
+        }
+
+        CFE_SBR_MSGMAP[hash].MsgId   = MsgId;
+        CFE_SBR_MSGMAP[hash].RouteId = RouteId;
+    }
+
+    return collisions;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_RouteId_t routeid = CFE_SBR_INVALID_ROUTE_ID;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        /* Slot found is empty (invalid route) if not in the map */
+        routeid = CFE_SBR_MSGMAP[CFE_SBR_FindSlot(MsgId)].RouteId;
+    }
+
+    return routeid;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hole;
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t home;
+
+    if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        return;
+    }
+
+    hole = CFE_SBR_FindSlot(MsgId);
+    if (!CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hole].RouteId))
+    {
+        /* Not in the map */
+        return;
+    }
+
+    /* Backward shift deletion, see the hash map implementation */
+    hash = (hole + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash].RouteId))
+    {
+        home = CFE_SBR_MsgIdHash(CFE_SBR_MSGMAP[hash].MsgId);
+
+        /* Entry can move if the distance from its home exceeds the distance from the hole */
+        if (((hash - home) & (CFE_SBR_MSG_MAP_SIZE - 1)) >= ((hash - hole) & (CFE_SBR_MSG_MAP_SIZE - 1)))
+        {
+            CFE_SBR_MSGMAP[hole] = CFE_SBR_MSGMAP[hash];
+            hole                 = hash;
+        }
+
+        hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    }
+
+    CFE_SBR_MSGMAP[hole].MsgId   = CFE_SB_INVALID_MSG_ID;
+    CFE_SBR_MSGMAP[hole].RouteId = CFE_SBR_INVALID_ROUTE_ID;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetProbeHistogram(uint32 *HistogramPtr, uint32 NumBins)
+{
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t probes;
+
+    if (NumBins == 0)
+    {
+        return;
+    }
+
+    memset(HistogramPtr, 0, NumBins * sizeof(*HistogramPtr));
+
+    for (hash = 0; hash < CFE_SBR_MSG_MAP_SIZE; hash++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash].RouteId))
+        {
+            /* Probe length is the distance from the home position, accounting for wrap */
+            probes = (hash - CFE_SBR_MsgIdHash(CFE_SBR_MSGMAP[hash].MsgId)) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            if (probes >= NumBins)
+            {
+                probes = NumBins - 1;
+            }
+
+            HistogramPtr[probes]++;
+        }
+    }
+}
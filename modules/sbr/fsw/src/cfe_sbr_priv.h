@@ -58,4 +58,19 @@ void CFE_SBR_Init_Map(void);
  */
 uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes the association of the given message ID with its route ID
+ *
+ * Used for implementations that use a mapping table, when the route is removed.
+ * After this call the route ID for the message ID will be invalid.
+ *
+ * \note Must be called while the message ID is still associated with the route
+ *       in the routing table, since the map implementation may need it to
+ *       locate the entry.
+ *
+ * \param[in] MsgId Message id to remove from the map
+ */
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId);
+
 #endif /* CFE_SBR_PRIV_H */
@@ -48,13 +48,16 @@ typedef struct
     CFE_SB_DestinationD_t  *ListHeadPtr; /**< \brief Destination list head */
     CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
     CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    bool                    IsFree;      /**< \brief Entry was removed and is on the free list */
+    CFE_SBR_RouteId_t       NextFree;    /**< \brief Next entry on the free list */
 } CFE_SBR_RouteEntry_t;
 
 /** \brief Module data */
 typedef struct
 {
     CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS]; /**< \brief Routing table */
-    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First unused entry in RoutingTbl */
+    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First never used entry in RoutingTbl */
+    CFE_SBR_RouteId_t     FreeHead;                                /**< \brief Head of the removed entries list */
 } cfe_sbr_route_data_t;
 
 /******************************************************************************
@@ -93,16 +96,33 @@ void CFE_SBR_Init(void)
  *-----------------------------------------------------------------*/
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 {
-    CFE_SBR_RouteId_t routeid    = CFE_SBR_INVALID_ROUTE_ID;
-    uint32            collisions = 0;
+    CFE_SBR_RouteId_t     routeid    = CFE_SBR_INVALID_ROUTE_ID;
+    uint32                collisions = 0;
+    CFE_SBR_RouteEntry_t *entryptr;
 
-    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
+    if (CFE_SB_IsValidMsgId(MsgId))
     {
-        routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
-        collisions = CFE_SBR_SetRouteId(MsgId, routeid);
+        /* Reuse a removed entry if available, so the table does not only ever grow */
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_RDATA.FreeHead))
+        {
+            routeid                = CFE_SBR_RDATA.FreeHead;
+            entryptr               = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(routeid)];
+            CFE_SBR_RDATA.FreeHead = entryptr->NextFree;
+            entryptr->IsFree       = false;
+            entryptr->NextFree     = CFE_SBR_INVALID_ROUTE_ID;
+        }
+        else if (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS)
+        {
+            routeid = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
+            CFE_SBR_RDATA.RouteIdxTop++;
+        }
+
+        if (CFE_SBR_IsValidRouteId(routeid))
+        {
+            collisions = CFE_SBR_SetRouteId(MsgId, routeid);
 
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
-        CFE_SBR_RDATA.RouteIdxTop++;
+            CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(routeid)].MsgId = MsgId;
+        }
     }
 
     if (CollisionsPtr != NULL)
@@ -113,6 +133,39 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
     return routeid;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_RemoveRoute(CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SBR_RouteEntry_t *entryptr;
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        entryptr = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)];
+
+        if (!entryptr->IsFree && CFE_SBR_RouteIdToValue(RouteId) < CFE_SBR_RDATA.RouteIdxTop)
+        {
+            /* Map may need the message ID to find the entry, so clear it from the map first */
+            CFE_SBR_ClearRouteId(entryptr->MsgId);
+
+            entryptr->ListHeadPtr = NULL;
+            entryptr->MsgId       = CFE_SB_INVALID_MSG_ID;
+            entryptr->SeqCnt      = 0;
+
+            /*
+             * Entries are not moved, so any route ID held by an in-progress
+             * CFE_SBR_ForEachRouteId (e.g. when deleting a pipe) stays valid
+             */
+            entryptr->IsFree       = true;
+            entryptr->NextFree     = CFE_SBR_RDATA.FreeHead;
+            CFE_SBR_RDATA.FreeHead = RouteId;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -221,6 +274,10 @@ void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE
 
     for (routeidx = startidx; routeidx < endidx; routeidx++)
     {
-        (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
+        /* Skip removed entries */
+        if (!CFE_SBR_RDATA.RoutingTbl[routeidx].IsFree)
+        {
+            (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
+        }
     }
 }
@@ -28,6 +28,7 @@
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * Reasonable limit on loops in case CFE_PLATFORM_SB_HIGHEST_VALID_MSGID is large
@@ -133,6 +134,39 @@ void Test_SBR_Map_Direct(void)
     UtPrintf("Valid route id's encountered in performance loop: %u", (unsigned int)count);
 }
 
+void Test_SBR_Map_Direct_Remove(void)
+{
+    CFE_SB_MsgId_t msgid;
+    uint32         histogram[2];
+
+    UtPrintf("Invalid msg checks");
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(CFE_SB_INVALID_MSG_ID));
+
+    UtPrintf("Initialize map");
+    CFE_SBR_Init_Map();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Histogram counts all routes as found on the first probe");
+    msgid = CFE_SB_ValueToMsgId(CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
+    CFE_SBR_SetRouteId(msgid, CFE_SBR_ValueToRouteId(0));
+    CFE_SBR_SetRouteId(CFE_SB_ValueToMsgId(1), CFE_SBR_ValueToRouteId(1));
+    memset(histogram, 0xFF, sizeof(histogram));
+    CFE_SBR_GetProbeHistogram(histogram, 2);
+    UtAssert_UINT32_EQ(histogram[0], 2);
+    UtAssert_ZERO(histogram[1]);
+    UtAssert_VOIDCALL(CFE_SBR_GetProbeHistogram(histogram, 0));
+
+    UtPrintf("Clear an entry");
+    CFE_SBR_ClearRouteId(msgid);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid)));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(1))));
+    CFE_SBR_GetProbeHistogram(histogram, 2);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -140,4 +174,5 @@ void UtTest_Setup(void)
     UtPrintf("Software Bus Routing direct map coverage test...");
 
     UT_ADD_TEST(Test_SBR_Map_Direct);
+    UT_ADD_TEST(Test_SBR_Map_Direct_Remove);
 }
@@ -27,6 +27,7 @@
 #include "ut_support.h"
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
+#include <string.h>
 
 /*
  * Defines
@@ -125,6 +126,95 @@ void Test_SBR_Map_Hash(void)
     UtPrintf("Valid route id's encountered in performance loop: %u", (unsigned int)count);
 }
 
+void Test_SBR_Map_Hash_Remove(void)
+{
+    CFE_SBR_RouteId_t routeid[4];
+    CFE_SB_MsgId_t    msgid[4];
+    uint32            histogram[3];
+    uint32            collisions;
+    uint32            i;
+
+    UtPrintf("Invalid msg checks");
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(CFE_SB_INVALID_MSG_ID));
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Histogram of an empty map");
+    memset(histogram, 0xFF, sizeof(histogram));
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_ZERO(histogram[0] + histogram[1] + histogram[2]);
+    UtAssert_VOIDCALL(CFE_SBR_GetProbeHistogram(histogram, 0));
+
+    /*
+     * Build a cluster: 0 and 1 share a home position, 2 and 3 both have the
+     * next position as their home, so all but 0 are displaced by one.
+     */
+    msgid[0] = Test_SBR_Unhash(0x10);
+    msgid[1] = Test_SBR_Unhash(0x10 + (4 * CFE_PLATFORM_SB_MAX_MSG_IDS));
+    msgid[2] = Test_SBR_Unhash(0x11);
+    msgid[3] = Test_SBR_Unhash(0x11 + (4 * CFE_PLATFORM_SB_MAX_MSG_IDS));
+    for (i = 0; i < 4; i++)
+    {
+        routeid[i] = CFE_SBR_AddRoute(msgid[i], &collisions);
+        UtAssert_UINT32_EQ(collisions, (i == 0) ? 0 : (i == 3) ? 2 : 1);
+    }
+
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 2);
+    UtAssert_UINT32_EQ(histogram[2], 1);
+
+    UtPrintf("Longer probes are counted in the last entry");
+    CFE_SBR_GetProbeHistogram(histogram, 2);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 3);
+
+    UtPrintf("Remove the head of the cluster, later entries shift back");
+    CFE_SBR_RemoveRoute(routeid[0]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    for (i = 1; i < 4; i++)
+    {
+        UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[i]).RouteId, routeid[i].RouteId);
+    }
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 2);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+    UtAssert_UINT32_EQ(histogram[2], 0);
+
+    UtPrintf("Remove from the middle, an entry at its home position does not move");
+    CFE_SBR_RemoveRoute(routeid[1]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[3]).RouteId, routeid[3].RouteId);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+
+    UtPrintf("Clearing an id not in the map has no effect");
+    CFE_SBR_ClearRouteId(msgid[0]);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[3]).RouteId, routeid[3].RouteId);
+
+    UtPrintf("Remove a cluster that wraps around the end of the map");
+    CFE_SBR_Init();
+    msgid[0]   = Test_SBR_Unhash(0xFFFFFFFF);
+    msgid[1]   = Test_SBR_Unhash(0x7FFFFFFF);
+    routeid[0] = CFE_SBR_AddRoute(msgid[0], NULL);
+    routeid[1] = CFE_SBR_AddRoute(msgid[1], NULL);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+    CFE_SBR_RemoveRoute(routeid[0]);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[1]).RouteId, routeid[1].RouteId);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 0);
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -132,4 +222,5 @@ void UtTest_Setup(void)
     UtPrintf("Software Bus Routing hash map coverage test...");
 
     UT_ADD_TEST(Test_SBR_Map_Hash);
+    UT_ADD_TEST(Test_SBR_Map_Hash_Remove);
 }
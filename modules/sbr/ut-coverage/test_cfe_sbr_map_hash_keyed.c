@@ -0,0 +1,227 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Test SBR keyed hash message map implementation
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include <string.h>
+
+/*
+ * Defines
+ */
+
+/* Unhash magic number */
+#define CFE_SBR_UNHASH_MAGIC (0x119de1f3)
+
+/*
+ * Reasonable limit on loops in case CFE_PLATFORM_SB_HIGHEST_VALID_MSGID is large
+ * Can be set equal to the configured highest if user requires it
+ */
+#define CFE_SBR_UT_LIMIT_HIGHEST_MSGID 0x1FFF
+
+/******************************************************************************
+ * Local helper to unhash
+ */
+CFE_SB_MsgId_t Test_SBR_Unhash(CFE_SB_MsgId_Atom_t Hash)
+{
+    Hash = ((Hash >> 16) ^ Hash) * CFE_SBR_UNHASH_MAGIC;
+    Hash = ((Hash >> 16) ^ Hash) * CFE_SBR_UNHASH_MAGIC;
+    Hash = (Hash >> 16) ^ Hash;
+
+    return CFE_SB_ValueToMsgId(Hash);
+}
+
+void Test_SBR_Map_Hash_Keyed(void)
+{
+    CFE_SB_MsgId_Atom_t msgidx;
+    CFE_SB_MsgId_Atom_t msgid_limit;
+    CFE_SBR_RouteId_t   routeid[3];
+    CFE_SB_MsgId_t      msgid[3];
+    uint32              count;
+
+    UtPrintf("Invalid msg checks");
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(CFE_SB_INVALID_MSG_ID, CFE_SBR_ValueToRouteId(0)), 0);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_INVALID_MSG_ID)));
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    /* Limit message id loops */
+    if (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID > CFE_SBR_UT_LIMIT_HIGHEST_MSGID)
+    {
+        msgid_limit = CFE_SBR_UT_LIMIT_HIGHEST_MSGID;
+        UtPrintf("Limiting msgid ut loops to 0x%08X of 0x%08X",
+                 (unsigned int)msgid_limit,
+                 (unsigned int)CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
+    }
+    else
+    {
+        msgid_limit = CFE_PLATFORM_SB_HIGHEST_VALID_MSGID;
+        UtPrintf("Testing full msgid range in ut up to 0x%08X", (unsigned int)msgid_limit);
+    }
+
+    UtPrintf("Check that entries are set invalid");
+    count = 0;
+    for (msgidx = 0; msgidx <= msgid_limit; msgidx++)
+    {
+        if (!CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(msgidx))))
+        {
+            count++;
+        }
+    }
+    UtAssert_INT32_EQ(count, msgid_limit + 1);
+
+    /* Unlike the hash map, the map alone is enough to resolve a message id (routing table is not used) */
+    UtPrintf("Set routes and check with a rollover and a skip");
+    msgid[0]   = CFE_SB_INVALID_MSG_ID;
+    msgid[1]   = Test_SBR_Unhash(0xFFFFFFFF);
+    msgid[2]   = Test_SBR_Unhash(0x7FFFFFFF);
+    routeid[0] = CFE_SBR_ValueToRouteId(10);
+    routeid[1] = CFE_SBR_ValueToRouteId(11);
+    routeid[2] = CFE_SBR_ValueToRouteId(12);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[0], routeid[0]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[1], routeid[1]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[2], routeid[2]), 2);
+
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[0])), CFE_SBR_RouteIdToValue(routeid[0]));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
+    UtAssert_BOOL_FALSE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[1]), msgid[1]));
+
+    /* Performance check, compare with the same loop in the hash map test */
+    count = 0;
+    for (msgidx = 0; msgidx <= 0xFFFF; msgidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(msgidx))))
+        {
+            count++;
+        }
+    }
+    UtPrintf("Valid route id's encountered in performance loop: %u", (unsigned int)count);
+}
+
+void Test_SBR_Map_Hash_Keyed_Remove(void)
+{
+    CFE_SBR_RouteId_t routeid[4];
+    CFE_SB_MsgId_t    msgid[4];
+    uint32            histogram[3];
+    uint32            collisions;
+    uint32            i;
+
+    UtPrintf("Invalid msg checks");
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(CFE_SB_INVALID_MSG_ID));
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Histogram of an empty map");
+    memset(histogram, 0xFF, sizeof(histogram));
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_ZERO(histogram[0] + histogram[1] + histogram[2]);
+    UtAssert_VOIDCALL(CFE_SBR_GetProbeHistogram(histogram, 0));
+
+    /*
+     * Build a cluster: 0 and 1 share a home position, 2 and 3 both have the
+     * next position as their home, so all but 0 are displaced by one.
+     */
+    msgid[0] = Test_SBR_Unhash(0x10);
+    msgid[1] = Test_SBR_Unhash(0x10 + (4 * CFE_PLATFORM_SB_MAX_MSG_IDS));
+    msgid[2] = Test_SBR_Unhash(0x11);
+    msgid[3] = Test_SBR_Unhash(0x11 + (4 * CFE_PLATFORM_SB_MAX_MSG_IDS));
+    for (i = 0; i < 4; i++)
+    {
+        routeid[i] = CFE_SBR_AddRoute(msgid[i], &collisions);
+        UtAssert_UINT32_EQ(collisions, (i == 0) ? 0 : (i == 3) ? 2 : 1);
+    }
+
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 2);
+    UtAssert_UINT32_EQ(histogram[2], 1);
+
+    UtPrintf("Longer probes are counted in the last entry");
+    CFE_SBR_GetProbeHistogram(histogram, 2);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 3);
+
+    UtPrintf("Remove the head of the cluster, later entries shift back");
+    CFE_SBR_RemoveRoute(routeid[0]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    for (i = 1; i < 4; i++)
+    {
+        UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[i]).RouteId, routeid[i].RouteId);
+    }
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 2);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+    UtAssert_UINT32_EQ(histogram[2], 0);
+
+    UtPrintf("Remove from the middle, an entry at its home position does not move");
+    CFE_SBR_RemoveRoute(routeid[1]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[3]).RouteId, routeid[3].RouteId);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+
+    UtPrintf("Clearing an id not in the map has no effect");
+    CFE_SBR_ClearRouteId(msgid[0]);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[3]).RouteId, routeid[3].RouteId);
+
+    UtPrintf("Remove a cluster that wraps around the end of the map");
+    CFE_SBR_Init();
+    msgid[0]   = Test_SBR_Unhash(0xFFFFFFFF);
+    msgid[1]   = Test_SBR_Unhash(0x7FFFFFFF);
+    routeid[0] = CFE_SBR_AddRoute(msgid[0], NULL);
+    routeid[1] = CFE_SBR_AddRoute(msgid[1], NULL);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[1], 1);
+    CFE_SBR_RemoveRoute(routeid[0]);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[1]).RouteId, routeid[1].RouteId);
+    CFE_SBR_GetProbeHistogram(histogram, 3);
+    UtAssert_UINT32_EQ(histogram[0], 1);
+    UtAssert_UINT32_EQ(histogram[1], 0);
+}
+
+/* Main unit test routine */
+void UtTest_Setup(void)
+{
+    UT_Init("map_hash_keyed");
+    UtPrintf("Software Bus Routing keyed hash map coverage test...");
+
+    UT_ADD_TEST(Test_SBR_Map_Hash_Keyed);
+    UT_ADD_TEST(Test_SBR_Map_Hash_Keyed_Remove);
+}
@@ -190,6 +190,82 @@ void Test_SBR_Route_Unsort_GetSet(void)
     UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
 }
 
+void Test_SBR_Route_Unsort_Remove(void)
+{
+    CFE_SBR_RouteId_t     routeid[3];
+    CFE_SB_MsgId_t        msgid[3];
+    CFE_SB_DestinationD_t dest;
+    uint32                count;
+    uint32                i;
+
+    UtPrintf("Initialize map and route");
+    CFE_SBR_Init();
+
+    UtPrintf("Invalid route ID checks");
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(CFE_SBR_INVALID_ROUTE_ID));
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_MAX_MSG_IDS)));
+
+    /* Force valid msgid responses, msgids must be in the valid range */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Removing a never used entry has no effect");
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(CFE_SBR_ValueToRouteId(0)));
+    UtAssert_INT32_EQ(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(1), NULL).RouteId, CFE_SBR_ValueToRouteId(0).RouteId);
+    CFE_SBR_Init();
+
+    UtPrintf("Add routes");
+    for (i = 0; i < 3; i++)
+    {
+        msgid[i]   = CFE_SB_ValueToMsgId(i + 1);
+        routeid[i] = CFE_SBR_AddRoute(msgid[i], NULL);
+    }
+
+    UtPrintf("Remove a route, it is skipped by the callback and cleared");
+    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest);
+    CFE_SBR_IncrementSequenceCounter(routeid[1]);
+    CFE_SBR_RemoveRoute(routeid[1]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[1]), CFE_SB_INVALID_MSG_ID));
+    UtAssert_NULL(CFE_SBR_GetDestListHeadPtr(routeid[1]));
+    UtAssert_ZERO(CFE_SBR_GetSequenceCounter(routeid[1]));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_UINT32_EQ(count, 2);
+
+    UtPrintf("Removing twice has no effect");
+    CFE_SBR_RemoveRoute(routeid[1]);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_UINT32_EQ(count, 2);
+
+    UtPrintf("Removed entries are reused, most recently removed first");
+    CFE_SBR_RemoveRoute(routeid[0]);
+    UtAssert_INT32_EQ(CFE_SBR_AddRoute(msgid[1], NULL).RouteId, routeid[0].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_AddRoute(msgid[0], NULL).RouteId, routeid[1].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[0]).RouteId, routeid[1].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[1]).RouteId, routeid[0].RouteId);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_UINT32_EQ(count, 3);
+
+    UtPrintf("Fill routing table, then remove and add repeatedly without running out");
+    count = 3;
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count + 1), NULL)))
+    {
+        count++;
+    }
+    UtAssert_UINT32_EQ(count, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    for (i = 0; i < (2 * CFE_PLATFORM_SB_MAX_MSG_IDS); i++)
+    {
+        routeid[0] = CFE_SBR_GetRouteId(msgid[2]);
+        CFE_SBR_RemoveRoute(routeid[0]);
+        UtAssert_INT32_EQ(CFE_SBR_AddRoute(msgid[2], NULL).RouteId, routeid[0].RouteId);
+    }
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count + 1), NULL)));
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -198,4 +274,5 @@ void UtTest_Setup(void)
 
     UT_ADD_TEST(Test_SBR_Route_Unsort_General);
     UT_ADD_TEST(Test_SBR_Route_Unsort_GetSet);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_Remove);
 }
@@ -32,98 +32,45 @@
 */
 #include "cfe_tbl_module_all.h"
 
+#include "cfe_core_cmddispatch.h"
+
 #include <string.h>
 
 /*********************  Macro and Constant Type Definitions   ***************************/
 
-typedef CFE_Status_t (*CFE_TBL_MsgProcFuncPtr_t)(const void *MsgPtr);
-
-CFE_Status_t CFE_TBL_SearchCmdHandlerTbl(uint16 *TableIdxOut, CFE_SB_MsgId_t MessageID, uint16 CommandCode);
-
-/*
-** Table task const data
-*/
-
-typedef enum
-{
-    CFE_TBL_TERM_MSGTYPE = 0, /**< \brief Command Handler Table Terminator Type */
-    CFE_TBL_MSG_MSGTYPE  = 1, /**< \brief Message Type (requires Message ID match) */
-    CFE_TBL_CMD_MSGTYPE  = 2  /**< \brief Command Type (requires Message ID and Command Code match) */
-} CFE_TBL_MsgType_t;
-
 /* local cache of runtime MsgIDs for TBL */
 static CFE_SB_MsgId_t CFE_TBL_SEND_HK_MID_CACHE = CFE_SB_MSGID_RESERVED;
 static CFE_SB_MsgId_t CFE_TBL_CMD_MID_CACHE     = CFE_SB_MSGID_RESERVED;
 
-/**
-** Data structure of a single record in #CFE_TBL_CmdHandlerTbl
-*/
-typedef struct
-{
-    const CFE_SB_MsgId_t    *MsgId;
-    CFE_MSG_FcnCode_t        CmdCode;        /**< \brief Acceptable Command Code (if necessary) */
-    size_t                   ExpectedLength; /**< \brief Expected Message Length (in bytes) including message header */
-    CFE_TBL_MsgProcFuncPtr_t MsgProcFuncPtr; /**< \brief Pointer to function to handle message  */
-    CFE_TBL_MsgType_t        MsgTypes;       /**< \brief Message Type (i.e. - with/without Cmd Code)   */
-} CFE_TBL_CmdHandlerTblRec_t;
-
-/*
- * Macros to assist in building the CFE_TBL_CmdHandlerTbl -
- *  For command handler entries, which have a command code, payload type, and a handler function
- */
-#define CFE_TBL_ENTRY(id, ccode, paramtype, handlerfunc, msgtype) \
-    { &id##_CACHE, ccode, sizeof(paramtype), (CFE_TBL_MsgProcFuncPtr_t)handlerfunc, msgtype }
-
 /* Constant Data */
 
-const CFE_TBL_CmdHandlerTblRec_t CFE_TBL_CmdHandlerTbl[] = {
-    /* SEND_HK Entry */
-    CFE_TBL_ENTRY(CFE_TBL_SEND_HK_MID, 0, CFE_TBL_SendHkCmd_t, CFE_TBL_SendHkCmd, CFE_TBL_MSG_MSGTYPE),
-
-    /* Everything else */
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_NOOP_CC, CFE_TBL_NoopCmd_t, CFE_TBL_NoopCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_RESET_COUNTERS_CC,
-                  CFE_TBL_ResetCountersCmd_t,
-                  CFE_TBL_ResetCountersCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_LOAD_CC, CFE_TBL_LoadCmd_t, CFE_TBL_LoadCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_DUMP_CC, CFE_TBL_DumpCmd_t, CFE_TBL_DumpCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_VALIDATE_CC,
-                  CFE_TBL_ValidateCmd_t,
-                  CFE_TBL_ValidateCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_ACTIVATE_CC,
-                  CFE_TBL_ActivateCmd_t,
-                  CFE_TBL_ActivateCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_DUMP_REGISTRY_CC,
-                  CFE_TBL_DumpRegistryCmd_t,
-                  CFE_TBL_DumpRegistryCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_SEND_REGISTRY_CC,
-                  CFE_TBL_SendRegistryCmd_t,
-                  CFE_TBL_SendRegistryCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_DELETE_CDS_CC,
-                  CFE_TBL_DeleteCDSCmd_t,
-                  CFE_TBL_DeleteCDSCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID,
-                  CFE_TBL_ABORT_LOAD_CC,
-                  CFE_TBL_AbortLoadCmd_t,
-                  CFE_TBL_AbortLoadCmd,
-                  CFE_TBL_CMD_MSGTYPE),
+/* SEND_HK Entry */
+static const CFE_CORE_CmdDispatchEntry_t CFE_TBL_SEND_HK_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_SendHkCmd_t, CFE_TBL_SendHkCmd);
+
+/* Everything else, indexed by function code */
+static const CFE_CORE_CmdDispatchEntry_t CFE_TBL_CMD_DISPATCH[] = {
+    [CFE_TBL_NOOP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_NoopCmd_t, CFE_TBL_NoopCmd),
+    [CFE_TBL_RESET_COUNTERS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_ResetCountersCmd_t, CFE_TBL_ResetCountersCmd),
+    [CFE_TBL_LOAD_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_LoadCmd_t, CFE_TBL_LoadCmd),
+    [CFE_TBL_DUMP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_DumpCmd_t, CFE_TBL_DumpCmd),
+    [CFE_TBL_VALIDATE_CC]       = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_ValidateCmd_t, CFE_TBL_ValidateCmd),
+    [CFE_TBL_ACTIVATE_CC]       = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_ActivateCmd_t, CFE_TBL_ActivateCmd),
+    [CFE_TBL_DUMP_REGISTRY_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_DumpRegistryCmd_t, CFE_TBL_DumpRegistryCmd),
+    [CFE_TBL_SEND_REGISTRY_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_SendRegistryCmd_t, CFE_TBL_SendRegistryCmd),
+    [CFE_TBL_DELETE_CDS_CC]     = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_DeleteCDSCmd_t, CFE_TBL_DeleteCDSCmd),
+    [CFE_TBL_ABORT_LOAD_CC]     = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TBL_AbortLoadCmd_t, CFE_TBL_AbortLoadCmd),
+};
 
-    /* list terminator (keep last) */
-    { 0, 0, 0, NULL, CFE_TBL_TERM_MSGTYPE }
+/* Command statistics index of each message, after the one of the housekeeping request */
+static const CFE_CORE_CmdDispatchSlot_t CFE_TBL_DISPATCH_SLOTS[] = {
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TBL_SEND_HK_MID_CACHE, CFE_TBL_SEND_HK_DISPATCH, 0),
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_TBL_CMD_MID_CACHE, CFE_TBL_CMD_DISPATCH, 1),
 };
 
+static const CFE_CORE_CmdDispatchTable_t CFE_TBL_DISPATCH_TABLE =
+    CFE_CORE_CMDDISPATCH_TABLE(CFE_TBL_DISPATCH_SLOTS, CFE_ES_CmdStatsService_TBL);
+
 /******************************************************************************/
 
 /*----------------------------------------------------------------
@@ -134,39 +81,35 @@ const CFE_TBL_CmdHandlerTblRec_t CFE_TBL_CmdHandlerTbl[] = {
  *-----------------------------------------------------------------*/
 void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_SB_MsgId_t    MessageID;
-    CFE_MSG_FcnCode_t CommandCode;
-    uint16            CmdIndx;
-    CFE_MSG_Size_t    ActualLength;
-    CFE_MSG_Size_t    ExpectedLength;
-    CFE_Status_t      CmdStatus;
+    CFE_MSG_HeaderView_t               HdrView;
+    const CFE_CORE_CmdDispatchEntry_t *EntryPtr;
+    uint16                             StatsIndex;
+    CFE_SB_MsgId_t                     MessageID;
+    CFE_MSG_FcnCode_t                  CommandCode;
+    CFE_MSG_Size_t                     ActualLength;
+    CFE_Status_t                       CmdStatus;
+
+    /* cache the local MID Values here, this avoids repeat lookups */
+    if (!CFE_SB_IsValidMsgId(CFE_TBL_CMD_MID_CACHE))
+    {
+        CFE_TBL_CMD_MID_CACHE     = CFE_SB_ValueToMsgId(CFE_TBL_CMD_MID);
+        CFE_TBL_SEND_HK_MID_CACHE = CFE_SB_ValueToMsgId(CFE_TBL_SEND_HK_MID);
+    }
 
-    MessageID    = CFE_SB_INVALID_MSG_ID;
-    CommandCode  = 0;
-    ActualLength = 0;
+    /* Ignore return, buffer from SB is never NULL */
+    CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
+    MessageID    = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+    CommandCode  = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
+    ActualLength = CFE_MSG_HeaderView_GetSize(&HdrView);
 
-    /* Search the Command Handler Table for a matching message */
-    CmdStatus = CFE_TBL_SearchCmdHandlerTbl(&CmdIndx, MessageID, CommandCode);
+    /* Find the handler of the message, this also verifies the message length */
+    CmdStatus = CFE_CORE_CmdDispatch_Lookup(&CFE_TBL_DISPATCH_TABLE, &HdrView, &EntryPtr, &StatsIndex);
 
-    /* Check to see if a matching command was found */
     if (CmdStatus == CFE_SUCCESS)
     {
-        /* Verify Message Length before processing */
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &ActualLength);
-        ExpectedLength = CFE_TBL_CmdHandlerTbl[CmdIndx].ExpectedLength;
-
-        if (ActualLength == ExpectedLength)
-        {
-            /* All checks have passed, call the appropriate message handler */
-            CmdStatus = (CFE_TBL_CmdHandlerTbl[CmdIndx].MsgProcFuncPtr)(SBBufPtr);
-        }
-        else /* Bad Message Length */
-        {
-            CmdStatus = CFE_STATUS_WRONG_MSG_LENGTH;
-        }
+        /* All checks have passed, call the appropriate message handler */
+        CmdStatus = CFE_CORE_CmdDispatch_Invoke(&CFE_TBL_DISPATCH_TABLE, EntryPtr, StatsIndex, SBBufPtr, &HdrView);
     }
 
     if (CmdStatus != CFE_SUCCESS)
@@ -179,7 +122,7 @@ void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                               (unsigned int)CFE_SB_MsgIdToValue(MessageID),
                               (unsigned int)CommandCode,
                               (unsigned int)ActualLength,
-                              (unsigned int)CFE_TBL_CmdHandlerTbl[CmdIndx].ExpectedLength);
+                              (unsigned int)EntryPtr->ExpectedLength);
         }
         else if (CmdStatus == CFE_STATUS_BAD_COMMAND_CODE)
         {
@@ -201,75 +144,3 @@ void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
         }
     }
 }
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-CFE_Status_t CFE_TBL_SearchCmdHandlerTbl(uint16 *TableIdxOut, CFE_SB_MsgId_t MessageID, uint16 CommandCode)
-{
-    int16        TblIndx;
-    CFE_Status_t Status;
-    bool         FoundMsg;
-    bool         FoundMatch;
-
-    FoundMsg   = false;
-    FoundMatch = false;
-
-    /* cache the local MID Values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CFE_TBL_CMD_MID_CACHE))
-    {
-        CFE_TBL_CMD_MID_CACHE     = CFE_SB_ValueToMsgId(CFE_TBL_CMD_MID);
-        CFE_TBL_SEND_HK_MID_CACHE = CFE_SB_ValueToMsgId(CFE_TBL_SEND_HK_MID);
-    }
-
-    for (TblIndx = 0; CFE_TBL_CmdHandlerTbl[TblIndx].MsgId != NULL; ++TblIndx)
-    {
-        /* Check to see if we found a matching Message ID */
-        if (CFE_SB_MsgId_Equal(*CFE_TBL_CmdHandlerTbl[TblIndx].MsgId, MessageID))
-        {
-            /* Flag any found message IDs so that if there is an error,        */
-            /* we can determine if it was a bad message ID or bad command code */
-            FoundMsg = true;
-
-            /* If entry in the Command Handler Table is a command entry, */
-            /* then check for a matching command code                    */
-            if (CFE_TBL_CmdHandlerTbl[TblIndx].MsgTypes == CFE_TBL_CMD_MSGTYPE)
-            {
-                if (CFE_TBL_CmdHandlerTbl[TblIndx].CmdCode == CommandCode)
-                {
-                    /* Found matching message ID and Command Code */
-                    FoundMatch = true;
-                    break;
-                }
-            }
-            else /* Message is not a command message with specific command code */
-            {
-                /* Automatically assume a match when legit */
-                /* Message ID is all that is required      */
-                FoundMatch = true;
-                break;
-            }
-        }
-    }
-
-    /* If we failed to find a match, return a negative index */
-    if (FoundMatch)
-    {
-        Status       = CFE_SUCCESS;
-        *TableIdxOut = TblIndx;
-    }
-    else if (FoundMsg)
-    {
-        /* A matching message ID was found, so the command code must be bad */
-        Status = CFE_STATUS_BAD_COMMAND_CODE;
-    }
-    else /* No matching message ID was found */
-    {
-        Status = CFE_STATUS_UNKNOWN_MSG_ID;
-    }
-
-    return Status;
-}
@@ -54,10 +54,11 @@ static const EdsDispatchTable_EdsComponent_CFE_TBL_Application_CFE_SB_Telecomman
  *-----------------------------------------------------------------*/
 void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_Status_t      Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_Size_t    MsgSize;
-    CFE_MSG_FcnCode_t MsgFc;
+    CFE_Status_t         Status;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_MSG_Size_t       MsgSize;
+    CFE_MSG_FcnCode_t    MsgFc;
+    CFE_MSG_HeaderView_t HdrView;
 
     Status = EdsDispatch_EdsComponent_CFE_TBL_Application_Telecommand(SBBufPtr, &CFE_TBL_TC_DISPATCH_TABLE);
 
@@ -65,9 +66,10 @@ void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
     if (Status == CFE_STATUS_BAD_COMMAND_CODE || Status == CFE_STATUS_WRONG_MSG_LENGTH
         || Status == CFE_STATUS_UNKNOWN_MSG_ID || Status == CFE_TBL_NOT_IMPLEMENTED)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+        CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+        MsgId   = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+        MsgFc   = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
+        MsgSize = CFE_MSG_HeaderView_GetSize(&HdrView);
 
         if (Status == CFE_TBL_NOT_IMPLEMENTED || Status == CFE_STATUS_BAD_COMMAND_CODE)
         {
@@ -328,13 +328,18 @@ CFE_TBL_RegId_t CFE_TBL_FindTableInRegistry(const char *TblName)
  *-----------------------------------------------------------------*/
 int32 CFE_TBL_LockRegistry(void)
 {
-    int32 OsStatus;
-    int32 Status;
+    int32  OsStatus;
+    int32  Status;
+    uint64 WaitStartTicks;
+
+    WaitStartTicks = CFE_ES_LockProfileWaitStart();
 
     OsStatus = OS_MutSemTake(CFE_TBL_Global.RegistryMutex);
 
     if (OsStatus == OS_SUCCESS)
     {
+        /* No call site is passed to this lock, so all takes are recorded as one place */
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_TBL_REGISTRY, __func__, 0, WaitStartTicks);
         Status = CFE_SUCCESS;
     }
     else
@@ -356,6 +361,8 @@ int32 CFE_TBL_UnlockRegistry(void)
     int32 OsStatus;
     int32 Status;
 
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileId_TBL_REGISTRY);
+
     OsStatus = OS_MutSemGive(CFE_TBL_Global.RegistryMutex);
 
     if (OsStatus == OS_SUCCESS)
@@ -58,7 +58,8 @@
 #include "cfe_tbl_dump.h"
 
 /*
- * Additionally TBL needs to use special/extra CDS APIs that are not in the normal API
+ * Additionally TBL needs to use special/extra CDS APIs that are not in the normal API,
+ * and the lock profiler API for the registry lock
  */
 #include "cfe_es_core_internal.h"
 
@@ -26,186 +26,78 @@
 ** Required header files...
 */
 #include "cfe_time_module_all.h"
+#include "cfe_core_cmddispatch.h"
 
-/*----------------------------------------------------------------
- *
- * Internal helper routine only, not part of API.
- *
- * Function to verify the length of incoming TIME command packets
- *
- *-----------------------------------------------------------------*/
-bool CFE_TIME_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
-{
-    bool              result       = true;
-    CFE_MSG_Size_t    ActualLength = 0;
-    CFE_MSG_FcnCode_t FcnCode      = 0;
-    CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
-
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
-
-    /*
-    ** Verify the command packet length
-    */
-    if (ExpectedLength != ActualLength)
-    {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
-
-        CFE_EVS_SendEvent(CFE_TIME_LEN_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId),
-                          (unsigned int)FcnCode,
-                          (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
-        result = false;
-        ++CFE_TIME_Global.CommandErrorCounter;
-    }
-
-    return result;
-}
-
-/*----------------------------------------------------------------
- *
- * Local Helper function
- *
- *-----------------------------------------------------------------*/
-void CFE_TIME_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
-{
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
-    switch (CommandCode)
-    {
-        case CFE_TIME_NOOP_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_NoopCmd_t)))
-            {
-                CFE_TIME_NoopCmd((const CFE_TIME_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_RESET_COUNTERS_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_ResetCountersCmd_t)))
-            {
-                CFE_TIME_ResetCountersCmd((const CFE_TIME_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SEND_DIAGNOSTIC_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SendDiagnosticCmd_t)))
-            {
-                CFE_TIME_SendDiagnosticTlm((const CFE_TIME_SendDiagnosticCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_STATE_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetStateCmd_t)))
-            {
-                CFE_TIME_SetStateCmd((const CFE_TIME_SetStateCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_SOURCE_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSourceCmd_t)))
-            {
-                CFE_TIME_SetSourceCmd((const CFE_TIME_SetSourceCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_SIGNAL_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSignalCmd_t)))
-            {
-                CFE_TIME_SetSignalCmd((const CFE_TIME_SetSignalCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /*
-        ** Time Clients process "tone delay" commands...
-        */
-        case CFE_TIME_ADD_DELAY_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddDelayCmd_t)))
-            {
-                CFE_TIME_AddDelayCmd((const CFE_TIME_AddDelayCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SUB_DELAY_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubDelayCmd_t)))
-            {
-                CFE_TIME_SubDelayCmd((const CFE_TIME_SubDelayCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /*
-        ** Time Servers process "set time" commands...
-        */
-        case CFE_TIME_SET_TIME_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetTimeCmd_t)))
-            {
-                CFE_TIME_SetTimeCmd((const CFE_TIME_SetTimeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_MET_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetMETCmd_t)))
-            {
-                CFE_TIME_SetMETCmd((const CFE_TIME_SetMETCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_STCF_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSTCFCmd_t)))
-            {
-                CFE_TIME_SetSTCFCmd((const CFE_TIME_SetSTCFCmd_t *)SBBufPtr);
-            }
-            break;
+/* local cache of runtime MsgIDs for TIME */
+static CFE_SB_MsgId_t CFE_TIME_CMD_MID_CACHE       = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_TIME_SEND_HK_MID_CACHE   = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_TIME_ONEHZ_CMD_MID_CACHE = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_TIME_TONE_CMD_MID_CACHE  = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_TIME_DATA_CMD_MID_CACHE  = CFE_SB_MSGID_RESERVED;
+static CFE_SB_MsgId_t CFE_TIME_SEND_CMD_MID_CACHE  = CFE_SB_MSGID_RESERVED;
 
-        case CFE_TIME_SET_LEAP_SECONDS_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetLeapSecondsCmd_t)))
-            {
-                CFE_TIME_SetLeapSecondsCmd((const CFE_TIME_SetLeapSecondsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_ADD_ADJUST_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddAdjustCmd_t)))
-            {
-                CFE_TIME_AddAdjustCmd((const CFE_TIME_AddAdjustCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SUB_ADJUST_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubAdjustCmd_t)))
-            {
-                CFE_TIME_SubAdjustCmd((const CFE_TIME_SubAdjustCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_ADD_ONE_HZ_ADJUSTMENT_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddOneHzAdjustmentCmd_t)))
-            {
-                CFE_TIME_AddOneHzAdjustmentCmd((const CFE_TIME_AddOneHzAdjustmentCmd_t *)SBBufPtr);
-            }
-            break;
+/*
+** Ground command dispatch table, indexed by function code
+**
+** Time Clients process the "tone delay" commands, Time Servers
+** process the "set time" commands.
+*/
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_CMD_DISPATCH[] = {
+    [CFE_TIME_NOOP_CC]           = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_NoopCmd_t, CFE_TIME_NoopCmd),
+    [CFE_TIME_RESET_COUNTERS_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_ResetCountersCmd_t, CFE_TIME_ResetCountersCmd),
+    [CFE_TIME_SEND_DIAGNOSTIC_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SendDiagnosticCmd_t, CFE_TIME_SendDiagnosticTlm),
+    [CFE_TIME_SET_STATE_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetStateCmd_t, CFE_TIME_SetStateCmd),
+    [CFE_TIME_SET_SOURCE_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetSourceCmd_t, CFE_TIME_SetSourceCmd),
+    [CFE_TIME_SET_SIGNAL_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetSignalCmd_t, CFE_TIME_SetSignalCmd),
+    [CFE_TIME_ADD_DELAY_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_AddDelayCmd_t, CFE_TIME_AddDelayCmd),
+    [CFE_TIME_SUB_DELAY_CC]  = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SubDelayCmd_t, CFE_TIME_SubDelayCmd),
+    [CFE_TIME_SET_TIME_CC]   = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetTimeCmd_t, CFE_TIME_SetTimeCmd),
+    [CFE_TIME_SET_MET_CC]    = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetMETCmd_t, CFE_TIME_SetMETCmd),
+    [CFE_TIME_SET_STCF_CC]   = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetSTCFCmd_t, CFE_TIME_SetSTCFCmd),
+    [CFE_TIME_SET_LEAP_SECONDS_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SetLeapSecondsCmd_t, CFE_TIME_SetLeapSecondsCmd),
+    [CFE_TIME_ADD_ADJUST_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_AddAdjustCmd_t, CFE_TIME_AddAdjustCmd),
+    [CFE_TIME_SUB_ADJUST_CC] = CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SubAdjustCmd_t, CFE_TIME_SubAdjustCmd),
+    [CFE_TIME_ADD_ONE_HZ_ADJUSTMENT_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_AddOneHzAdjustmentCmd_t, CFE_TIME_AddOneHzAdjustmentCmd),
+    [CFE_TIME_SUB_ONE_HZ_ADJUSTMENT_CC] =
+        CFE_CORE_CMDDISPATCH_ENTRY(CFE_TIME_SubOneHzAdjustmentCmd_t, CFE_TIME_SubOneHzAdjustmentCmd),
+};
 
-        case CFE_TIME_SUB_ONE_HZ_ADJUSTMENT_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubOneHzAdjustmentCmd_t)))
-            {
-                CFE_TIME_SubOneHzAdjustmentCmd((const CFE_TIME_SubOneHzAdjustmentCmd_t *)SBBufPtr);
-            }
-            break;
+/*
+** Messages without function codes, passed on whatever their length
+*/
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_ONEHZ_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_TIME_OneHzCmd);
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_SEND_HK_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_TIME_SendHkCmd);
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_DATA_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_TIME_ToneDataCmd);
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_TONE_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_TIME_ToneSignalCmd);
+#if (CFE_PLATFORM_TIME_CFG_SERVER == true)
+static const CFE_CORE_CmdDispatchEntry_t CFE_TIME_SEND_DISPATCH =
+    CFE_CORE_CMDDISPATCH_ANYLEN_ENTRY(CFE_TIME_ToneSendCmd);
+#endif
 
-        default:
+/*
+** Command statistics index of each message, the ground commands keep
+** the same indices whether or not this is a Time Server
+*/
+static const CFE_CORE_CmdDispatchSlot_t CFE_TIME_DISPATCH_SLOTS[] = {
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TIME_ONEHZ_CMD_MID_CACHE, CFE_TIME_ONEHZ_DISPATCH, 0),
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TIME_SEND_HK_MID_CACHE, CFE_TIME_SEND_HK_DISPATCH, 1),
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TIME_DATA_CMD_MID_CACHE, CFE_TIME_DATA_DISPATCH, 2),
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TIME_TONE_CMD_MID_CACHE, CFE_TIME_TONE_DISPATCH, 3),
+#if (CFE_PLATFORM_TIME_CFG_SERVER == true)
+    CFE_CORE_CMDDISPATCH_MSG_SLOT(CFE_TIME_SEND_CMD_MID_CACHE, CFE_TIME_SEND_DISPATCH, 4),
+#endif
+    CFE_CORE_CMDDISPATCH_CMD_SLOT(CFE_TIME_CMD_MID_CACHE, CFE_TIME_CMD_DISPATCH, 5),
+};
 
-            CFE_TIME_Global.CommandErrorCounter++;
-            CFE_EVS_SendEvent(CFE_TIME_CC_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Invalid command code -- ID = 0x%X, CC = %d",
-                              (unsigned int)CFE_TIME_CMD_MID,
-                              (int)CommandCode);
-            break;
-    } /* switch (CFE_TIME_CMD_MID -- command code)*/
-}
+static const CFE_CORE_CmdDispatchTable_t CFE_TIME_DISPATCH_TABLE =
+    CFE_CORE_CMDDISPATCH_TABLE(CFE_TIME_DISPATCH_SLOTS, CFE_ES_CmdStatsService_TIME);
 
 /*----------------------------------------------------------------
  *
@@ -215,70 +107,52 @@ void CFE_TIME_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
  *-----------------------------------------------------------------*/
 void CFE_TIME_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID       = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID   = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t ONEHZ_CMD_MID = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t TONE_CMD_MID  = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t DATA_CMD_MID  = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_CMD_MID  = CFE_SB_MSGID_RESERVED;
-
-    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_HeaderView_t               HdrView;
+    const CFE_CORE_CmdDispatchEntry_t *EntryPtr;
+    uint16                             StatsIndex;
+    CFE_SB_MsgId_t                     MessageID;
+    CFE_Status_t                       Status;
 
     /* cache the local MID Values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CMD_MID))
+    if (!CFE_SB_IsValidMsgId(CFE_TIME_CMD_MID_CACHE))
     {
-        CMD_MID       = CFE_SB_ValueToMsgId(CFE_TIME_CMD_MID);
-        SEND_HK_MID   = CFE_SB_ValueToMsgId(CFE_TIME_SEND_HK_MID);
-        ONEHZ_CMD_MID = CFE_SB_ValueToMsgId(CFE_TIME_ONEHZ_CMD_MID);
-        TONE_CMD_MID  = CFE_SB_ValueToMsgId(CFE_TIME_TONE_CMD_MID);
-        DATA_CMD_MID  = CFE_SB_ValueToMsgId(CFE_TIME_DATA_CMD_MID);
-        SEND_CMD_MID  = CFE_SB_ValueToMsgId(CFE_TIME_SEND_CMD_MID);
+        CFE_TIME_CMD_MID_CACHE       = CFE_SB_ValueToMsgId(CFE_TIME_CMD_MID);
+        CFE_TIME_SEND_HK_MID_CACHE   = CFE_SB_ValueToMsgId(CFE_TIME_SEND_HK_MID);
+        CFE_TIME_ONEHZ_CMD_MID_CACHE = CFE_SB_ValueToMsgId(CFE_TIME_ONEHZ_CMD_MID);
+        CFE_TIME_TONE_CMD_MID_CACHE  = CFE_SB_ValueToMsgId(CFE_TIME_TONE_CMD_MID);
+        CFE_TIME_DATA_CMD_MID_CACHE  = CFE_SB_ValueToMsgId(CFE_TIME_DATA_CMD_MID);
+        CFE_TIME_SEND_CMD_MID_CACHE  = CFE_SB_ValueToMsgId(CFE_TIME_SEND_CMD_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    /* Ignore return, buffer from SB is never NULL */
+    CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+    MessageID = CFE_MSG_HeaderView_GetMsgId(&HdrView);
 
-    /* Process all SB messages */
-    if (CFE_SB_MsgId_Equal(MessageID, ONEHZ_CMD_MID))
-    {
-        /*
-        ** Run time state machine at 1Hz...
-        */
-        CFE_TIME_OneHzCmd((const CFE_TIME_OneHzCmd_t *)SBBufPtr);
-    }
-    else if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
-    {
-        /*
-        ** Housekeeping telemetry request...
-        */
-        CFE_TIME_SendHkCmd((const CFE_TIME_SendHkCmd_t *)SBBufPtr);
-    }
-    else if (CFE_SB_MsgId_Equal(MessageID, DATA_CMD_MID))
+    Status = CFE_CORE_CmdDispatch_Lookup(&CFE_TIME_DISPATCH_TABLE, &HdrView, &EntryPtr, &StatsIndex);
+
+    if (Status == CFE_SUCCESS)
     {
-        /*
-        ** Time at the tone "data"...
-        */
-        CFE_TIME_ToneDataCmd((const CFE_TIME_ToneDataCmd_t *)SBBufPtr);
+        CFE_CORE_CmdDispatch_Invoke(&CFE_TIME_DISPATCH_TABLE, EntryPtr, StatsIndex, SBBufPtr, &HdrView);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, TONE_CMD_MID))
+    else if (Status == CFE_STATUS_WRONG_MSG_LENGTH)
     {
-        /*
-        ** Time at the tone "signal"...
-        */
-        CFE_TIME_ToneSignalCmd((const CFE_TIME_ToneSignalCmd_t *)SBBufPtr);
-    }
-#if (CFE_PLATFORM_TIME_CFG_SERVER == true)
-    else if (CFE_SB_MsgId_Equal(MessageID, SEND_CMD_MID))
-    {
-        /*
-        ** Request for time at the tone "data"...
-        */
-        CFE_TIME_ToneSendCmd((const CFE_TIME_FakeToneCmd_t *)SBBufPtr);
+        CFE_EVS_SendEvent(CFE_TIME_LEN_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
+                          (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                          (unsigned int)CFE_MSG_HeaderView_GetFcnCode(&HdrView),
+                          (unsigned int)CFE_MSG_HeaderView_GetSize(&HdrView),
+                          (unsigned int)EntryPtr->ExpectedLength);
+        ++CFE_TIME_Global.CommandErrorCounter;
     }
-#endif
-    else if (CFE_SB_MsgId_Equal(MessageID, CMD_MID))
+    else if (Status == CFE_STATUS_BAD_COMMAND_CODE)
     {
-        /* Normal ground command */
-        CFE_TIME_ProcessGroundCmd(SBBufPtr);
+        CFE_TIME_Global.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_TIME_CC_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid command code -- ID = 0x%X, CC = %d",
+                          (unsigned int)CFE_TIME_CMD_MID,
+                          (int)CFE_MSG_HeaderView_GetFcnCode(&HdrView));
     }
     else
     {
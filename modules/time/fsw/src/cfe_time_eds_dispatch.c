@@ -87,9 +87,10 @@ static const EdsDispatchTable_EdsComponent_CFE_TIME_Application_CFE_SB_Telecomma
  *-----------------------------------------------------------------*/
 void CFE_TIME_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    int32             Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_FcnCode_t MsgFc;
+    int32                Status;
+    CFE_SB_MsgId_t       MsgId;
+    CFE_MSG_FcnCode_t    MsgFc;
+    CFE_MSG_HeaderView_t HdrView;
 
     Status = EdsDispatch_EdsComponent_CFE_TIME_Application_Telecommand(SBBufPtr, &CFE_TIME_TC_DISPATCH_TABLE);
 
@@ -97,8 +98,9 @@ void CFE_TIME_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
     if (Status == CFE_STATUS_BAD_COMMAND_CODE || Status == CFE_STATUS_WRONG_MSG_LENGTH
         || Status == CFE_STATUS_UNKNOWN_MSG_ID)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
+        CFE_MSG_DecodeHeader(&SBBufPtr->Msg, &HdrView);
+        MsgId = CFE_MSG_HeaderView_GetMsgId(&HdrView);
+        MsgFc = CFE_MSG_HeaderView_GetFcnCode(&HdrView);
 
         if (Status == CFE_STATUS_BAD_COMMAND_CODE)
         {